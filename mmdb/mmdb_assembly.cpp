@@ -0,0 +1,682 @@
+//  $Id: mmdb_assembly.cpp $
+//  =================================================================
+//
+//   CCP4 Coordinate Library: support of coordinate-related
+//   functionality in protein crystallography applications.
+//
+//   Copyright (C) The MMDB contributors 2026.
+//
+//    This library is free software: you can redistribute it and/or
+//    modify it under the terms of the GNU Lesser General Public
+//    License version 3, modified in accordance with the provisions
+//    of the license to address the requirements of UK law.
+//
+//    You should have received a copy of the modified GNU Lesser
+//    General Public License along with this library. If not, copies
+//    may be downloaded from http://www.ccp4.ac.uk/ccp4license.php
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//  =================================================================
+//
+//    18.10.26   <--  Date of Last Modification.
+//                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  -----------------------------------------------------------------
+//
+//  **** Module  :  mmdb_assembly <implementation>
+//       ~~~~~~~~~
+//       Project :  MacroMolecular Data Base (MMDB)
+//       ~~~~~~~~~
+//  **** Classes :  mmdb::AssemblyUnit    ( chain copy in assembly   )
+//       ~~~~~~~~~  mmdb::VirtualAssembly ( lazy NCS/biomolecule view )
+//
+//  (C) The MMDB contributors 2026
+//
+//  =================================================================
+//
+
+#include <string.h>
+#include <math.h>
+
+#include "mmdb_assembly.h"
+
+namespace mmdb  {
+
+  // ====================  VirtualAssembly  =========================
+
+  VirtualAssembly::VirtualAssembly()  {
+    InitVirtualAssembly();
+  }
+
+  VirtualAssembly::~VirtualAssembly()  {
+    FreeMemory();
+  }
+
+  void  VirtualAssembly::InitVirtualAssembly()  {
+    manager  = NULL;
+    modelNo  = 0;
+    srcChain = NULL;
+    srcAtom  = NULL;
+    srcLen   = NULL;
+    nSrc     = 0;
+    op       = NULL;
+    nOps     = 0;
+    unit     = NULL;
+    nUnits   = 0;
+    nUAlloc  = 0;
+    nAtoms   = 0;
+    caching  = false;
+    xs       = NULL;
+    ys       = NULL;
+    zs       = NULL;
+    nScratch = 0;
+  }
+
+  void  VirtualAssembly::FreeMemory()  {
+  int i;
+
+    FreeCache();
+    if (unit)  delete[] unit;
+    unit    = NULL;
+    nUnits  = 0;
+    nUAlloc = 0;
+    nAtoms  = 0;
+
+    if (op)  delete[] op;
+    op   = NULL;
+    nOps = 0;
+
+    if (srcAtom)  {
+      for (i=0;i<nSrc;i++)
+        if (srcAtom[i])  delete[] srcAtom[i];
+      delete[] srcAtom;
+    }
+    srcAtom = NULL;
+    FreeVectorMemory ( srcLen,0 );
+    if (srcChain)  delete[] srcChain;
+    srcChain = NULL;
+    nSrc     = 0;
+
+    FreeVectorMemory ( xs,0 );
+    FreeVectorMemory ( ys,0 );
+    FreeVectorMemory ( zs,0 );
+    nScratch = 0;
+
+    manager = NULL;
+    modelNo = 0;
+
+  }
+
+  void  VirtualAssembly::FreeCache()  {
+  int i;
+    for (i=0;i<nUnits;i++)  {
+      FreeVectorMemory ( unit[i].x,0 );
+      FreeVectorMemory ( unit[i].y,0 );
+      FreeVectorMemory ( unit[i].z,0 );
+    }
+  }
+
+  void  VirtualAssembly::SetCaching ( bool on )  {
+    caching = on;
+    if (!caching)  FreeCache();
+  }
+
+
+  bool  VirtualAssembly::SetSource ( PManager M, int model_No )  {
+  //   Makes tables of source chains and their atoms. Ter atoms
+  // and atoms without coordinates are left out.
+  PPChain  ch;
+  PResidue res;
+  PAtom    atm;
+  int      i,j,k,n,nc;
+
+    FreeMemory();
+
+    if (!M)  return false;
+    M->GetChainTable ( model_No,ch,nc );
+    if ((!ch) || (nc<=0))  return false;
+
+    manager  = M;
+    modelNo  = model_No;
+    nSrc     = nc;
+    srcChain = new PChain[nSrc];
+    srcAtom  = new PPAtom[nSrc];
+    GetVectorMemory ( srcLen,nSrc,0 );
+
+    for (i=0;i<nSrc;i++)  {
+      srcChain[i] = ch[i];
+      srcAtom [i] = NULL;
+      srcLen  [i] = 0;
+      if (!srcChain[i])  continue;
+      for (n=0;n<2;n++)  {  // 0: count atoms, 1: fill the table
+        k = 0;
+        for (j=0;j<srcChain[i]->GetNumberOfResidues();j++)  {
+          res = srcChain[i]->GetResidue ( j );
+          if (res)
+            for (nc=0;nc<res->GetNumberOfAtoms();nc++)  {
+              atm = res->GetAtom ( nc );
+              if (atm)  {
+                if ((!atm->Ter) &&
+                    (atm->WhatIsSet & ASET_Coordinates))  {
+                  if (n>0)  srcAtom[i][k] = atm;
+                  k++;
+                }
+              }
+            }
+        }
+        if ((n==0) && (k>0))  srcAtom[i] = new PAtom[k];
+        srcLen[i] = k;
+        if (k<=0)  break;
+      }
+    }
+
+    return true;
+
+  }
+
+  int  VirtualAssembly::AddOperator ( mat44 & T )  {
+  pmat44 op1;
+  int    i,j,k;
+    op1 = new mat44[nOps+1];
+    for (k=0;k<nOps;k++)
+      for (i=0;i<4;i++)
+        for (j=0;j<4;j++)
+          op1[k][i][j] = op[k][i][j];
+    for (i=0;i<4;i++)
+      for (j=0;j<4;j++)
+        op1[nOps][i][j] = T[i][j];
+    if (op)  delete[] op;
+    op = op1;
+    nOps++;
+    return nOps-1;
+  }
+
+  void  VirtualAssembly::AddUnit ( int src_No, int op_No,
+                                   cpstr chID )  {
+  PAssemblyUnit unit1;
+  int           i;
+    if (nUnits>=nUAlloc)  {
+      nUAlloc = nUnits + IMax(nUnits/2,16);
+      unit1   = new AssemblyUnit[nUAlloc];
+      for (i=0;i<nUnits;i++)
+        unit1[i] = unit[i];
+      if (unit)  delete[] unit;
+      unit = unit1;
+    }
+    unit[nUnits].srcNo  = src_No;
+    unit[nUnits].opNo   = op_No;
+    strcpy_n0 ( unit[nUnits].chainID,chID,sizeof(ChainID)-1 );
+    unit[nUnits].atom1  = 0;
+    unit[nUnits].nAtoms = srcLen[src_No];
+    unit[nUnits].x      = NULL;
+    unit[nUnits].y      = NULL;
+    unit[nUnits].z      = NULL;
+    nUnits++;
+  }
+
+  void  VirtualAssembly::FinishUnits()  {
+  int i,n;
+    nAtoms = 0;
+    n      = 0;
+    for (i=0;i<nUnits;i++)  {
+      unit[i].atom1 = nAtoms;
+      nAtoms += unit[i].nAtoms;
+      if (unit[i].nAtoms>n)  n = unit[i].nAtoms;
+    }
+    if (n>nScratch)  {
+      FreeVectorMemory ( xs,0 );
+      FreeVectorMemory ( ys,0 );
+      FreeVectorMemory ( zs,0 );
+      nScratch = n;
+      GetVectorMemory ( xs,nScratch,0 );
+      GetVectorMemory ( ys,nScratch,0 );
+      GetVectorMemory ( zs,nScratch,0 );
+    }
+  }
+
+  static bool isUnitMatrix ( mat44 & T )  {
+  int i,j;
+    for (i=0;i<4;i++)
+      for (j=0;j<4;j++)
+        if (i==j)  {
+          if (fabs(T[i][j]-1.0)>1.0e-6)  return false;
+        } else if (fabs(T[i][j])>1.0e-6)  return false;
+    return true;
+  }
+
+  int  VirtualAssembly::MakeBiomolecule ( PManager M, int bmNo,
+                                          int model_No,
+                                          bool renameCopies )  {
+  PBiomolecule BM;
+  PBMApply     BMA;
+  char         chID[sizeof(ChainID)+16];  // chain ID, '_' and a number
+  int          i,j,k,n,n0,k0;
+
+    FreeMemory();
+
+    if (!M)  return -1;
+    BM = M->GetBiomolecule ( bmNo );
+    if (!BM)  return -1;
+    if (!SetSource(M,model_No))  return -2;
+
+    n0 = 0;
+    for (i=0;(i<BM->nBMAs) && (n0>=0);i++)  {
+      BMA = BM->bmApply[i];
+      if (BMA)
+        for (j=0;(j<BMA->nMatrices) && (n0>=0);j++)  {
+          k0 = AddOperator ( BMA->tm[j] );
+          for (k=0;(k<BMA->nChains) && (n0>=0);k++)  {
+            n0 = -1;
+            for (n=0;(n<nSrc) && (n0<0);n++)
+              if (srcChain[n])  {
+                if (!strcmp(srcChain[n]->GetChainID(),BMA->chain[k]))
+                  n0 = n;
+              }
+            if (n0>=0)  {
+              if ((!renameCopies) || isUnitMatrix(op[k0]))
+                strcpy  ( chID,srcChain[n0]->GetChainID() );
+              else
+                sprintf ( chID,"%s_%i",srcChain[n0]->GetChainID(),
+                                       nUnits+1 );
+              AddUnit ( n0,k0,chID );
+            }
+          }
+        }
+    }
+
+    if (n0<0)  {
+      FreeMemory();
+      return -3;
+    }
+
+    FinishUnits();
+
+    return nUnits;
+
+  }
+
+  int  VirtualAssembly::MakeNCSMates ( PManager M, int model_No )  {
+  mat44   T;
+  char    chID[sizeof(ChainID)+16];  // chain ID, '_' and a number
+  ivector opk;
+  int     i,k,nNCSOps,iGiven;
+
+    if (!SetSource(M,model_No))  return -1;
+
+    //  operator 0 is identity for the original chains
+    Mat4Init ( T );
+    AddOperator ( T );
+
+    nNCSOps = M->GetNumberOfNCSMatrices();
+    GetVectorMemory ( opk,IMax(nNCSOps,1),0 );
+    for (k=0;k<nNCSOps;k++)  {
+      opk[k] = -1;
+      if (M->GetNCSMatrix(k,T,iGiven))  {
+        if (!iGiven)  opk[k] = AddOperator ( T );
+      }
+    }
+
+    for (i=0;i<nSrc;i++)
+      if (srcChain[i])
+        AddUnit ( i,0,srcChain[i]->GetChainID() );
+
+    //  same order of chains as in Root::GenerateNCSMates()
+    for (i=0;i<nSrc;i++)
+      if (srcChain[i])
+        for (k=0;k<nNCSOps;k++)
+          if (opk[k]>=0)  {
+            sprintf ( chID,"%s_%i",srcChain[i]->GetChainID(),k+1 );
+            AddUnit ( i,opk[k],chID );
+          }
+
+    FreeVectorMemory ( opk,0 );
+
+    FinishUnits();
+
+    return nUnits;
+
+  }
+
+
+  bool  VirtualAssembly::GetOperator ( int opNo, mat44 & T )  {
+  int i,j;
+    if ((opNo<0) || (opNo>=nOps))  return false;
+    for (i=0;i<4;i++)
+      for (j=0;j<4;j++)
+        T[i][j] = op[opNo][i][j];
+    return true;
+  }
+
+  PAssemblyUnit VirtualAssembly::GetUnit ( int unitNo )  {
+    if ((unitNo<0) || (unitNo>=nUnits))  return NULL;
+    return &(unit[unitNo]);
+  }
+
+  void  VirtualAssembly::GetUnitAtoms ( int unitNo, PPAtom & A,
+                                        int & nA )  {
+    if ((unitNo<0) || (unitNo>=nUnits))  {
+      A  = NULL;
+      nA = 0;
+    } else  {
+      A  = srcAtom[unit[unitNo].srcNo];
+      nA = unit[unitNo].nAtoms;
+    }
+  }
+
+  PAtom VirtualAssembly::GetAtom ( int atomNo, realtype & x,
+                                   realtype & y, realtype & z )  {
+  PAtom atm;
+  int   i1,i2,i;
+
+    if ((atomNo<0) || (atomNo>=nAtoms))  return NULL;
+
+    //  binary search for the unit containing the atom
+    i1 = 0;
+    i2 = nUnits-1;
+    while (i1<i2)  {
+      i = (i1+i2+1)/2;
+      if (unit[i].atom1<=atomNo)  i1 = i;
+                            else  i2 = i-1;
+    }
+
+    i   = atomNo - unit[i1].atom1;
+    atm = srcAtom[unit[i1].srcNo][i];
+    if (unit[i1].x)  {
+      x = unit[i1].x[i];
+      y = unit[i1].y[i];
+      z = unit[i1].z[i];
+    } else
+      atm->TransformCopy ( op[unit[i1].opNo],x,y,z );
+
+    return atm;
+
+  }
+
+  bool  VirtualAssembly::TransformUnit ( int unitNo, rvector x,
+                                         rvector y, rvector z )  {
+  PPAtom A;
+  int    i,n;
+    if ((unitNo<0) || (unitNo>=nUnits))  return false;
+    A = srcAtom[unit[unitNo].srcNo];
+    n = unit[unitNo].nAtoms;
+    if (unit[unitNo].x)
+      for (i=0;i<n;i++)  {
+        x[i] = unit[unitNo].x[i];
+        y[i] = unit[unitNo].y[i];
+        z[i] = unit[unitNo].z[i];
+      }
+    else  {
+      for (i=0;i<n;i++)  {
+        x[i] = A[i]->x;
+        y[i] = A[i]->y;
+        z[i] = A[i]->z;
+      }
+      Mat4Transform ( op[unit[unitNo].opNo],x,y,z,n );
+    }
+    return true;
+  }
+
+  void  VirtualAssembly::GetUnitCoordinates ( int unitNo,
+                                   rvector & x, rvector & y,
+                                   rvector & z, int & nA )  {
+  PAssemblyUnit U;
+
+    x  = NULL;
+    y  = NULL;
+    z  = NULL;
+    nA = 0;
+    if ((unitNo<0) || (unitNo>=nUnits))  return;
+
+    U  = &(unit[unitNo]);
+    nA = U->nAtoms;
+    if (nA<=0)  return;
+
+    if (U->x)  {
+      x = U->x;
+      y = U->y;
+      z = U->z;
+    } else  {
+      if (caching)  {
+        GetVectorMemory ( x,nA,0 );
+        GetVectorMemory ( y,nA,0 );
+        GetVectorMemory ( z,nA,0 );
+      } else  {
+        x = xs;
+        y = ys;
+        z = zs;
+      }
+      TransformUnit ( unitNo,x,y,z );
+      if (caching)  {
+        U->x = x;
+        U->y = y;
+        U->z = z;
+      }
+    }
+
+  }
+
+
+  static void GetStat ( realtype v, realtype & v_min, realtype & v_max,
+                        realtype & v_m, realtype & v_m2 )  {
+    if (v<v_min)  v_min = v;
+    if (v>v_max)  v_max = v;
+    v_m  += v;
+    v_m2 += v*v;
+  }
+
+  void  VirtualAssembly::GetAtomStatistics ( RAtomStat AS )  {
+  //   Coordinate statistics are accumulated here from transformed
+  // coordinates, the rest is left to Atom::CalAtomStatistics(..).
+  PPAtom  A;
+  rvector x,y,z;
+  int     i,j,n;
+
+    AS.Init();
+    AS.WhatIsSet &= ~ASET_Coordinates;
+
+    for (i=0;i<nUnits;i++)  {
+      GetUnitCoordinates ( i,x,y,z,n );
+      A = srcAtom[unit[i].srcNo];
+      for (j=0;j<n;j++)  {
+        A[j]->CalAtomStatistics ( AS );
+        GetStat ( x[j],AS.xmin,AS.xmax,AS.xm,AS.xm2 );
+        GetStat ( y[j],AS.ymin,AS.ymax,AS.ym,AS.ym2 );
+        GetStat ( z[j],AS.zmin,AS.zmax,AS.zm,AS.zm2 );
+      }
+    }
+
+    if (nAtoms>0)  AS.WhatIsSet |= ASET_Coordinates;
+    AS.Finish();
+
+  }
+
+
+  void  VirtualAssembly::SeekContacts ( realtype  dist1,
+                                        realtype  dist2,
+                                        RPContact contact,
+                                        int &     ncontacts,
+                                        bool      interUnit )  {
+  BrickGrid grid;
+  PContact  cont1;
+  rvector   ax,ay,az;
+  ivector   uno,hit;
+  realtype  dx,dy,dz;
+  int       i,j,k,n, nHits,nAlloc,nContAlloc;
+
+    contact   = NULL;
+    ncontacts = 0;
+    if ((nAtoms<=0) || (dist2<dist1))  return;
+
+    GetVectorMemory ( ax ,nAtoms,0 );
+    GetVectorMemory ( ay ,nAtoms,0 );
+    GetVectorMemory ( az ,nAtoms,0 );
+    GetVectorMemory ( uno,nAtoms,0 );
+    for (i=0;i<nUnits;i++)  {
+      n = unit[i].atom1;
+      TransformUnit ( i,&(ax[n]),&(ay[n]),&(az[n]) );
+      for (j=0;j<unit[i].nAtoms;j++)
+        uno[n+j] = i;
+    }
+
+    grid.MakeGrid ( ax,ay,az,nAtoms,dist2,IMax(1,int(dist2+0.5)) );
+
+    hit        = NULL;
+    nAlloc     = 0;
+    nContAlloc = 0;
+    for (i=0;i<nAtoms;i++)  {
+      nHits = grid.GetShellAtoms ( ax[i],ay[i],az[i],dist1,dist2,
+                                   hit,nAlloc );
+      for (k=0;k<nHits;k++)  {
+        j = hit[k];
+        if ((j>i) && ((!interUnit) || (uno[j]!=uno[i])))  {
+          if (ncontacts>=nContAlloc)  {
+            nContAlloc = ncontacts + IMax(ncontacts/2,100);
+            cont1 = new Contact[nContAlloc];
+            for (n=0;n<ncontacts;n++)
+              cont1[n].Copy ( contact[n] );
+            if (contact)  delete[] contact;
+            contact = cont1;
+          }
+          dx = ax[j]-ax[i];
+          dy = ay[j]-ay[i];
+          dz = az[j]-az[i];
+          contact[ncontacts].id1   = i;
+          contact[ncontacts].id2   = j;
+          contact[ncontacts].group = uno[i];
+          contact[ncontacts].dist  = sqrt(dx*dx+dy*dy+dz*dz);
+          ncontacts++;
+        }
+      }
+    }
+
+    FreeVectorMemory ( hit,0 );
+    FreeVectorMemory ( uno,0 );
+    FreeVectorMemory ( az ,0 );
+    FreeVectorMemory ( ay ,0 );
+    FreeVectorMemory ( ax ,0 );
+
+  }
+
+
+  PChain VirtualAssembly::MakeUnitChain ( int unitNo, int & serNum )  {
+  //   Makes a physical copy of unit unitNo and renumbers its atoms
+  // starting from serNum+1.
+  PChain   chain;
+  PResidue res;
+  PAtom    atm;
+  rvector  x,y,z;
+  int      i,j,k,n;
+
+    chain = new Chain();
+    chain->Copy ( srcChain[unit[unitNo].srcNo] );
+    chain->SetChainID ( unit[unitNo].chainID );
+
+    if (unit[unitNo].x)  GetUnitCoordinates ( unitNo,x,y,z,n );
+                   else  x = NULL;
+
+    k = 0;
+    for (i=0;i<chain->GetNumberOfResidues();i++)  {
+      res = chain->GetResidue ( i );
+      if (res)
+        for (j=0;j<res->GetNumberOfAtoms();j++)  {
+          atm = res->GetAtom ( j );
+          if (atm)  {
+            if ((!atm->Ter) &&
+                (atm->WhatIsSet & ASET_Coordinates))  {
+              //  atoms go in the same order as in srcAtom
+              if (x)  {
+                atm->x = x[k];
+                atm->y = y[k];
+                atm->z = z[k];
+              } else
+                atm->Transform ( op[unit[unitNo].opNo] );
+              k++;
+            }
+            atm->serNum = ++serNum;
+          }
+        }
+    }
+
+    return chain;
+
+  }
+
+  ERROR_CODE VirtualAssembly::WritePDBASCII ( cpstr PDBFileName,
+                                              io::GZ_MODE gzipMode )  {
+  io::File f;
+  PChain   chain;
+  int      i,serNum;
+
+    //  opening it in pseudo-text mode ensures that the line
+    //  endings will correspond to the system MMDB is running on
+    f.assign ( PDBFileName,true,false,gzipMode );
+
+    if (f.rewrite())  {
+      serNum = 0;
+      for (i=0;i<nUnits;i++)  {
+        chain = MakeUnitChain ( i,serNum );
+        chain->PDBASCIIAtomDump ( f );
+        delete chain;
+      }
+      f.WriteLine ( pstr("END") );
+      f.shut();
+    } else
+      return Error_CantOpenFile;
+
+    return Error_NoError;
+
+  }
+
+  ERROR_CODE VirtualAssembly::WriteCIFASCII ( cpstr CIFFileName,
+                                              io::GZ_MODE gzipMode )  {
+  mmcif::PData CIF;
+  Model        model;
+  int          i,serNum;
+  bool         done;
+
+    CIF = new mmcif::Data();
+    CIF->SetStopOnWarning ( true );
+    CIF->PutDataName ( "assembly" );
+
+    //  the model provides model number for the atom_site loop
+    model.SetMMDBManager ( NULL,1 );
+    serNum = 0;
+    for (i=0;i<nUnits;i++)  {
+      model.AddChain ( MakeUnitChain(i,serNum) );
+      model.MakeAtomCIF ( CIF );
+      model.DeleteAllChains();
+    }
+
+    CIF->Optimize();
+    done = CIF->WriteMMCIFData ( CIFFileName,gzipMode );
+    delete CIF;
+
+    if (!done)  return Error_CantOpenFile;
+    return Error_NoError;
+
+  }
+
+  PManager VirtualAssembly::MakeManager()  {
+  PManager M;
+  PModel   model;
+  int      i,serNum;
+
+    if (nUnits<=0)  return NULL;
+
+    model  = new Model();
+    serNum = 0;
+    for (i=0;i<nUnits;i++)
+      model->AddChain ( MakeUnitChain(i,serNum) );
+
+    M = new Manager();
+    M->AddModel  ( model );
+    M->PDBCleanup ( PDBCLEAN_SERIAL | PDBCLEAN_INDEX );
+
+    return M;
+
+  }
+
+}  // namespace mmdb
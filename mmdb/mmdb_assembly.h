@@ -0,0 +1,214 @@
+//  $Id: mmdb_assembly.h $
+//  =================================================================
+//
+//   CCP4 Coordinate Library: support of coordinate-related
+//   functionality in protein crystallography applications.
+//
+//   Copyright (C) The MMDB contributors 2026.
+//
+//    This library is free software: you can redistribute it and/or
+//    modify it under the terms of the GNU Lesser General Public
+//    License version 3, modified in accordance with the provisions
+//    of the license to address the requirements of UK law.
+//
+//    You should have received a copy of the modified GNU Lesser
+//    General Public License along with this library. If not, copies
+//    may be downloaded from http://www.ccp4.ac.uk/ccp4license.php
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//  =================================================================
+//
+//    18.10.26   <--  Date of Last Modification.
+//                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  -----------------------------------------------------------------
+//
+//  **** Module  :  mmdb_assembly <interface>
+//       ~~~~~~~~~
+//       Project :  MacroMolecular Data Base (MMDB)
+//       ~~~~~~~~~
+//  **** Classes :  mmdb::AssemblyUnit    ( chain copy in assembly   )
+//       ~~~~~~~~~  mmdb::VirtualAssembly ( lazy NCS/biomolecule view )
+//
+//  (C) The MMDB contributors 2026
+//
+//  =================================================================
+//
+
+#ifndef __MMDB_Assembly__
+#define __MMDB_Assembly__
+
+#include "mmdb_manager.h"
+
+namespace mmdb  {
+
+  // ======================  AssemblyUnit  ==========================
+
+  //   An assembly unit is a copy of a source chain placed by one
+  // of the assembly operators. Units do not hold atoms; they refer
+  // to the atoms of the source chain and, if caching is on, keep
+  // the transformed coordinates.
+
+  DefineStructure(AssemblyUnit);
+
+  struct AssemblyUnit  {
+    int      srcNo;    // source chain number in the model, 0...
+    int      opNo;     // operator number, 0...
+    ChainID  chainID;  // chain ID of the unit (truncated if long)
+    int      atom1;    // number of unit's first atom in assembly
+    int      nAtoms;   // number of atoms in the unit
+    rvector  x,y,z;    // cached coordinates, NULL if not cached
+  };
+
+
+  // ====================  VirtualAssembly  =========================
+
+  //   VirtualAssembly represents a biological assembly or a set of
+  // NCS mates without copying the chains. It keeps pointers to the
+  // chains of the original (asymmetric unit) model together with
+  // the list of operators, and applies the operators on the fly
+  // whenever coordinates are requested.
+  //   Assembly atoms are numbered 0...GetNumberOfAtoms()-1, unit
+  // by unit. Ter atoms and atoms without coordinates are not
+  // included.
+  //   The assembly refers to the atoms of the source Manager,
+  // which must not be edited or deleted while the assembly is in
+  // use. All methods, except TransformUnit(..), GetAtom(..) and
+  // Get..(..) functions with unit and operator numbers, may use
+  // internal scratch space and should not be called concurrently.
+
+  DefineClass(VirtualAssembly);
+
+  class VirtualAssembly  {
+
+    public :
+
+      VirtualAssembly ();
+      ~VirtualAssembly();
+
+      void  FreeMemory();
+
+      //   MakeBiomolecule(..) sets up the assembly from biomolecule
+      // bmNo (0,1,...) described in REMARK 350 of Manager M, for
+      // model modelNo (1,2,...). Returns the number of units, or
+      // a negative number if the biomolecule is not found or refers
+      // to a chain absent in the model; the assembly is then empty.
+      //   By default, all units keep the chain IDs of their source
+      // chains, as in Manager::MakeBiomolecule(..). If renameCopies
+      // is true, units made by non-identity operators are named
+      // 'x_n' instead, where 'x' is the source chain ID and 'n' is
+      // the unit number (1,2,...); such IDs do not fit the PDB chain
+      // ID column, so use them only with WriteCIFASCII(..).
+      int   MakeBiomolecule ( PManager M, int bmNo, int modelNo=1,
+                              bool renameCopies=false );
+
+      //   MakeNCSMates(..) sets up the assembly from the source
+      // chains and their NCS mates generated by NCS matrices which
+      // are not given in the file (iGiven==0), as in
+      // Root::GenerateNCSMates(). NCS mates are named 'x_n' where
+      // 'n' is the NCS matrix number (1,2,...). Returns the number
+      // of units, or a negative number if model modelNo is empty.
+      int   MakeNCSMates ( PManager M, int modelNo=1 );
+
+      //   With caching on, transformed coordinates are calculated
+      // once per unit and kept until caching is switched off or the
+      // assembly is freed. With caching off (default), coordinates
+      // are calculated on each request.
+      void  SetCaching  ( bool on );
+      bool  isCaching   ()  { return caching; }
+
+      int   GetNofOperators  ()  { return nOps;   }
+      bool  GetOperator      ( int opNo, mat44 & T );
+      int   GetNofUnits      ()  { return nUnits; }
+      PAssemblyUnit GetUnit  ( int unitNo );
+      int   GetNumberOfAtoms ()  { return nAtoms; }
+
+      //   GetUnitAtoms(..) returns the source atoms of unit unitNo.
+      // The table belongs to the assembly and must not be disposed.
+      void  GetUnitAtoms ( int unitNo, PPAtom & A, int & nA );
+
+      //   GetAtom(..) returns the source atom of assembly atom atomNo
+      // and its coordinates in the assembly, or NULL if atomNo is
+      // out of range.
+      PAtom GetAtom ( int atomNo, realtype & x, realtype & y,
+                                  realtype & z );
+
+      //   TransformUnit(..) calculates coordinates of unit unitNo's
+      // atoms into caller's vectors x,y,z, which should be at least
+      // GetUnit(unitNo)->nAtoms long. It does not use any scratch
+      // space and may be called concurrently for any units.
+      bool  TransformUnit ( int unitNo, rvector x, rvector y,
+                                        rvector z );
+
+      //   GetUnitCoordinates(..) returns coordinates of unit unitNo
+      // either from the cache or calculated into assembly's scratch
+      // vectors, which are valid until the next call. The vectors
+      // must not be disposed.
+      void  GetUnitCoordinates ( int unitNo, rvector & x, rvector & y,
+                                 rvector & z, int & nA );
+
+      //   GetAtomStatistics(..) is analogous to
+      // CoorManager::GetAtomStatistics(..) for the whole assembly.
+      // Anisotropic temperature factors are taken as they are in
+      // the source atoms, same as in Manager::MakeBiomolecule(..).
+      void  GetAtomStatistics ( RAtomStat AS );
+
+      //   SeekContacts(..) finds all pairs of assembly atoms at
+      // distances dist1<=d<=dist2. Contacts are returned with
+      // id1<id2 being assembly atom numbers and group set to the
+      // number of id1's unit; if interUnit is true, only contacts
+      // between different units are found. The contact vector is
+      // allocated (and should be disposed) by the caller as
+      // 'delete[] contact'.
+      void  SeekContacts ( realtype  dist1, realtype dist2,
+                           RPContact contact, int & ncontacts,
+                           bool      interUnit=true );
+
+      //   Write..ASCII(..) export the assembly atoms as if they were
+      // generated by Manager::MakeBiomolecule(..) or
+      // Root::GenerateNCSMates(); only one unit is expanded in
+      // memory at a time. Atom serial numbers run through the
+      // whole assembly.
+      ERROR_CODE WritePDBASCII ( cpstr PDBFileName,
+                                 io::GZ_MODE gzipMode=io::GZM_CHECK );
+      ERROR_CODE WriteCIFASCII ( cpstr CIFFileName,
+                                 io::GZ_MODE gzipMode=io::GZM_CHECK );
+
+      //   MakeManager() returns a Manager with the assembly fully
+      // expanded in a single model, or NULL if the assembly is
+      // empty. The Manager should be disposed by the caller.
+      PManager MakeManager();
+
+    protected :
+      PManager      manager;   // source manager (not owned)
+      int           modelNo;   // source model number
+      PPChain       srcChain;  // source chains (not owned)
+      PPAtom *      srcAtom;   // atoms of source chains
+      ivector       srcLen;    // numbers of atoms in source chains
+      int           nSrc;      // number of source chains
+      pmat44        op;        // operators
+      int           nOps;      // number of operators
+      PAssemblyUnit unit;      // assembly units
+      int           nUnits;    // number of units
+      int           nUAlloc;   // length of unit vector
+      int           nAtoms;    // total number of atoms
+      bool          caching;   // caching flag
+      rvector       xs,ys,zs;  // scratch vectors
+      int           nScratch;  // length of scratch vectors
+
+      void  InitVirtualAssembly();
+      void  FreeCache     ();
+      bool  SetSource     ( PManager M, int model_No );
+      int   AddOperator   ( mat44 & T );
+      void  AddUnit       ( int src_No, int op_No, cpstr chID );
+      void  FinishUnits   ();
+      PChain MakeUnitChain( int unitNo, int & serNum );
+
+  };
+
+}  // namespace mmdb
+
+#endif
@@ -139,6 +139,7 @@ namespace mmdb  {
     WhatIsSet  = 0x00000000; // nothing is set
     nBonds     = 0;          // no bonds
     Bond       = NULL;       // empty array of bonds
+    FindElementNo();         // cached element number
   }
 
   void  Atom::FreeMemory()  {
@@ -715,6 +716,7 @@ namespace mmdb  {
       strcpy ( &(element[1]),eName );
     } else
       strcpy   ( element,eName );
+    FindElementNo();
     WhatIsSet = 0;
   }
 
@@ -1132,6 +1134,31 @@ namespace mmdb  {
     return  mmdb::isMetal ( element );
   }
 
+  bool Atom::isHydrogen()  {
+    return  mmdb::isHydrogen ( element );
+  }
+
+  bool Atom::isAltLocMatch ( PAtom a )  {
+    return (!altLoc[0]) || (!a->altLoc[0]) ||
+           (!strcmp(altLoc,a->altLoc));
+  }
+
+  int  Atom::GetElementNo()  {
+  //  The element number is found when the element name is set, so
+  //  that this function only reads the atom. If the element name
+  //  was changed directly since then, the number is looked up
+  //  without caching.
+    if ((elKey[0]==element[0]) && (elKey[1]==element[1]))
+      return elementNo;
+    return getElementNo ( element );
+  }
+
+  void  Atom::FindElementNo()  {
+    elementNo = getElementNo ( element );
+    elKey[0]  = element[0];
+    elKey[1]  = element[1];
+  }
+
   bool Atom::isSolvent()  {
     if (residue)  return  residue->isSolvent();
     return false;
@@ -1268,6 +1295,7 @@ namespace mmdb  {
       element[1] = element[0];
       element[0] = ' ';
     }
+    FindElementNo();
   }
 
   void  Atom::SetCharge ( cpstr chrg )  {
@@ -1447,7 +1475,10 @@ namespace mmdb  {
 
     if (ignoreElement)  {
       if (element[0])  strcpy ( elmnt,element );
-                 else  strcpy ( element,elmnt );
+      else  {
+        strcpy ( element,elmnt );
+        FindElementNo();
+      }
     }
 
     if (ignoreUnmatch)  return Error_NoError;
@@ -1654,6 +1685,7 @@ namespace mmdb  {
     if (Ter)  {
       name[0]    = char(0);
       element[0] = char(0);
+      FindElementNo();
       return false;
     }
     if ((!element[0]) ||
@@ -1671,14 +1703,17 @@ namespace mmdb  {
         element[1] = name[0];
       }
       element[2] = char(0);
+      FindElementNo();
       return false;
     } else if (!element[1])  {
       // not aligned element name, possibly coming from mmCIF
       element[1] = element[0];
       element[0] = ' ';
       element[2] = char(0);
+      FindElementNo();
       return false;
     }
+    FindElementNo();
     return true;
   }
 
@@ -1688,6 +1723,7 @@ namespace mmdb  {
     if (Ter)  {
       name   [0] = char(0);
       element[0] = char(0);
+      FindElementNo();
       return false;
     }
     UpperCase ( name    );
@@ -1720,6 +1756,7 @@ namespace mmdb  {
         element[1] = name[1];
       }
       element[2] = char(0);
+      FindElementNo();
       return false;
     } else if ((name[0]>='A') && (name[0]<='Z'))  {
       if (!element[1])  {
@@ -1752,6 +1789,7 @@ namespace mmdb  {
         name[k] = char(0);
       }
     }
+    FindElementNo();
     return true;
   }
 
@@ -1887,6 +1925,7 @@ namespace mmdb  {
     strcpy ( element      ,atom->element       );
     strcpy ( energyType   ,atom->energyType    );
     charge = atom->charge;
+    FindElementNo();
 
   }
 
@@ -2061,6 +2100,7 @@ namespace mmdb  {
       segID  [0] = char(0);
       charge     = 0.0;
       WhatIsSet &= ASET_All;
+      FindElementNo();
       return;
     }
 
@@ -2076,6 +2116,7 @@ namespace mmdb  {
     f.ReadTerLine ( altLoc    ,false );
     f.ReadTerLine ( segID     ,false );
     f.ReadTerLine ( element   ,false );
+    FindElementNo();
     f.ReadTerLine ( energyType,false );
     f.ReadFloat   ( &charge );
     f.ReadBool    ( &Het    );
@@ -2272,6 +2313,7 @@ namespace mmdb  {
     seqNum = sqNum;
     strcpy_css ( name,pstr(resName) );
     strcpy_css ( insCode,pstr(ins) );
+    FindResClass();
     if (Chain_Owner)
       Chain_Owner->AddResidue ( this );
   }
@@ -2300,7 +2342,16 @@ namespace mmdb  {
     AtmLen  = 0;                      // length of atom array
     atom    = NULL;                   // array of atoms
     Exclude = true;
+    edited  = true;
     SSE     = SSE_None;
+    FindResClass();                   // cached residue class
+  }
+
+  void  Residue::SetEdited()  {
+  //  marks the residue and its chain for re-indexing in
+  //  Root::FinishStructEdit()
+    edited = true;
+    if (chain)  chain->edited = true;
   }
 
   void  Residue::SetChain ( PChain Chain_Owner )  {
@@ -2476,6 +2527,7 @@ namespace mmdb  {
     seqNum = sqNum;
     strcpy_css ( insCode,pstr(ins) );
     strcpy (label_comp_id,name );
+    FindResClass();
   }
 
   void  Residue::FreeMemory()  {
@@ -2510,6 +2562,7 @@ namespace mmdb  {
     atom[nAtoms] = atm;
     atom[nAtoms]->residue = this;
     nAtoms++;
+    SetEdited();
     return 0;
   }
 
@@ -2541,6 +2594,7 @@ namespace mmdb  {
         for (i=0;i<res->nAtoms;i++)
           if (res->atom[i]==atm)  {
             res->atom[i] = NULL;
+            res->SetEdited();
             break;
           }
       atom[nAtoms] = atm;
@@ -2552,6 +2606,7 @@ namespace mmdb  {
       manager->CheckInAtom ( 0,atom[nAtoms] );
 
     nAtoms++;
+    SetEdited();
 
     return nAtoms;
 
@@ -2590,6 +2645,7 @@ namespace mmdb  {
         for (i=0;i<res->nAtoms;i++)
           if (res->atom[i]==atm)  {
             res->atom[i] = NULL;
+            res->SetEdited();
             break;
           }
       atom[pos] = atm;
@@ -2601,6 +2657,7 @@ namespace mmdb  {
       manager->CheckInAtom ( 0,atom[pos] );
 
     nAtoms++;
+    SetEdited();
 
     return nAtoms;
 
@@ -2648,6 +2705,7 @@ namespace mmdb  {
       for (i=k+1;i<nAtoms;i++)
         atom[i-1] = atom[i];
       nAtoms--;
+      SetEdited();
     }
 
     if (nAtoms<=0)  return 1;
@@ -2695,6 +2753,7 @@ namespace mmdb  {
     strcpy ( label_comp_id,res->label_comp_id );
     strcpy ( label_asym_id,res->label_asym_id );
     strcpy ( insCode      ,res->insCode       );
+    FindResClass();
 
     if (AtmLen>0)  {
       atom   = new PAtom[AtmLen];
@@ -2739,6 +2798,7 @@ namespace mmdb  {
     strcpy ( label_comp_id,res->label_comp_id );
     strcpy ( label_asym_id,res->label_asym_id );
     strcpy ( insCode      ,res->insCode       );
+    FindResClass();
 
     AtmLen = nAtoms;
     A      = NULL;
@@ -2782,6 +2842,7 @@ namespace mmdb  {
     strcpy ( label_comp_id,res->label_comp_id );
     strcpy ( label_asym_id,res->label_asym_id );
     strcpy ( insCode      ,res->insCode       );
+    FindResClass();
 
     AtmLen = nAtoms;
     if (AtmLen>0)  {
@@ -2866,6 +2927,7 @@ namespace mmdb  {
 
   void  Residue::SetResName ( const ResName resName )  {
     strcpy ( name,resName );
+    FindResClass();
   }
 
   int   Residue::GetSeqNum()  {
@@ -2884,16 +2946,37 @@ namespace mmdb  {
     return insCode;
   }
 
+  int  Residue::GetResidueClass()  {
+  //  The residue class is found when the residue name is set, so
+  //  that this function only reads the residue. If the name was
+  //  changed directly since then, the class is looked up without
+  //  caching.
+    if ((resKey[0]==name[0]) && (resKey[1]==name[1]) &&
+        (resKey[2]==name[2]) && (resKey[3]==name[3]))
+      return resClass;
+    return getResidueClass ( name );
+  }
+
+  void  Residue::FindResClass()  {
+  //  Residue classes depend only on the first 3 characters of the
+  //  name and on whether the name is longer than that.
+    resKey[0] = name[0];
+    resKey[1] = name[1];
+    resKey[2] = name[2];
+    resKey[3] = name[3];
+    resClass  = getResidueClass ( name );
+  }
+
   bool Residue::isAminoacid ()  {
-    return mmdb::isAminoacid ( name );
+    return (GetResidueClass() & RESCLASS_Aminoacid)!=0;
   }
 
   bool Residue::isNucleotide()  {
-    return mmdb::isNucleotide ( name );
+    return (GetResidueClass() & RESCLASS_Nucleotide)!=0;
   }
 
   int Residue::isDNARNA()  {
-    return mmdb::isDNARNA ( name );
+    return resClassDNARNA ( GetResidueClass() );
   }
 
   bool Residue::isSugar()  {
@@ -2901,7 +2984,7 @@ namespace mmdb  {
   }
 
   bool Residue::isSolvent()  {
-    return mmdb::isSolvent ( name );
+    return (GetResidueClass() & RESCLASS_Solvent)!=0;
   }
 
   bool Residue::isModRes()  {
@@ -3138,6 +3221,8 @@ namespace mmdb  {
         }
       }
 
+    if (k>0)  SetEdited();
+
     return k;
 
   }
@@ -3164,6 +3249,7 @@ namespace mmdb  {
         delete atom[atomNo];
         atom[atomNo] = NULL;
         Exclude = true;
+        SetEdited();
         return 1;
       }
     }
@@ -3200,6 +3286,7 @@ namespace mmdb  {
     nAtoms  = 0;
 
     Exclude = true;
+    SetEdited();
 
     return k;
 
@@ -3282,6 +3369,7 @@ namespace mmdb  {
       }
 
     Exclude = true;
+    if (n>0)  SetEdited();
 
     return n;
 
@@ -3289,12 +3377,7 @@ namespace mmdb  {
 
   void  Residue::ApplyTransform ( mat44 & TMatrix )  {
   // transforms all coordinates by multiplying with matrix TMatrix
-  int i;
-    for (i=0;i<nAtoms;i++)
-      if (atom[i])  {
-        if (!atom[i]->Ter)
-          atom[i]->Transform ( TMatrix );
-      }
+    TransformAtoms ( atom,nAtoms,TMatrix );
   }
 
 
@@ -3366,19 +3449,22 @@ namespace mmdb  {
   bool Residue::isMainchainHBond ( PResidue res ) {
   //  Test if there is main chain Hbond between PCRes1 (donor) and
   //  PCRes2 (acceptor).
+    return isMainchainHBond ( GetAtom("N"),res->GetAtom("O"),
+                              res->GetAtom("C") );
+  }
+
+  bool Residue::isMainchainHBond ( PAtom NAtom, PAtom OAtom,
+                                   PAtom CAtom )  {
+  //  Test if there is main chain Hbond between donor NAtom and
+  //  acceptor OAtom, CAtom being the acceptor's carbonyl carbon.
   //  As defined Kabsch & Sanders
   //  This probably needs the option of supporting alternative criteria
-  PAtom   NAtom,OAtom,Atom;
   realtype abx,aby,abz;
   realtype acx,acy,acz;
   realtype bcx,bcy,bcz;
   realtype absq,acsq,bcsq;
 
-    NAtom = GetAtom      ( "N" );
-    OAtom = res->GetAtom ( "O" );
-    Atom = res->GetAtom ( "C" );
-
-    if (NAtom && OAtom && Atom)  {
+    if (NAtom && OAtom && CAtom)  {
 
       abx = OAtom->x - NAtom->x;
       aby = OAtom->y - NAtom->y;
@@ -3388,13 +3474,13 @@ namespace mmdb  {
 
       if (absq<=NOmaxdist2)  {
 
-        acx = NAtom->x - Atom->x;
-        acy = NAtom->y - Atom->y;
-        acz = NAtom->z - Atom->z;
+        acx = NAtom->x - CAtom->x;
+        acy = NAtom->y - CAtom->y;
+        acz = NAtom->z - CAtom->z;
 
-        bcx = Atom->x - OAtom->x;
-        bcy = Atom->y - OAtom->y;
-        bcz = Atom->z - OAtom->z;
+        bcx = CAtom->x - OAtom->x;
+        bcy = CAtom->y - OAtom->y;
+        bcz = CAtom->z - OAtom->z;
 
         acsq = acx*acx + acy*acy + acz*acz;
         bcsq = bcx*bcx + bcy*bcy + bcz*bcz;
@@ -3453,6 +3539,7 @@ namespace mmdb  {
     f.ReadInt     ( &nAtoms  );
     f.ReadByte    ( &SSE     );
     f.ReadTerLine ( name,false );
+    FindResClass();
     if (Version>1)  {
       f.ReadTerLine ( label_comp_id,false );
       f.ReadTerLine ( label_asym_id,false );
@@ -3483,4 +3570,38 @@ namespace mmdb  {
 
   MakeFactoryFunctions(Residue)
 
+
+  //  -----------------------------------------------------------------
+
+  #define  TransformBlock  256
+
+  void  TransformAtoms ( PPAtom A, int nA, mat44 & TMatrix )  {
+  realtype xb[TransformBlock],yb[TransformBlock],zb[TransformBlock];
+  PAtom    ab[TransformBlock];
+  int      i,j,n;
+    n = 0;
+    for (i=0;i<=nA;i++)  {
+      if (i<nA)  {
+        if (A[i])  {
+          if (!A[i]->Ter)  {
+            ab[n] = A[i];
+            xb[n] = A[i]->x;
+            yb[n] = A[i]->y;
+            zb[n] = A[i]->z;
+            n++;
+          }
+        }
+      }
+      if ((n>=TransformBlock) || ((i>=nA) && (n>0)))  {
+        Mat4Transform ( TMatrix,xb,yb,zb,n );
+        for (j=0;j<n;j++)  {
+          ab[j]->x = xb[j];
+          ab[j]->y = yb[j];
+          ab[j]->z = zb[j];
+        }
+        n = 0;
+      }
+    }
+  }
+
 }  // namespace mmdb
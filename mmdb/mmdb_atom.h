@@ -33,7 +33,7 @@
 //  **** Classes :  mmdb::Atom     ( atom class    )
 //       ~~~~~~~~~  mmdb::Residue  ( residue class )
 //  **** Functions: mmdb::BondAngle
-//       ~~~~~~~~~~
+//       ~~~~~~~~~~  mmdb::TransformAtoms
 //
 //  Copyright (C) E. Krissinel 2000-2013
 //
@@ -295,13 +295,25 @@ namespace mmdb  {
       void  GetChainCalphas ( PPAtom & Calphas, int & nCalphas,
                               cpstr altLoc = "" );
 
+      //   GetElementNo() returns getElementNo(element) (see
+      // mmdb_tables.h), which is cached in the atom when the element
+      // name is set. The function does not change the atom and may
+      // be called concurrently.
+      int  GetElementNo  ();
+
       bool isTer         () { return Ter; }
       bool isMetal       ();
+      bool isHydrogen    ();  // element is "H" or "D"
       bool isSolvent     ();  // works only for atom in a residue!
       bool isInSelection ( int selHnd );
       bool isNTerminus   ();
       bool isCTerminus   ();
 
+      //   isAltLocMatch(..) returns true if the atom and atom a may
+      // be present in one conformer: either has no alternative
+      // location indicator, or both have the same one.
+      bool isAltLocMatch ( PAtom a );
+
       void  CalAtomStatistics ( RAtomStat AS );
 
       realtype GetDist2 ( PAtom a );
@@ -421,10 +433,16 @@ namespace mmdb  {
       void  read  ( io::RFile f );
 
     protected :
-      int       index;   // index in the file
-      int       nBonds;  // number of bonds in the lowest byte (!)
-      PAtomBond Bond;    // atom bonds
-
+      int       index;     // index in the file
+      int       nBonds;    // number of bonds in the lowest byte (!)
+      PAtomBond Bond;      // atom bonds
+      int       elementNo; // cached element number
+      char      elKey[2];  // element name of the cached number
+
+      //   FindElementNo() caches the number of the element; it is
+      // called whenever the element name is set, so that
+      // GetElementNo() does not write to the atom.
+      void  FindElementNo  ();
       void  InitAtom       ();
       void  FreeMemory     ();
       void  StandardPDBOut ( cpstr Record, pstr S );
@@ -554,6 +572,13 @@ namespace mmdb  {
                                 rvector & occupancy, int & alflag );
       int   GetNofAltLocations();
 
+      //   GetResidueClass() returns getResidueClass(name) (see
+      // mmdb_tables.h), which is cached in the residue when the name
+      // is set; isXXXX() functions below use the cached class. These
+      // functions do not change the residue and may be called
+      // concurrently.
+      int  GetResidueClass();
+
       bool isAminoacid   ();
       bool isNucleotide  ();
       int  isDNARNA      (); // 0(neither),1(DNA),2(RNA)
@@ -700,6 +725,11 @@ namespace mmdb  {
 
 
       bool isMainchainHBond ( PResidue res );
+      //   This isMainchainHBond(..) checks the H-bond between donor
+      // NAtom and acceptor OAtom with carbonyl carbon CAtom; any of
+      // the atoms may be NULL, in which case false is returned.
+      static bool isMainchainHBond ( PAtom NAtom, PAtom OAtom,
+                                     PAtom CAtom );
 
       void  Copy  ( PResidue res );
 
@@ -710,8 +740,16 @@ namespace mmdb  {
 
       int   AtmLen;   // length of atom array
       bool  Exclude;  // used internally
-
+      bool  edited;   // atom table changed since FinishStructEdit()
+      char  resKey[4]; // residue name of the cached class
+      int   resClass;  // cached residue class
+
+      //   FindResClass() caches the residue class; it is called
+      // whenever the residue name is set, so that GetResidueClass()
+      // does not write to the residue.
+      void  FindResClass ();
       void  InitResidue  ();
+      void  SetEdited    ();
       void  FreeMemory   ();
       int   _AddAtom     ( PAtom atm );
       int   _ExcludeAtom ( int  kndex );  // 1: residue gets empty,
@@ -726,6 +764,12 @@ namespace mmdb  {
 
   extern realtype  BondAngle ( PAtom A, PAtom B, PAtom C );
 
+  //   TransformAtoms(..) transforms coordinates of atoms A[0..nA-1]
+  // by matrix TMatrix, skipping NULL and Ter atoms. Coordinates are
+  // gathered into blocks and transformed with Mat4Transform(..);
+  // the results are identical to those of Atom::Transform(..).
+  extern void  TransformAtoms ( PPAtom A, int nA, mat44 & TMatrix );
+
 }  // namespace mmdb
 
 #endif
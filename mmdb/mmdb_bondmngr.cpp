@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    15.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -43,6 +43,7 @@
 
 #include "mmdb_bondmngr.h"
 #include "mmdb_math_graph.h"
+#include "mmdb_tables.h"
 
 namespace mmdb  {
 
@@ -59,13 +60,13 @@ namespace mmdb  {
 
   void  BondManager::MakeBonds ( bool calc_only )  {
   UNUSED_ARGUMENT(calc_only);
-  PModel         mdl;
-  PChain         chain;
-  PResidue       res;
-  math::Graph    graph;
-  math::PPVertex V;
-  math::PPEdge   E;
-  int            i, im,ic,ir, nV,nE, k1,k2;
+  PModel               mdl;
+  PChain               chain;
+  PResidue             res;
+  math::Graph          graph;
+  math::PPVertex       V;
+  math::PPEdge         E;
+  int                  i, im,ic,ir, nV,nE, k1,k2;
 
     RemoveBonds();
 
@@ -78,12 +79,13 @@ namespace mmdb  {
             for (ir=0;ir<chain->nResidues;ir++)  {
               res = chain->residue[ir];
               if (res)  {
-                graph.MakeGraph   ( res,NULL );
+                graph.MakeGraph   ( res,NULL,&bondTemplates );
                 graph.GetVertices ( V,nV );
                 graph.GetEdges    ( E,nE );
                 for (i=0;i<nE;i++)  {
-                  k1 = V[E[i]->GetVertex1()]->GetUserID();
-                  k2 = V[E[i]->GetVertex2()]->GetUserID();
+                  //  edges refer to vertices as 1,2,...
+                  k1 = V[E[i]->GetVertex1()-1]->GetUserID();
+                  k2 = V[E[i]->GetVertex2()-1]->GetUserID();
                   res->atom[k1]->AddBond ( res->atom[k2],E[i]->GetType() );
                   res->atom[k2]->AddBond ( res->atom[k1],E[i]->GetType() );
                 }
@@ -92,6 +94,231 @@ namespace mmdb  {
         }
     }
 
+    MakeInterResidueBonds ( 0 );
+
+  }
+
+  static bool isLigand ( PResidue res )  {
+    return (!res->isAminoacid()) && (!res->isNucleotide()) &&
+           (!res->isSolvent());
+  }
+
+  static bool isDisulfideAtom ( PAtom A )  {
+    return (!strcmp(A->residue->name,"CYS")) &&
+           A->CheckID("SG",NULL,NULL);
+  }
+
+  static bool isBondable ( PAtom A )  {
+    return A && (!A->Ter) && (A->WhatIsSet & ASET_Coordinates);
+  }
+
+  static void AddBondPair ( PAtom A1, PAtom A2 )  {
+    A1->AddBond ( A2,math::BOND_SINGLE );
+    A2->AddBond ( A1,math::BOND_SINGLE );
+  }
+
+  static bool inBondDistance ( PAtom A1, PAtom A2, realtype r )  {
+  // r is the sum of covalent radii of atoms A1 and A2
+  realtype dx,dy,dz,d2;
+    dx = A1->x - A2->x;
+    dy = A1->y - A2->y;
+    dz = A1->z - A2->z;
+    d2 = dx*dx + dy*dy + dz*dz;
+    r += BondTolerance;
+    return (d2<=r*r) && (d2>=BondTolerance*BondTolerance);
+  }
+
+  void  BondManager::MakeInterResidueBonds ( int modelNo )  {
+  PModel mdl;
+  int    im,ic;
+    for (im=0;im<nModels;im++)
+      if ((modelNo<=0) || (im==modelNo-1))  {
+        mdl = model[im];
+        if (mdl)  {
+          for (ic=0;ic<mdl->nChains;ic++)
+            if (mdl->chain[ic])
+              MakeChainBonds ( mdl->chain[ic] );
+          MakeSpatialBonds ( mdl );
+          MakeLinkBonds    ( mdl );
+        }
+      }
+  }
+
+  void  BondManager::MakeChainBonds ( PChain chain )  {
+  //  Makes peptide and phosphodiester bonds between adjacent
+  //  residues of the chain
+  PResidue res1,res2;
+  PAtom    A1,A2;
+  cpstr    name1,name2,name1a;
+  int      ir,i,j;
+
+    for (ir=1;ir<chain->nResidues;ir++)  {
+      res1 = chain->residue[ir-1];
+      res2 = chain->residue[ir];
+      if ((!res1) || (!res2))  continue;
+      if (res1->isAminoacid() && res2->isAminoacid())  {
+        name1  = "C";
+        name1a = NULL;
+        name2  = "N";
+      } else if (res1->isNucleotide() && res2->isNucleotide())  {
+        name1  = "O3'";
+        name1a = "O3*";
+        name2  = "P";
+      } else
+        continue;
+      for (i=0;i<res1->nAtoms;i++)  {
+        A1 = res1->atom[i];
+        if (isBondable(A1) &&
+            (A1->CheckID(name1,NULL,NULL) ||
+             (name1a && A1->CheckID(name1a,NULL,NULL))))
+          for (j=0;j<res2->nAtoms;j++)  {
+            A2 = res2->atom[j];
+            if (isBondable(A2) && A2->CheckID(name2,NULL,NULL) &&
+                A1->isAltLocMatch(A2) &&
+                inBondDistance(A1,A2,getCovalentRadius(A1->GetElementNo()) +
+                                     getCovalentRadius(A2->GetElementNo())))
+              AddBondPair ( A1,A2 );
+          }
+      }
+    }
+
+  }
+
+  void  BondManager::MakeSpatialBonds ( PModel mdl )  {
+  //  Makes disulfide bonds and bonds to ligand residues, using
+  //  a brick grid over all heavy non-solvent atoms of the model
+  BrickGrid grid;
+  PChain    chain;
+  PResidue  res;
+  PPAtom    A;
+  PAtom     A1,A2;
+  rvector   covR;
+  ivector   kind;
+  ivector   hit;
+  realtype  rmax;
+  int       resKind;
+  int       nA,nAlloc,nHits,ic,ir,i,j,k;
+
+    nA = 0;
+    for (ic=0;ic<mdl->nChains;ic++)  {
+      chain = mdl->chain[ic];
+      if (chain)
+        for (ir=0;ir<chain->nResidues;ir++)
+          if (chain->residue[ir])
+            nA += chain->residue[ir]->nAtoms;
+    }
+    if (nA<=0)  return;
+
+    A     = new PAtom[nA];
+    covR = NULL;
+    kind = NULL;
+    GetVectorMemory ( covR,nA,0 );
+    GetVectorMemory ( kind,nA,0 );
+
+    //  collect atoms and find which of them should be looked up:
+    //  kind is 2 for ligand atoms, 1 for cystein SG and 0 otherwise
+    nA   = 0;
+    rmax = 0.0;
+    for (ic=0;ic<mdl->nChains;ic++)  {
+      chain = mdl->chain[ic];
+      if (chain)
+        for (ir=0;ir<chain->nResidues;ir++)  {
+          res = chain->residue[ir];
+          if (res && (!res->isSolvent()))  {
+            if (isLigand(res))  resKind = 2;
+                          else  resKind = 0;
+            for (i=0;i<res->nAtoms;i++)  {
+              A1 = res->atom[i];
+              if (isBondable(A1) && (!A1->isHydrogen()))  {
+                A    [nA] = A1;
+                covR [nA] = getCovalentRadius ( A1->GetElementNo() );
+                kind [nA] = resKind;
+                if ((!resKind) && isDisulfideAtom(A1))  kind[nA] = 1;
+                if (covR[nA]>rmax)  rmax = covR[nA];
+                nA++;
+              }
+            }
+          }
+        }
+    }
+
+    hit    = NULL;
+    nAlloc = 0;
+    if (nA>1)  {
+      grid.MakeGrid ( A,nA,0.0,RMax(2.0*rmax+BondTolerance,2.0) );
+      for (i=0;i<nA;i++)
+        if (kind[i])  {
+          A1    = A[i];
+          nHits = grid.GetSphereAtoms ( A1->x,A1->y,A1->z,
+                                        covR[i]+rmax+BondTolerance,
+                                        hit,nAlloc );
+          for (k=0;k<nHits;k++)  {
+            j  = hit[k];
+            A2 = A[j];
+            //  pairs of two query atoms are looked at only once
+            if ((A2->residue==A1->residue) || (kind[j] && (j<i)))
+              continue;
+            //  ligand atoms bond to any atom, cystein SG only to
+            //  other SG and ligand atoms
+            if ((kind[i]==1) && (!kind[j]))  continue;
+            if (A1->isAltLocMatch(A2) &&
+                inBondDistance(A1,A2,covR[i]+covR[j]))
+              AddBondPair ( A1,A2 );
+          }
+        }
+    }
+
+    FreeVectorMemory ( hit  ,0 );
+    FreeVectorMemory ( kind,0 );
+    FreeVectorMemory ( covR,0 );
+    delete[] A;
+
+  }
+
+  static PAtom GetLinkAtom ( PModel mdl, const ChainID chID, int seqNum,
+                             const InsCode insCode,
+                             const AtomName aname, const AltLoc aloc ) {
+  //  An empty or blank altLoc in a link record stands for any
+  //  location of the atom
+  pstr p;
+    p = pstr(aloc);
+    while (*p==' ')  p++;
+    if (*p)  return mdl->GetAtom ( chID,seqNum,insCode,aname,NULL,aloc );
+    return mdl->GetAtom ( chID,seqNum,insCode,aname,NULL,NULL );
+  }
+
+  void  BondManager::MakeLinkBonds ( PModel mdl )  {
+  //  Makes bonds given by LINK and LINKR records of the model
+  PLink  link;
+  PLinkR linkR;
+  PAtom  A1,A2;
+  int    i,n;
+
+    n = mdl->GetNumberOfLinks();
+    for (i=1;i<=n;i++)  {
+      link = mdl->GetLink ( i );
+      if (link && (link->s1==link->s2) && (link->i1==link->i2) &&
+                  (link->j1==link->j2) && (link->k1==link->k2))  {
+        A1 = GetLinkAtom ( mdl,link->chainID1,link->seqNum1,
+                           link->insCode1,link->atName1,link->aloc1 );
+        A2 = GetLinkAtom ( mdl,link->chainID2,link->seqNum2,
+                           link->insCode2,link->atName2,link->aloc2 );
+        if (A1 && A2 && (A1!=A2))  AddBondPair ( A1,A2 );
+      }
+    }
+
+    n = mdl->GetNumberOfLinkRs();
+    for (i=1;i<=n;i++)  {
+      linkR = mdl->GetLinkR ( i );
+      if (linkR)  {
+        A1 = GetLinkAtom ( mdl,linkR->chainID1,linkR->seqNum1,
+                           linkR->insCode1,linkR->atName1,linkR->aloc1 );
+        A2 = GetLinkAtom ( mdl,linkR->chainID2,linkR->seqNum2,
+                           linkR->insCode2,linkR->atName2,linkR->aloc2 );
+        if (A1 && A2 && (A1!=A2))  AddBondPair ( A1,A2 );
+      }
+    }
+
   }
 
   void  BondManager::RemoveBonds()  {
@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    15.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -42,11 +42,17 @@
 #define __MMDB_BondMngr__
 
 #include "mmdb_selmngr.h"
+#include "mmdb_math_graph.h"
 
 namespace mmdb  {
 
   // =======================  BondManager  =======================
 
+  //   Tolerance (in angstroms) added to the sum of covalent radii
+  // when deciding whether two atoms of different residues are
+  // bonded.
+  const realtype BondTolerance = 0.4;
+
   DefineClass(BondManager);
   DefineStreamFunctions(BondManager);
 
@@ -58,10 +64,40 @@ namespace mmdb  {
       BondManager ( io::RPStream Object );
       ~BondManager();
 
+      //   MakeBonds(..) makes bonds between atoms of each residue,
+      // as given by the residue graphs (see math::Graph::MakeGraph),
+      // and then bonds between the residues, as in
+      // MakeInterResidueBonds(). All old bonds are removed first.
+      // Residue graph templates (see math::GraphTemplates) are kept
+      // in the manager between the calls, and may be dropped with
+      // FreeBondTemplates().
       void  MakeBonds  ( bool calc_only );
       void  RemoveBonds();
+      void  FreeBondTemplates()  { bondTemplates.FreeMemory(); }
+
+      //   MakeInterResidueBonds(..) adds bonds between residues of
+      // model modelNo (1,2,...), or of all models if modelNo is 0:
+      //   - peptide C(i)-N(i+1) and phosphodiester O3'(i)-P(i+1)
+      //     bonds between adjacent residues of each chain;
+      //   - disulfide bonds between cysteins;
+      //   - bonds between atoms of ligand residues (not aminoacids,
+      //     nucleotides or solvent) and atoms of any other residue;
+      //   - bonds given by LINK and LINKR records, except links to
+      //     symmetry mates.
+      //   All but the last bonds are made only between atoms found
+      // at distance d<=r1+r2+BondTolerance, where r1 and r2 are the
+      // covalent radii of the atoms; hydrogens and solvent are not
+      // considered for these. Alternative locations are bonded only
+      // to the same alternative location or to the main conformation.
+      void  MakeInterResidueBonds ( int modelNo=0 );
 
     protected :
+      math::GraphTemplates bondTemplates;  // residue graph templates
+
+      void  MakeChainBonds  ( PChain chain );
+      void  MakeSpatialBonds( PModel mdl   );
+      void  MakeLinkBonds   ( PModel mdl   );
+
       void  write ( io::RFile f );
       void  read  ( io::RFile f );
 
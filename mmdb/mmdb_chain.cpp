@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -52,6 +52,7 @@
 #include "mmdb_model.h"
 #include "mmdb_root.h"
 #include "mmdb_cifdefs.h"
+#include "mmdb_sort.h"
 
 namespace mmdb  {
 
@@ -1310,6 +1311,8 @@ namespace mmdb  {
     nWeights       = 0;
     Weight         = 0.0;
     Exclude        = true;
+    edited         = true;
+    nIndexed       = 0;
   }
 
   void  Chain::SetChain ( const ChainID chID )  {
@@ -1504,6 +1507,7 @@ namespace mmdb  {
     residue[nResidues]->SetResID ( resName,seqNum,insCode );
     residue[nResidues]->index = nResidues;
     nResidues++;
+    edited = true;
 
     return residue[nResidues-1];
 
@@ -1603,6 +1607,7 @@ namespace mmdb  {
       }
       nResidues--;
       residue[nResidues] = NULL;
+      edited = true;
     }
 
     if (nResidues<=0)  return 1;
@@ -1621,6 +1626,7 @@ namespace mmdb  {
         delete residue[resNo];
         residue[resNo] = NULL;
         Exclude = true;
+        edited  = true;
         return 1;
       }
     }
@@ -1638,6 +1644,7 @@ namespace mmdb  {
             delete residue[i];
             residue[i] = NULL;
             Exclude = true;
+            edited  = true;
             return 1;
           }
         }
@@ -1649,6 +1656,7 @@ namespace mmdb  {
             delete residue[i];
             residue[i] = NULL;
             Exclude = true;
+            edited  = true;
             return 1;
           }
         }
@@ -1669,6 +1677,7 @@ namespace mmdb  {
       }
     nResidues = 0;
     Exclude = true;
+    edited  = true;
     return k;
   }
 
@@ -1686,6 +1695,7 @@ namespace mmdb  {
         }
       }
     Exclude = true;
+    if (k>0)  edited = true;
     return k;
   }
 
@@ -1826,6 +1836,7 @@ namespace mmdb  {
           for (i=0;i<chain1->nResidues;i++)
             if (chain1->residue[i]==res)  {
               chain1->residue[i] = NULL;
+              chain1->edited     = true;
               break;
             }
         residue[pp]->SetChain ( this );
@@ -1833,6 +1844,7 @@ namespace mmdb  {
           residue[pp]->CheckInAtoms();
       }
       nResidues++;
+      edited = true;
 
     }
 
@@ -2392,42 +2404,29 @@ namespace mmdb  {
 
   //  -------------------------------------------------------------------
 
-  DefineClass(SortResidues)
-
-  class QSortResidues : public QuickSort  {
-    public :
-      QSortResidues() : QuickSort() {}
-      int  Compare ( int i, int j );
-      void Swap    ( int i, int j );
-      void Sort    ( PPResidue res, int nresidues );
+  struct ResidueLess  {
+    //  residues with equal seqNum and insCode keep their order,
+    //  given by their indices in the chain
+    bool operator() ( PResidue r1, PResidue r2 ) const  {
+    int diff;
+      diff = r1->seqNum - r2->seqNum;
+      if (diff==0)
+        diff = strcmp ( r1->insCode,r2->insCode );
+      if (diff==0)
+        diff = r1->index - r2->index;
+      return (diff<0);
+    }
   };
 
-  int QSortResidues::Compare ( int i, int j )  {
-  int diff;
-    diff = ((PPResidue)data)[i]->seqNum - ((PPResidue)data)[j]->seqNum;
-    if (diff==0)
-      diff = strcmp( (PPResidue(data))[i]->insCode,
-                     (PPResidue(data))[j]->insCode );
-    if (diff>0)  return  1;
-    if (diff<0)  return -1;
-    return 0;
-  }
-
-  void QSortResidues::Swap ( int i, int j )  {
-  PResidue res;
-    res = ((PPResidue)data)[i];
-    ((PPResidue)data)[i] = ((PPResidue)data)[j];
-    ((PPResidue)data)[j] = res;
-  }
-
-  void QSortResidues::Sort ( PPResidue res, int nresidues )  {
-    QuickSort::Sort ( &(res[0]),nresidues );
-  }
-
   void  Chain::SortResidues()  {
-  QSortResidues SR;
+  int i;
     TrimResidueTable();
-    SR.Sort ( residue,nResidues );
+    for (i=0;i<nResidues;i++)
+      residue[i]->index = i;
+    SortArray ( residue,nResidues,ResidueLess() );
+    for (i=0;i<nResidues;i++)
+      residue[i]->index = i;
+    edited = true;
   }
 
   int  Chain::GetNofModResidues()  {
@@ -633,6 +633,10 @@ namespace mmdb  {
       PPResidue  residue;     // array of residues
 
       bool       Exclude;     // used internally
+      bool       edited;      // residues changed since last
+                              //   FinishStructEdit()
+      int        nIndexed;    // number of atoms indexed by last
+                              //   FinishStructEdit()
 
       void  InitChain ();
       void  FreeMemory();
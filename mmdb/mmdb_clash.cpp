@@ -0,0 +1,282 @@
+//  $Id: mmdb_clash.cpp $
+//  =================================================================
+//
+//   CCP4 Coordinate Library: support of coordinate-related
+//   functionality in protein crystallography applications.
+//
+//   Copyright (C) The MMDB contributors 2026.
+//
+//    This library is free software: you can redistribute it and/or
+//    modify it under the terms of the GNU Lesser General Public
+//    License version 3, modified in accordance with the provisions
+//    of the license to address the requirements of UK law.
+//
+//    You should have received a copy of the modified GNU Lesser
+//    General Public License along with this library. If not, copies
+//    may be downloaded from http://www.ccp4.ac.uk/ccp4license.php
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//  =================================================================
+//
+//    18.10.26   <--  Date of Last Modification.
+//                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  -----------------------------------------------------------------
+//
+//  **** Module  :  mmdb_clash <implementation>
+//       ~~~~~~~~~
+//       Project :  MacroMolecular Data Base (MMDB)
+//       ~~~~~~~~~
+//  **** Classes :  mmdb::Clash       ( steric clash between atoms  )
+//       ~~~~~~~~~  mmdb::ClashFinder ( steric clash detection     )
+//
+//  (C) The MMDB contributors 2026
+//
+//  =================================================================
+//
+
+#include <math.h>
+#include <string.h>
+
+#include "mmdb_clash.h"
+#include "mmdb_tables.h"
+
+namespace mmdb  {
+
+  // =======================  ClashFinder  ==========================
+
+  ClashFinder::ClashFinder()  {
+    InitClashFinder();
+  }
+
+  ClashFinder::~ClashFinder()  {
+    FreeMemory();
+  }
+
+  void  ClashFinder::InitClashFinder()  {
+    tolerance   = 0.4;
+    hbTolerance = 0.8;
+    noHydrogens = false;
+    rad         = NULL;
+    nRAlloc     = 0;
+    hit         = NULL;
+    nHAlloc     = 0;
+    matom       = NULL;
+    nMAlloc     = 0;
+    clist       = NULL;
+    nCAlloc     = 0;
+  }
+
+  void  ClashFinder::FreeMemory()  {
+    grid.FreeMemory();
+    FreeVectorMemory ( rad,0 );
+    FreeVectorMemory ( hit,0 );
+    nRAlloc = 0;
+    nHAlloc = 0;
+    if (matom)  delete[] matom;
+    matom   = NULL;
+    nMAlloc = 0;
+    if (clist)  delete[] clist;
+    clist   = NULL;
+    nCAlloc = 0;
+  }
+
+  realtype ClashFinder::FindClashes ( PPAtom A, int n, RPClash clash,
+                                      int & nClashes )  {
+  realtype score;
+    score = SeekClashes ( A,n,nClashes,true );
+    clash = clist;
+    return score;
+  }
+
+  realtype ClashFinder::GetClashScore ( PPAtom A, int n,
+                                        int & nClashes )  {
+    return SeekClashes ( A,n,nClashes,false );
+  }
+
+  realtype ClashFinder::FindClashes ( PModel mdl, RPClash clash,
+                                      int & nClashes )  {
+  realtype score;
+  int      n;
+    n     = GetModelAtoms ( mdl );
+    score = SeekClashes ( matom,n,nClashes,true );
+    clash = clist;
+    return score;
+  }
+
+  realtype ClashFinder::GetClashScore ( PModel mdl, int & nClashes )  {
+  int n;
+    n = GetModelAtoms ( mdl );
+    return SeekClashes ( matom,n,nClashes,false );
+  }
+
+  int  ClashFinder::GetModelAtoms ( PModel mdl )  {
+  PChain   chain;
+  PResidue res;
+  int      i,j,k,n, nChains,nRes;
+
+    if (!mdl)  return 0;
+
+    nChains = mdl->GetNumberOfChains();
+    n = 0;
+    for (i=0;i<nChains;i++)  {
+      chain = mdl->GetChain ( i );
+      if (chain)  {
+        nRes = chain->GetNumberOfResidues();
+        for (j=0;j<nRes;j++)  {
+          res = chain->GetResidue ( j );
+          if (res)  n += res->nAtoms;
+        }
+      }
+    }
+
+    if (n>nMAlloc)  {
+      if (matom)  delete[] matom;
+      nMAlloc = n;
+      matom   = new PAtom[nMAlloc];
+    }
+
+    n = 0;
+    for (i=0;i<nChains;i++)  {
+      chain = mdl->GetChain ( i );
+      if (chain)  {
+        nRes = chain->GetNumberOfResidues();
+        for (j=0;j<nRes;j++)  {
+          res = chain->GetResidue ( j );
+          if (res)
+            for (k=0;k<res->nAtoms;k++)
+              matom[n++] = res->atom[k];
+        }
+      }
+    }
+
+    return n;
+
+  }
+
+  static bool isBondedOr13 ( PAtom A1, PAtom A2 )  {
+  //  Returns true if atoms A1 and A2 are bonded or bonded to a
+  //  common atom
+  PAtomBond B1,B2;
+  int       i,j,nB1,nB2;
+    A1->GetBonds ( B1,nB1 );
+    for (i=0;i<nB1;i++)
+      if (B1[i].atom==A2)  return true;
+    for (i=0;i<nB1;i++)
+      if (B1[i].atom)  {
+        B1[i].atom->GetBonds ( B2,nB2 );
+        for (j=0;j<nB2;j++)
+          if (B2[j].atom==A2)  return true;
+      }
+    return false;
+  }
+
+  static bool isPolarHeavy ( PAtom A )  {
+  int e;
+    e = A->GetElementNo();
+    return (e==7) || (e==8);  // N or O
+  }
+
+  static bool isPolarHydrogen ( PAtom A )  {
+  //  Returns true if A is a hydrogen bonded to N or O
+  PAtomBond B;
+  int       i,nB;
+    if (!A->isHydrogen())  return false;
+    A->GetBonds ( B,nB );
+    for (i=0;i<nB;i++)
+      if (B[i].atom)  {
+        if (isPolarHeavy(B[i].atom))  return true;
+      }
+    return false;
+  }
+
+  realtype ClashFinder::SeekClashes ( PPAtom A, int n, int & nClashes,
+                                      bool makeList )  {
+  PAtom    a1,a2;
+  PClash   C1;
+  realtype rmax,r1,r12,d2,d,score;
+  int      i,j,k,m,nHits;
+
+    nClashes = 0;
+    score    = 0.0;
+    if ((!A) || (n<=1))  return score;
+
+    if (n>nRAlloc)  {
+      FreeVectorMemory ( rad,0 );
+      GetVectorMemory  ( rad,n,0 );
+      nRAlloc = n;
+    }
+
+    //  van der Waals radii; negative radii mark ignored atoms
+    rmax = 0.0;
+    for (i=0;i<n;i++)  {
+      a1 = A[i];
+      rad[i] = -1.0;
+      if (a1 && (!a1->Ter) && (a1->WhatIsSet & ASET_Coordinates) &&
+          ((!noHydrogens) || (!a1->isHydrogen())))  {
+        r1     = getVdWaalsRadius ( a1->GetElementNo() );
+        rad[i] = r1;
+        if (r1>rmax)  rmax = r1;
+      }
+    }
+
+    if (2.0*rmax<=tolerance)  return score;
+
+    grid.MakeGrid ( A,n,0.0,RMax(2.0*rmax-tolerance,2.0) );
+
+    for (i=0;i<n;i++)
+      if (rad[i]>0.0)  {
+        a1    = A[i];
+        nHits = grid.GetSphereAtoms ( a1->x,a1->y,a1->z,
+                                      rad[i]+rmax-tolerance,
+                                      hit,nHAlloc );
+        for (k=0;k<nHits;k++)  {
+          j = hit[k];
+          if ((j<=i) || (rad[j]<=0.0))  continue;
+          r12 = rad[i] + rad[j] - tolerance;
+          if (r12<=0.0)  continue;
+          a2 = A[j];
+          d2 = (a2->x-a1->x)*(a2->x-a1->x) +
+               (a2->y-a1->y)*(a2->y-a1->y) +
+               (a2->z-a1->z)*(a2->z-a1->z);
+          if (d2>=r12*r12)  continue;
+          if (!a1->isAltLocMatch(a2))  continue;
+          if (isBondedOr13(a1,a2))  continue;
+          if ((isPolarHydrogen(a1) && isPolarHeavy(a2)) ||
+              (isPolarHydrogen(a2) && isPolarHeavy(a1)))  {
+            //  hydrogen bond
+            r12 -= hbTolerance;
+            if ((r12<=0.0) || (d2>=r12*r12))  continue;
+          }
+          d      = sqrt(d2);
+          score += r12 - d;
+          if (makeList)  {
+            if (nClashes>=nCAlloc)  {
+              nCAlloc = 2*nCAlloc + 100;
+              C1 = new Clash[nCAlloc];
+              if (clist)  {
+                for (m=0;m<nClashes;m++)
+                  C1[m] = clist[m];
+                delete[] clist;
+              }
+              clist = C1;
+            }
+            clist[nClashes].atom1   = a1;
+            clist[nClashes].atom2   = a2;
+            clist[nClashes].id1     = i;
+            clist[nClashes].id2     = j;
+            clist[nClashes].dist    = d;
+            clist[nClashes].overlap = rad[i] + rad[j] - d;
+          }
+          nClashes++;
+        }
+      }
+
+    return score;
+
+  }
+
+}  // namespace mmdb
@@ -0,0 +1,136 @@
+//  $Id: mmdb_clash.h $
+//  =================================================================
+//
+//   CCP4 Coordinate Library: support of coordinate-related
+//   functionality in protein crystallography applications.
+//
+//   Copyright (C) The MMDB contributors 2026.
+//
+//    This library is free software: you can redistribute it and/or
+//    modify it under the terms of the GNU Lesser General Public
+//    License version 3, modified in accordance with the provisions
+//    of the license to address the requirements of UK law.
+//
+//    You should have received a copy of the modified GNU Lesser
+//    General Public License along with this library. If not, copies
+//    may be downloaded from http://www.ccp4.ac.uk/ccp4license.php
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//  =================================================================
+//
+//    18.10.26   <--  Date of Last Modification.
+//                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  -----------------------------------------------------------------
+//
+//  **** Module  :  mmdb_clash <interface>
+//       ~~~~~~~~~
+//       Project :  MacroMolecular Data Base (MMDB)
+//       ~~~~~~~~~
+//  **** Classes :  mmdb::Clash       ( steric clash between atoms  )
+//       ~~~~~~~~~  mmdb::ClashFinder ( steric clash detection     )
+//
+//  (C) The MMDB contributors 2026
+//
+//  =================================================================
+//
+
+#ifndef __MMDB_Clash__
+#define __MMDB_Clash__
+
+#include "mmdb_coormngr.h"
+
+namespace mmdb  {
+
+  // ==========================  Clash  =============================
+
+  DefineStructure(Clash);
+
+  struct Clash  {
+    PAtom    atom1,atom2; // clashing atoms
+    int      id1,id2;     // their indices in the atom vector, id1<id2
+    realtype dist;        // distance between the atoms
+    realtype overlap;     // sum of van der Waals radii minus dist
+  };
+
+
+  // =======================  ClashFinder  ==========================
+
+  //   ClashFinder finds pairs of atoms which overlap by more than
+  // tolerance, i.e. are found on distance d<rvdw1+rvdw2-tolerance,
+  // where rvdw are van der Waals radii of the atoms' elements (see
+  // getVdWaalsRadius(..) in mmdb_tables.h). Atoms bonded to each
+  // other (1-2 pairs) or to a common atom (1-3 pairs) are excluded,
+  // as well as atoms of different non-empty alternative locations.
+  // Contacts of a polar hydrogen (bonded to N or O) with an N or O
+  // atom are hydrogen bonds rather than clashes; they are allowed
+  // to overlap by hbTolerance in addition to tolerance, so that
+  // normal H...O bonds of ~1.9 A are not reported. Bonds are taken
+  // from the atoms, therefore they should be made beforehand, e.g.
+  // by BondManager::MakeBonds(..); atoms without bonds are treated
+  // as not bonded, and hydrogens without bonds as not polar.
+  //   The clash score is the sum of overlaps in excess of the
+  // tolerance over all clashes.
+  //   ClashFinder keeps all its working space (grid, radii and
+  // clash vectors) between the calls and does not use any global
+  // data, so that repeated calls, e.g. in sampling loops, do not
+  // reallocate memory, and separate ClashFinders may be used
+  // concurrently for different models.
+
+  DefineClass(ClashFinder);
+
+  class ClashFinder  {
+
+    public :
+      realtype tolerance;     // allowed overlap, 0.4 A
+      realtype hbTolerance;   // extra overlap for H-bonds, 0.8 A
+      bool     noHydrogens;   // ignore hydrogens, false
+
+      ClashFinder ();
+      ~ClashFinder();
+
+      void  FreeMemory();
+
+      //   FindClashes(..) finds clashes between atoms A[0..n-1];
+      // NULL and Ter atoms and atoms without coordinates are
+      // ignored. The clashes are returned in vector clash, which
+      // belongs to the ClashFinder and is valid until the next call;
+      // it must not be disposed. Returns the clash score.
+      realtype FindClashes   ( PPAtom A, int n, RPClash clash,
+                               int & nClashes );
+
+      //   GetClashScore(..) works as FindClashes(..) but does not
+      // make the clash list.
+      realtype GetClashScore ( PPAtom A, int n, int & nClashes );
+
+      //   These functions find clashes between all atoms of model
+      // mdl; atom indices in the clash list then refer to the atoms
+      // of the model, taken chain by chain and residue by residue.
+      realtype FindClashes   ( PModel mdl, RPClash clash,
+                               int & nClashes );
+      realtype GetClashScore ( PModel mdl, int & nClashes );
+
+    protected :
+      BrickGrid grid;
+      rvector   rad;       // van der Waals radii of atoms
+      int       nRAlloc;
+      ivector   hit;       // hits in the grid
+      int       nHAlloc;
+      PPAtom    matom;     // atoms of the model
+      int       nMAlloc;
+      PClash    clist;     // clash list
+      int       nCAlloc;
+
+      void     InitClashFinder();
+      realtype SeekClashes   ( PPAtom A, int n, int & nClashes,
+                               bool makeList );
+      int      GetModelAtoms ( PModel mdl );
+
+  };
+
+}  // namespace mmdb
+
+#endif
@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    14.07.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -31,18 +31,21 @@
 //       Project :  MacroMolecular Data Base (MMDB)
 //       ~~~~~~~~~
 //  **** Classes :  mmdb::Brick       ( space brick                  )
-//       ~~~~~~~~~  mmdb::CoorManager ( MMDB atom coordinate manager )
+//       ~~~~~~~~~  mmdb::BrickGrid   ( flat persistent brick grid   )
+//                  mmdb::CoorManager ( MMDB atom coordinate manager )
 //
 //  (C) E. Krissinel 2000-2013
 //
 //  =================================================================
 //
 
+#include <stdlib.h>
 #include <math.h>
 #include <string.h>
 
 #include "mmdb_coormngr.h"
-#include "mmdb_math_linalg.h"
+#include "mmdb_math_superpose.h"
+#include "mmdb_sort.h"
 #include "mmdb_tables.h"
 
 namespace mmdb  {
@@ -173,6 +176,544 @@ namespace mmdb  {
 
 
 
+  // ==========================  BrickGrid  ===========================
+
+  BrickGrid::BrickGrid()  {
+    InitBrickGrid();
+  }
+
+  BrickGrid::~BrickGrid()  {
+    FreeMemory();
+  }
+
+  void  BrickGrid::InitBrickGrid()  {
+    atom          = NULL;
+    nAtoms        = 0;
+    nGridded      = 0;
+    id            = NULL;
+    x             = NULL;
+    y             = NULL;
+    z             = NULL;
+    cell          = NULL;
+    size          = 6.0;
+    x0            = 0.0;
+    y0            = 0.0;
+    z0            = 0.0;
+    nbx           = 0;
+    nby           = 0;
+    nbz           = 0;
+  }
+
+  void  BrickGrid::FreeMemory()  {
+    FreeVectorMemory ( id  ,0 );
+    FreeVectorMemory ( x   ,0 );
+    FreeVectorMemory ( y   ,0 );
+    FreeVectorMemory ( z   ,0 );
+    FreeVectorMemory ( cell,0 );
+    InitBrickGrid();
+  }
+
+  void  BrickGrid::MakeGrid ( PPAtom atmvec, int avlen,
+                              realtype Margin, realtype BrickSize )  {
+  rvector ax,ay,az;
+  bvector use;
+  int     i;
+
+    FreeMemory();
+
+    if ((!atmvec) || (avlen<=0))  return;
+
+    GetVectorMemory ( ax ,avlen,0 );
+    GetVectorMemory ( ay ,avlen,0 );
+    GetVectorMemory ( az ,avlen,0 );
+    GetVectorMemory ( use,avlen,0 );
+    for (i=0;i<avlen;i++)  {
+      use[i] = 0;
+      if (atmvec[i])  {
+        if ((!atmvec[i]->Ter) &&
+            (atmvec[i]->WhatIsSet & ASET_Coordinates))  {
+          ax [i] = atmvec[i]->x;
+          ay [i] = atmvec[i]->y;
+          az [i] = atmvec[i]->z;
+          use[i] = 1;
+        }
+      }
+    }
+
+    PutPoints ( ax,ay,az,use,avlen,Margin,BrickSize );
+    atom   = atmvec;
+    nAtoms = avlen;
+
+    FreeVectorMemory ( ax ,0 );
+    FreeVectorMemory ( ay ,0 );
+    FreeVectorMemory ( az ,0 );
+    FreeVectorMemory ( use,0 );
+
+  }
+
+  void  BrickGrid::MakeGrid ( rvector ax, rvector ay, rvector az,
+                              int n, realtype Margin,
+                              realtype BrickSize )  {
+    FreeMemory();
+    if ((!ax) || (!ay) || (!az) || (n<=0))  return;
+    PutPoints ( ax,ay,az,NULL,n,Margin,BrickSize );
+    nAtoms = n;
+  }
+
+  void  BrickGrid::PutPoints ( rvector ax, rvector ay, rvector az,
+                               bvector use, int n,
+                               realtype Margin, realtype BrickSize )  {
+  //   Puts points into bricks by counting sort: brick numbers are
+  // calculated once, then brick populations give the brick offsets,
+  // and finally points are placed into their bricks. Points with
+  // use[i]==0 are skipped.
+  ivector  bno;
+  realtype x1,x2, y1,y2, z1,z2, dx,dy,dz;
+  long     nCells;
+  int      i,k, nx,ny,nz;
+
+    size = BrickSize;
+    if (size<=0.0)  return;
+
+    x1 = MaxReal;  x2 = -x1;
+    y1 = MaxReal;  y2 = -y1;
+    z1 = MaxReal;  z2 = -z1;
+    k  = 0;
+    for (i=0;i<n;i++)
+      if ((!use) || use[i])  {
+        if (ax[i]<x1)  x1 = ax[i];
+        if (ax[i]>x2)  x2 = ax[i];
+        if (ay[i]<y1)  y1 = ay[i];
+        if (ay[i]>y2)  y2 = ay[i];
+        if (az[i]<z1)  z1 = az[i];
+        if (az[i]>z2)  z2 = az[i];
+        k++;
+      }
+    if (k<=0)  return;
+
+    x1 -= Margin;  x2 += Margin;
+    y1 -= Margin;  y2 += Margin;
+    z1 -= Margin;  z2 += Margin;
+    dx = x2-x1;
+    dy = y2-y1;
+    dz = z2-z1;
+
+    //  do not let sparse structures (e.g. with remote symmetry
+    //  mates) blow up the grid
+    do  {
+      nbx    = (int)floor(dx/size) + 1;
+      nby    = (int)floor(dy/size) + 1;
+      nbz    = (int)floor(dz/size) + 1;
+      nCells = long(nbx)*long(nby)*long(nbz);
+      if (nCells>8L*k+4096L)  size *= 1.25;
+    } while (nCells>8L*k+4096L);
+
+    x0 = x1 - (nbx*size-dx)/2.0;
+    y0 = y1 - (nby*size-dy)/2.0;
+    z0 = z1 - (nbz*size-dz)/2.0;
+
+    GetVectorMemory ( cell,nCells+1,0 );
+    GetVectorMemory ( bno ,n       ,0 );
+    for (i=0;i<=nCells;i++)
+      cell[i] = 0;
+
+    for (i=0;i<n;i++)
+      if ((!use) || use[i])  {
+        nx = (int)floor((ax[i]-x0)/size);
+        ny = (int)floor((ay[i]-y0)/size);
+        nz = (int)floor((az[i]-z0)/size);
+        if (nx>=nbx)  nx = nbx-1;
+        if (ny>=nby)  ny = nby-1;
+        if (nz>=nbz)  nz = nbz-1;
+        bno[i] = (nx*nby+ny)*nbz + nz;
+        cell[bno[i]+1]++;
+      } else
+        bno[i] = -1;
+
+    for (i=0;i<nCells;i++)
+      cell[i+1] += cell[i];
+
+    nGridded      = k;
+    GetVectorMemory ( id,k,0 );
+    GetVectorMemory ( x ,k,0 );
+    GetVectorMemory ( y ,k,0 );
+    GetVectorMemory ( z ,k,0 );
+
+    //  cell[k] is used as a running position and shifted back below
+    for (i=0;i<n;i++)
+      if (bno[i]>=0)  {
+        k = cell[bno[i]]++;
+        id[k] = i;
+        x [k] = ax[i];
+        y [k] = ay[i];
+        z [k] = az[i];
+      }
+    for (i=nCells;i>0;i--)
+      cell[i] = cell[i-1];
+    cell[0] = 0;
+
+    FreeVectorMemory ( bno,0 );
+
+  }
+
+  void  BrickGrid::GetBrickRange (
+                     realtype xmin, realtype ymin, realtype zmin,
+                     realtype xmax, realtype ymax, realtype zmax,
+                     int & nx1, int & ny1, int & nz1,
+                     int & nx2, int & ny2, int & nz2 )  {
+    if (!cell)  {
+      nx1 = 0;  ny1 = 0;  nz1 = 0;
+      nx2 = 0;  ny2 = 0;  nz2 = 0;
+      return;
+    }
+    //  clamp in real numbers first to avoid integer overflows
+    //  on remote boxes
+    xmin = RMax ( (xmin-x0)/size,-1.0 );
+    ymin = RMax ( (ymin-y0)/size,-1.0 );
+    zmin = RMax ( (zmin-z0)/size,-1.0 );
+    xmax = RMin ( (xmax-x0)/size,realtype(nbx) );
+    ymax = RMin ( (ymax-y0)/size,realtype(nby) );
+    zmax = RMin ( (zmax-z0)/size,realtype(nbz) );
+    nx1  = IMax ( 0,(int)floor(xmin) );
+    ny1  = IMax ( 0,(int)floor(ymin) );
+    nz1  = IMax ( 0,(int)floor(zmin) );
+    nx2  = IMin ( nbx,(int)floor(xmax)+1 );
+    ny2  = IMin ( nby,(int)floor(ymax)+1 );
+    nz2  = IMin ( nbz,(int)floor(zmax)+1 );
+  }
+
+  int  BrickGrid::GetShellAtoms ( realtype xc, realtype yc,
+                                  realtype zc,
+                                  realtype d1, realtype d2,
+                                  ivector & hit, int & nAlloc,
+                                  int nHits )  {
+  realtype d12,d22, dx,dy,dz, d;
+  int      nx1,ny1,nz1, nx2,ny2,nz2, nx,ny, i,i2, nc;
+
+    if ((!cell) || (d2<0.0))  return nHits;
+
+    d12 = d1*d1;
+    d22 = d2*d2;
+
+    GetBrickRange ( xc-d2,yc-d2,zc-d2, xc+d2,yc+d2,zc+d2,
+                    nx1,ny1,nz1, nx2,ny2,nz2 );
+
+    for (nx=nx1;nx<nx2;nx++)
+      for (ny=ny1;ny<ny2;ny++)  {
+        nc = (nx*nby+ny)*nbz;
+        //  bricks nz1..nz2-1 are adjacent in the flat vectors
+        i2 = cell[nc+nz2];
+        for (i=cell[nc+nz1];i<i2;i++)  {
+          dx = x[i]-xc;
+          dy = y[i]-yc;
+          dz = z[i]-zc;
+          d  = dx*dx + dy*dy + dz*dz;
+          if ((d<=d22) && (d>=d12))
+            AddHit ( hit,nAlloc,nHits,id[i] );
+        }
+      }
+
+    return nHits;
+
+  }
+
+  int  BrickGrid::GetCylinderAtoms ( realtype x1, realtype y1,
+                                     realtype z1, realtype x2,
+                                     realtype y2, realtype z2,
+                                     realtype r,
+                                     ivector & hit, int & nAlloc,
+                                     int nHits )  {
+  //  The test is that of SelManager::SelectCylinder(): c1 is the
+  //  projection of atom on the axis, counted from (x2,y2,z2).
+  realtype dx,dy,dz, c,c2,dc, a2,b2,c1, r2;
+  int      nx1,ny1,nz1, nx2,ny2,nz2, nx,ny, i,i2, nc;
+
+    if ((!cell) || (r<0.0))  return nHits;
+
+    dx = x1-x2;
+    dy = y1-y2;
+    dz = z1-z2;
+    c2 = dx*dx + dy*dy + dz*dz;
+    if (c2<=0.0)  return nHits;
+    c  = sqrt(c2);
+    dc = 2.0*c;
+    r2 = r*r;
+
+    GetBrickRange ( RMin(x1,x2)-r,RMin(y1,y2)-r,RMin(z1,z2)-r,
+                    RMax(x1,x2)+r,RMax(y1,y2)+r,RMax(z1,z2)+r,
+                    nx1,ny1,nz1, nx2,ny2,nz2 );
+
+    for (nx=nx1;nx<nx2;nx++)
+      for (ny=ny1;ny<ny2;ny++)  {
+        nc = (nx*nby+ny)*nbz;
+        i2 = cell[nc+nz2];
+        for (i=cell[nc+nz1];i<i2;i++)  {
+          dx = x[i]-x1;
+          dy = y[i]-y1;
+          dz = z[i]-z1;
+          a2 = dx*dx + dy*dy + dz*dz;
+          dx = x[i]-x2;
+          dy = y[i]-y2;
+          dz = z[i]-z2;
+          b2 = dx*dx + dy*dy + dz*dz;
+          c1 = (c2-a2+b2)/dc;
+          if ((0.0<=c1) && (c1<=c) && (b2-c1*c1<=r2))
+            AddHit ( hit,nAlloc,nHits,id[i] );
+        }
+      }
+
+    return nHits;
+
+  }
+
+  int  BrickGrid::GetSlabAtoms ( realtype a, realtype b, realtype c,
+                                 realtype d, realtype r,
+                                 ivector & hit, int & nAlloc,
+                                 int nHits )  {
+  //  Bricks, which centres are farther from the plane than r plus
+  //  half of the brick diagonal, are skipped as a whole.
+  realtype v,h, hb, xc,yc,zc;
+  int      nx,ny,nz, i,i2, nc;
+
+    if ((!cell) || (r<0.0))  return nHits;
+
+    v = sqrt(a*a + b*b + c*c);
+    if (v<=0.0)  return nHits;
+
+    hb = r + size*sqrt(3.0)/2.0;
+
+    for (nx=0;nx<nbx;nx++)  {
+      xc = x0 + (nx+0.5)*size;
+      for (ny=0;ny<nby;ny++)  {
+        yc = y0 + (ny+0.5)*size;
+        nc = (nx*nby+ny)*nbz;
+        for (nz=0;nz<nbz;nz++)  {
+          zc = z0 + (nz+0.5)*size;
+          if (fabs(d-a*xc-b*yc-c*zc)/v<=hb)  {
+            i2 = cell[nc+nz+1];
+            for (i=cell[nc+nz];i<i2;i++)  {
+              h = fabs(d-a*x[i]-b*y[i]-c*z[i])/v;
+              if (h<=r)
+                AddHit ( hit,nAlloc,nHits,id[i] );
+            }
+          }
+        }
+      }
+    }
+
+    return nHits;
+
+  }
+
+  void  AddHit ( ivector & hit, int & nAlloc, int & nHits, int n )  {
+  ivector hit1;
+  int     i;
+    if (nHits>=nAlloc)  {
+      nAlloc = nHits + IMax(nHits/2,64);
+      GetVectorMemory ( hit1,nAlloc,0 );
+      for (i=0;i<nHits;i++)
+        hit1[i] = hit[i];
+      FreeVectorMemory ( hit,0 );
+      hit = hit1;
+    }
+    hit[nHits++] = n;
+  }
+
+
+
+  //  ====================  SurfaceArea  ======================
+
+  SurfaceArea::SurfaceArea()  {
+    InitSurfaceArea();
+  }
+
+  SurfaceArea::~SurfaceArea()  {
+    FreeMemory();
+    FreeVectorMemory ( px,0 );
+    FreeVectorMemory ( py,0 );
+    FreeVectorMemory ( pz,0 );
+  }
+
+  void  SurfaceArea::InitSurfaceArea()  {
+    px       = NULL;
+    py       = NULL;
+    pz       = NULL;
+    nPts     = 0;
+    sx       = NULL;
+    sy       = NULL;
+    sz       = NULL;
+    sr       = NULL;
+    nSpheres = 0;
+    rmax     = 0.0;
+    SetSpherePoints ( 200 );
+  }
+
+  void  SurfaceArea::FreeMemory()  {
+  // sphere points are kept
+    FreeVectorMemory ( sx,0 );
+    FreeVectorMemory ( sy,0 );
+    FreeVectorMemory ( sz,0 );
+    FreeVectorMemory ( sr,0 );
+    nSpheres = 0;
+    rmax     = 0.0;
+    grid.FreeMemory();
+  }
+
+  void  SurfaceArea::SetSpherePoints ( int nPoints )  {
+  //  golden section spiral gives nearly even distribution
+  //  of points for any nPoints
+  realtype dphi,phi,zk,rk;
+  int      k;
+
+    FreeVectorMemory ( px,0 );
+    FreeVectorMemory ( py,0 );
+    FreeVectorMemory ( pz,0 );
+    nPts = IMax ( 1,nPoints );
+    GetVectorMemory ( px,nPts,0 );
+    GetVectorMemory ( py,nPts,0 );
+    GetVectorMemory ( pz,nPts,0 );
+
+    dphi = Pi*(3.0-sqrt(5.0));
+    phi  = 0.0;
+    for (k=0;k<nPts;k++)  {
+      zk    = 1.0 - (2.0*k+1.0)/nPts;
+      rk    = sqrt ( RMax(0.0,1.0-zk*zk) );
+      px[k] = rk*cos(phi);
+      py[k] = rk*sin(phi);
+      pz[k] = zk;
+      phi  += dphi;
+    }
+
+  }
+
+  void  SurfaceArea::SetSpheres ( rvector x, rvector y, rvector z,
+                                  rvector r, int n )  {
+  int i;
+
+    FreeMemory();
+    if (n<=0)  return;
+
+    nSpheres = n;
+    GetVectorMemory ( sx,nSpheres,0 );
+    GetVectorMemory ( sy,nSpheres,0 );
+    GetVectorMemory ( sz,nSpheres,0 );
+    GetVectorMemory ( sr,nSpheres,0 );
+    for (i=0;i<nSpheres;i++)  {
+      sx[i] = x[i];
+      sy[i] = y[i];
+      sz[i] = z[i];
+      sr[i] = r[i];
+      if (sr[i]>rmax)  rmax = sr[i];
+    }
+
+    grid.MakeGrid ( sx,sy,sz,nSpheres,rmax,RMax(2.0*rmax,1.0) );
+
+  }
+
+  void  SurfaceArea::GetAreas ( rvector area, int i1, int i2 )  {
+  //   Neighbours of each sphere are packed into contiguous vectors
+  // of coordinates relative to the sphere's centre. The neighbour
+  // which buried the last point is checked first, as adjacent
+  // points are likely to be buried by the same neighbour.
+  rvector  nx,ny,nz,nr2;
+  ivector  hit;
+  realtype xi,yi,zi,ri, dx,dy,dz, d, tx,ty,tz, s;
+  int      i,j,k,p, nHits,nAlloc,nNb,nNbAlloc, last,nExposed;
+  bool     buried;
+
+    if ((!grid.isReady()) || (nPts<=0))  {
+      for (i=i1;i<i2;i++)
+        area[i] = 0.0;
+      return;
+    }
+
+    hit      = NULL;
+    nAlloc   = 0;
+    nx       = NULL;
+    ny       = NULL;
+    nz       = NULL;
+    nr2      = NULL;
+    nNbAlloc = 0;
+
+    for (i=i1;i<i2;i++)  {
+
+      xi = sx[i];
+      yi = sy[i];
+      zi = sz[i];
+      ri = sr[i];
+
+      nHits = grid.GetSphereAtoms ( xi,yi,zi,ri+rmax,hit,nAlloc );
+
+      if (nHits>nNbAlloc)  {
+        FreeVectorMemory ( nx ,0 );
+        FreeVectorMemory ( ny ,0 );
+        FreeVectorMemory ( nz ,0 );
+        FreeVectorMemory ( nr2,0 );
+        nNbAlloc = nHits;
+        GetVectorMemory  ( nx ,nNbAlloc,0 );
+        GetVectorMemory  ( ny ,nNbAlloc,0 );
+        GetVectorMemory  ( nz ,nNbAlloc,0 );
+        GetVectorMemory  ( nr2,nNbAlloc,0 );
+      }
+
+      nNb = 0;
+      for (k=0;k<nHits;k++)  {
+        j = hit[k];
+        if (j!=i)  {
+          dx = sx[j] - xi;
+          dy = sy[j] - yi;
+          dz = sz[j] - zi;
+          d  = ri + sr[j];
+          if (dx*dx+dy*dy+dz*dz<d*d)  {
+            nx [nNb] = dx;
+            ny [nNb] = dy;
+            nz [nNb] = dz;
+            nr2[nNb] = sr[j]*sr[j];
+            nNb++;
+          }
+        }
+      }
+
+      last     = 0;
+      nExposed = 0;
+      for (p=0;p<nPts;p++)  {
+        tx = ri*px[p];
+        ty = ri*py[p];
+        tz = ri*pz[p];
+        buried = false;
+        if (nNb>0)  {
+          dx = tx - nx[last];
+          dy = ty - ny[last];
+          dz = tz - nz[last];
+          buried = (dx*dx+dy*dy+dz*dz<nr2[last]);
+          for (k=0;(k<nNb) && (!buried);k++)  {
+            dx = tx - nx[k];
+            dy = ty - ny[k];
+            dz = tz - nz[k];
+            if (dx*dx+dy*dy+dz*dz<nr2[k])  {
+              buried = true;
+              last   = k;
+            }
+          }
+        }
+        if (!buried)  nExposed++;
+      }
+
+      s       = 4.0*Pi*ri*ri;
+      area[i] = s*nExposed/nPts;
+
+    }
+
+    FreeVectorMemory ( nr2,0 );
+    FreeVectorMemory ( nz ,0 );
+    FreeVectorMemory ( ny ,0 );
+    FreeVectorMemory ( nx ,0 );
+    FreeVectorMemory ( hit,0 );
+
+  }
+
+
+
   //  ====================  GenSym  ========================
 
   GenSym::GenSym() : SymOps()  {
@@ -524,6 +1065,107 @@ namespace mmdb  {
   }
 
 
+  // ========================  ContactCSR  ===========================
+
+  ContactCSR::ContactCSR()  {
+    InitContactCSR();
+  }
+
+  ContactCSR::~ContactCSR()  {
+    FreeMemory();
+  }
+
+  void  ContactCSR::InitContactCSR()  {
+    nRows      = 0;
+    nContacts  = 0;
+    row        = NULL;
+    col        = NULL;
+    dist       = NULL;
+    overflow   = false;
+    nRowsAlloc = 0;
+    nAlloc     = 0;
+    fixed      = false;
+    useDist    = true;
+  }
+
+  void  ContactCSR::FreeMemory()  {
+    FreeVectorMemory ( row,0 );
+    FreeVectorMemory ( col,0 );
+    if (dist)  delete[] dist;
+    dist       = NULL;
+    nRows      = 0;
+    nContacts  = 0;
+    overflow   = false;
+    nRowsAlloc = 0;
+    nAlloc     = 0;
+    fixed      = false;
+  }
+
+  void  ContactCSR::Reserve ( int maxContacts, bool withDist,
+                              bool fixedSize )  {
+  ivector     col1;
+  shortreal * dist1;
+  int         i;
+
+    if (maxContacts>nAlloc)  {
+      GetVectorMemory ( col1,maxContacts,0 );
+      for (i=0;i<nContacts;i++)
+        col1[i] = col[i];
+      FreeVectorMemory ( col,0 );
+      col = col1;
+      if (dist)  {
+        dist1 = new shortreal[maxContacts];
+        for (i=0;i<nContacts;i++)
+          dist1[i] = dist[i];
+        delete[] dist;
+        dist = dist1;
+      }
+      nAlloc = maxContacts;
+    }
+
+    useDist = withDist;
+    if (useDist && (!dist) && (nAlloc>0))
+      dist = new shortreal[nAlloc];
+    if ((!useDist) && dist)  {
+      delete[] dist;
+      dist = NULL;
+    }
+
+    fixed = fixedSize;
+
+  }
+
+  void  ContactCSR::StartRows ( int n, bool withDist )  {
+    if (n+1>nRowsAlloc)  {
+      FreeVectorMemory ( row,0 );
+      nRowsAlloc = n+1;
+      GetVectorMemory ( row,nRowsAlloc,0 );
+    }
+    nRows     = n;
+    nContacts = 0;
+    overflow  = false;
+    row[0]    = 0;
+    Reserve ( nAlloc,withDist,fixed );
+  }
+
+  void  ContactCSR::AddContact ( int j, realtype d )  {
+    if (nContacts>=nAlloc)  {
+      if (fixed)  {
+        overflow = true;
+        return;
+      }
+      Reserve ( nContacts + IMax(nContacts/2,1024),useDist,false );
+    }
+    col[nContacts] = j;
+    if (dist)  dist[nContacts] = shortreal(d);
+    nContacts++;
+  }
+
+  void  ContactCSR::EndRow ( int i )  {
+    row[i+1] = nContacts;
+  }
+
+
   //  ====================   CoorManager   =====================
 
   CoorManager::CoorManager() : Root()  {
@@ -2839,11 +3481,8 @@ namespace mmdb  {
 
   void  CoorManager::ApplyTransform ( mat44 & TMatrix )  {
   // simply transforms all coordinates by multiplying with matrix TMatrix
-  int i;
-    for (i=0;i<nAtoms;i++)
-      if (atom[i])  {
-        if (!atom[i]->Ter)  atom[i]->Transform ( TMatrix );
-      }
+    TransformAtoms ( atom,nAtoms,TMatrix );
+    CoordinatesMoved();
   }
 
   void  CoorManager::ApplySymTransform ( int SymOpNo, PGenSym genSym ) {
@@ -2859,10 +3498,8 @@ namespace mmdb  {
   PPChain chain;
     if (cryst.GetTMatrix(tmat,SymOpNo,0,0,0,PSymOps(genSym))
          ==SYMOP_Ok)  {
-      for (i=0;i<nAtoms;i++)
-        if (atom[i])  {
-          if (!atom[i]->Ter)  atom[i]->Transform ( tmat );
-        }
+      TransformAtoms ( atom,nAtoms,tmat );
+      CoordinatesMoved();
       if (genSym)
         for (i=0;i<nModels;i++)
           if (model[i])  {
@@ -3126,7 +3763,7 @@ namespace mmdb  {
     for (i=0;i<nA;i++)
       if (A[i])  {
         if ((!A[i]->Ter) && (A[i]->WhatIsSet & ASET_Coordinates))  {
-          k = getElementNo ( A[i]->element );
+          k = A[i]->GetElementNo();
           if (k>=0)  w = MolecWeight[k];
                else  w = 1.0;
           xmc  += w*A[i]->x;
@@ -3238,6 +3875,8 @@ namespace mmdb  {
         }
       }
 
+    if (nt>0)  CoordinatesMoved();
+
     return nt;  // number of converted chains
 
   }
@@ -3256,6 +3895,16 @@ namespace mmdb  {
   }
 
 
+  bool CoorManager::Frac2Orth ( rvector x, rvector y, rvector z,
+                                int n )  {
+    return cryst.Frac2Orth ( x,y,z,n );
+  }
+
+  bool CoorManager::Orth2Frac ( rvector x, rvector y, rvector z,
+                                int n )  {
+    return cryst.Orth2Frac ( x,y,z,n );
+  }
+
   bool CoorManager::Frac2Orth ( mat44 & F, mat44 & T )  {
     return cryst.Frac2Orth ( F,T );
   }
@@ -3972,76 +4621,417 @@ namespace mmdb  {
 
 
 
-  DefineClass(QSortContacts)
+  //   Contacts are sorted by atom indices with RadixSort(..), and
+  // by distances with SortArray(..)
 
-  class QSortContacts : public QuickSort  {
-    public :
-      QSortContacts() : QuickSort() {}
-      int  Compare ( int i, int j );
-      void Swap    ( int i, int j );
-      void Sort    ( PContact contact, int ncontacts, int sortmode );
-    protected :
-      int  mode;
+  struct ContactKey  {
+    int mode;
+    word operator() ( const Contact & c ) const  {
+      switch (mode)  {
+        default          :
+        case CNSORT_1INC : return  RadixKey ( c.id1 );
+        case CNSORT_1DEC : return ~RadixKey ( c.id1 );
+        case CNSORT_2INC : return  RadixKey ( c.id2 );
+        case CNSORT_2DEC : return ~RadixKey ( c.id2 );
+      }
+    }
   };
 
-  int QSortContacts::Compare ( int i, int j )  {
-  bool gt,lt;
-    switch (mode)  {
-      default          :
-      case CNSORT_1INC : gt = (((PContact)data)[i].id1 >
-                               ((PContact)data)[j].id1);
-                         lt = (((PContact)data)[i].id1 <
-                               ((PContact)data)[j].id1);
-                     break;
-      case CNSORT_1DEC : gt = (((PContact)data)[j].id1 >
-                               ((PContact)data)[i].id1);
-                         lt = (((PContact)data)[j].id1 <
-                               ((PContact)data)[i].id1);
-                     break;
-      case CNSORT_2INC : gt = (((PContact)data)[i].id2 >
-                               ((PContact)data)[j].id2);
-                         lt = (((PContact)data)[i].id2 <
-                               ((PContact)data)[j].id2);
-                     break;
-      case CNSORT_2DEC : gt = (((PContact)data)[j].id2 >
-                               ((PContact)data)[i].id2);
-                         lt = (((PContact)data)[j].id2 <
-                               ((PContact)data)[i].id2);
-                     break;
-      case CNSORT_DINC : gt = (((PContact)data)[i].dist >
-                               ((PContact)data)[j].dist);
-                         lt = (((PContact)data)[i].dist <
-                               ((PContact)data)[j].dist);
-                     break;
-      case CNSORT_DDEC : gt = (((PContact)data)[j].dist >
-                               ((PContact)data)[i].dist);
-                         lt = (((PContact)data)[j].dist <
-                               ((PContact)data)[i].dist);
-                     break;
-    }
-    if (gt)  return  1;
-    if (lt)  return -1;
-    return 0;
+  struct ContactDistLess  {
+    bool descending;
+    bool operator() ( const Contact & c1, const Contact & c2 ) const  {
+      if (descending)  return (c2.dist<c1.dist);
+      return (c1.dist<c2.dist);
+    }
+  };
+
+  void  SortContacts ( PContact contact, int ncontacts,
+                       CNSORT_DIR sortmode )  {
+  ContactKey      CK;
+  ContactDistLess CL;
+    switch (sortmode)  {
+      case CNSORT_OFF  : break;
+      case CNSORT_DINC :
+      case CNSORT_DDEC : CL.descending = (sortmode==CNSORT_DDEC);
+                         SortArray ( contact,ncontacts,CL );
+                       break;
+      default          : CK.mode = sortmode;
+                         RadixSort ( contact,ncontacts,CK );
+    }
+  }
+
+
+  //  -------------------  Contacts in CSR form  ------------------
+
+  void  CoorManager::SeekContacts ( PPAtom      AIndex1,
+                                    int         ilen1,
+                                    PPAtom      AIndex2,
+                                    int         ilen2,
+                                    realtype    dist1,
+                                    realtype    dist2,
+                                    int         seqDist,
+                                    RContactCSR csr,
+                                    bool        getDist )  {
+  //   Atoms of AIndex2 are bricked once; hits for every atom of
+  // AIndex1 are sorted so that rows are ordered by column.
+  BrickGrid grid;
+  PAtom     A;
+  ivector   hit;
+  realtype  d12,d22,d2;
+  int       i,j,k, nHits,nAlloc, seq1,seq2;
+
+    csr.StartRows ( IMax(0,ilen1),getDist );
+    if ((dist2<dist1) || (!AIndex1) || (!AIndex2) ||
+        (ilen1<=0) || (ilen2<=0))  {
+      for (i=0;i<ilen1;i++)
+        csr.EndRow ( i );
+      return;
+    }
+
+    grid.MakeGrid ( AIndex2,ilen2,0.0,RMax(dist2,2.0) );
+
+    d12    = dist1*dist1;
+    d22    = dist2*dist2;
+    hit    = NULL;
+    nAlloc = 0;
+
+    for (i=0;i<ilen1;i++)  {
+      A = AIndex1[i];
+      if (A)  {
+        if ((!A->Ter) && (A->WhatIsSet & ASET_Coordinates))  {
+          FindSeqSection ( A,seqDist,seq1,seq2 );
+          nHits = grid.GetShellAtoms ( A->x,A->y,A->z,dist1,dist2,
+                                       hit,nAlloc );
+          if (nHits>1)
+            SortArray ( hit,nHits );
+          for (k=0;k<nHits;k++)  {
+            j = hit[k];
+            if (AIndex2[j]!=A)  {
+              if (iContact(A,AIndex2[j],seq1,seq2,dist2,d12,d22,d2))
+                csr.AddContact ( j,sqrt(d2) );
+            }
+          }
+        }
+      }
+      csr.EndRow ( i );
+    }
+
+    FreeVectorMemory ( hit,0 );
+
   }
 
-  void QSortContacts::Swap ( int i, int j )  {
-    ((PContact)data)[i].Swap ( ((PContact)data)[j] );
+
+  //  -------------------  Distance matrices  ---------------------
+
+  //  columns of distance matrices are calculated in blocks of
+  //  DM_BlockSize, so that block coordinates stay in cache while
+  //  the rows are passed
+  #define DM_BlockSize  512
+
+  static void GetDMCoordinates ( PPAtom A, int n, rvector & x,
+                                 rvector & y, rvector & z,
+                                 bvector & valid )  {
+  int i;
+    GetVectorMemory ( x    ,n,0 );
+    GetVectorMemory ( y    ,n,0 );
+    GetVectorMemory ( z    ,n,0 );
+    GetVectorMemory ( valid,n,0 );
+    for (i=0;i<n;i++)  {
+      valid[i] = 0;
+      x[i] = 0.0;
+      y[i] = 0.0;
+      z[i] = 0.0;
+      if (A[i])  {
+        if ((!A[i]->Ter) && (A[i]->WhatIsSet & ASET_Coordinates))  {
+          x[i] = A[i]->x;
+          y[i] = A[i]->y;
+          z[i] = A[i]->z;
+          valid[i] = 1;
+        }
+      }
+    }
   }
 
+  static void FreeDMCoordinates ( rvector & x, rvector & y,
+                                  rvector & z, bvector & valid )  {
+    FreeVectorMemory ( x    ,0 );
+    FreeVectorMemory ( y    ,0 );
+    FreeVectorMemory ( z    ,0 );
+    FreeVectorMemory ( valid,0 );
+  }
+
+  static void GetDMRow ( int i, realtype xi, realtype yi, realtype zi,
+                         bool validi,
+                         rvector x, rvector y, rvector z,
+                         bvector valid, int j1, int j2, int band,
+                         bool doSqrt, rvector d )  {
+  //   Calculates distances (or square distances) from point i to
+  // points j1<=j<j2 into d[j-j1], setting -1 where the distance
+  // is not calculated. The main loop has no branches.
+  realtype dx,dy,dz;
+  int      j,k1,k2;
+
+    k1 = j1;
+    k2 = j2;
+    if (band>=0)  {
+      k1 = IMax ( j1,i-band   );
+      k2 = IMin ( j2,i+band+1 );
+    }
+    if ((!validi) || (k1>=k2))  {
+      for (j=j1;j<j2;j++)
+        d[j-j1] = -1.0;
+      return;
+    }
+
+    for (j=j1;j<k1;j++)
+      d[j-j1] = -1.0;
+    if (doSqrt)
+      for (j=k1;j<k2;j++)  {
+        dx = x[j] - xi;
+        dy = y[j] - yi;
+        dz = z[j] - zi;
+        d[j-j1] = sqrt(dx*dx + dy*dy + dz*dz);
+      }
+    else
+      for (j=k1;j<k2;j++)  {
+        dx = x[j] - xi;
+        dy = y[j] - yi;
+        dz = z[j] - zi;
+        d[j-j1] = dx*dx + dy*dy + dz*dz;
+      }
+    for (j=k1;j<k2;j++)
+      if (!valid[j])  d[j-j1] = -1.0;
+    for (j=k2;j<j2;j++)
+      d[j-j1] = -1.0;
 
-  void QSortContacts::Sort ( PContact contact, int ncontacts,
-                             int sortmode )  {
-    mode = sortmode;
-    if (mode!=CNSORT_OFF)
-      QuickSort::Sort ( &(contact[0]),ncontacts );
   }
 
+  void  CoorManager::GetDistanceMatrix ( PPAtom A1, int n1,
+                                         PPAtom A2, int n2,
+                                         rmatrix & D, int band )  {
+  rvector x1,y1,z1, x2,y2,z2;
+  bvector v1,v2;
+  int     i,j1,j2;
+
+    if ((!A1) || (!A2) || (n1<=0) || (n2<=0))  return;
+
+    if (!D)  GetMatrixMemory ( D,n1,n2,0,0 );
+
+    GetDMCoordinates ( A1,n1,x1,y1,z1,v1 );
+    GetDMCoordinates ( A2,n2,x2,y2,z2,v2 );
+
+    for (j1=0;j1<n2;j1+=DM_BlockSize)  {
+      j2 = IMin ( n2,j1+DM_BlockSize );
+      for (i=0;i<n1;i++)
+        GetDMRow ( i,x1[i],y1[i],z1[i],v1[i]!=0, x2,y2,z2,v2,
+                   j1,j2,band,true,&(D[i][j1]) );
+    }
+
+    FreeDMCoordinates ( x2,y2,z2,v2 );
+    FreeDMCoordinates ( x1,y1,z1,v1 );
+
+  }
+
+  void  CoorManager::GetDistanceMatrix ( PPAtom A1, int n1,
+                                         PPAtom A2, int n2,
+                                         shortreal * D, int band )  {
+  rvector x1,y1,z1, x2,y2,z2, d;
+  bvector v1,v2;
+  long    k;
+  int     i,j,j1,j2;
+
+    if ((!A1) || (!A2) || (!D) || (n1<=0) || (n2<=0))  return;
+
+    GetDMCoordinates ( A1,n1,x1,y1,z1,v1 );
+    GetDMCoordinates ( A2,n2,x2,y2,z2,v2 );
+    GetVectorMemory  ( d,DM_BlockSize,0 );
+
+    for (j1=0;j1<n2;j1+=DM_BlockSize)  {
+      j2 = IMin ( n2,j1+DM_BlockSize );
+      for (i=0;i<n1;i++)  {
+        GetDMRow ( i,x1[i],y1[i],z1[i],v1[i]!=0, x2,y2,z2,v2,
+                   j1,j2,band,true,d );
+        k = long(i)*n2 + j1;
+        for (j=j1;j<j2;j++)
+          D[k++] = shortreal(d[j-j1]);
+      }
+    }
+
+    FreeVectorMemory  ( d,0 );
+    FreeDMCoordinates ( x2,y2,z2,v2 );
+    FreeDMCoordinates ( x1,y1,z1,v1 );
+
+  }
+
+  void  CoorManager::GetContactMap ( PPAtom A1, int n1,
+                                     PPAtom A2, int n2,
+                                     realtype contDist, bmatrix & C,
+                                     int band )  {
+  rvector  x1,y1,z1, x2,y2,z2, d;
+  bvector  v1,v2;
+  realtype d2;
+  int      i,j,j1,j2;
+
+    if ((!A1) || (!A2) || (n1<=0) || (n2<=0))  return;
+
+    if (!C)  GetMatrixMemory ( C,n1,n2,0,0 );
+
+    GetDMCoordinates ( A1,n1,x1,y1,z1,v1 );
+    GetDMCoordinates ( A2,n2,x2,y2,z2,v2 );
+    GetVectorMemory  ( d,DM_BlockSize,0 );
+
+    d2 = contDist*contDist;
+    for (j1=0;j1<n2;j1+=DM_BlockSize)  {
+      j2 = IMin ( n2,j1+DM_BlockSize );
+      for (i=0;i<n1;i++)  {
+        GetDMRow ( i,x1[i],y1[i],z1[i],v1[i]!=0, x2,y2,z2,v2,
+                   j1,j2,band,false,d );
+        for (j=j1;j<j2;j++)
+          C[i][j] = ((d[j-j1]>=0.0) && (d[j-j1]<=d2));
+      }
+    }
+
+    FreeVectorMemory  ( d,0 );
+    FreeDMCoordinates ( x2,y2,z2,v2 );
+    FreeDMCoordinates ( x1,y1,z1,v1 );
+
+  }
+
+  void  CoorManager::StreamDistanceMatrix ( PPAtom A1, int n1,
+                                            PPAtom A2, int n2,
+                                            int tileSize,
+                                            PDistTileFunc Fnc,
+                                            void * UserData,
+                                            int band )  {
+  rvector x1,y1,z1, x2,y2,z2, tile;
+  bvector v1,v2;
+  int     i,i1,i2,j1,j2,w;
+
+    if ((!A1) || (!A2) || (!Fnc) || (n1<=0) || (n2<=0))  return;
+
+    if (tileSize<=0)  tileSize = DM_BlockSize;
+
+    GetDMCoordinates ( A1,n1,x1,y1,z1,v1 );
+    GetDMCoordinates ( A2,n2,x2,y2,z2,v2 );
+    GetVectorMemory  ( tile,long(tileSize)*tileSize,0 );
+
+    for (i1=0;i1<n1;i1+=tileSize)  {
+      i2 = IMin ( n1,i1+tileSize );
+      for (j1=0;j1<n2;j1+=tileSize)  {
+        j2 = IMin ( n2,j1+tileSize );
+        if (band>=0)  {
+          if ((j1>i2-1+band) || (j2-1<i1-band))  continue;
+        }
+        w = j2 - j1;
+        for (i=i1;i<i2;i++)
+          GetDMRow ( i,x1[i],y1[i],z1[i],v1[i]!=0, x2,y2,z2,v2,
+                     j1,j2,band,true,&(tile[(i-i1)*w]) );
+        (*Fnc) ( UserData,i1,i2,j1,j2,tile );
+      }
+    }
+
+    FreeVectorMemory  ( tile,0 );
+    FreeDMCoordinates ( x2,y2,z2,v2 );
+    FreeDMCoordinates ( x1,y1,z1,v1 );
+
+  }
+
+
+  //  -------------  Solvent accessible surface area  --------------
+
+  realtype CoorManager::CalcSASA ( int modelNo, realtype probeR,
+                                   int nPoints, int flags )  {
+  SurfaceArea SA;
+  PPAtom      A;
+  PAtom       atm;
+  PResidue    res;
+  rvector     x,y,z,r,area;
+  realtype    sasa,rarea;
+  int         i,k,m,n, atomUDD,resUDD;
+
+    if (nAtoms<=0)  return 0.0;
+
+    atomUDD = RegisterUDReal ( UDR_ATOM   ,"SASA" );
+    resUDD  = RegisterUDReal ( UDR_RESIDUE,"SASA" );
+
+    A = new PAtom[nAtoms];
+    GetVectorMemory ( x   ,nAtoms,0 );
+    GetVectorMemory ( y   ,nAtoms,0 );
+    GetVectorMemory ( z   ,nAtoms,0 );
+    GetVectorMemory ( r   ,nAtoms,0 );
+    GetVectorMemory ( area,nAtoms,0 );
+
+    SA.SetSpherePoints ( nPoints );
+
+    sasa = 0.0;
+    for (m=0;m<nModels;m++)
+      if (model[m])  {
+        if ((modelNo>0) && (model[m]->GetSerNum()!=modelNo))
+          continue;
+
+        //  clear areas left from previous calls, so that atoms and
+        //  residues left out of this calculation have no data
+        for (i=0;i<nAtoms;i++)  {
+          atm = atom[i];
+          if (!atm)  continue;
+          if (atm->GetModel()!=model[m])  continue;
+          if (atm->GetUDData(atomUDD,rarea)==UDDATA_Ok)
+            atm->PutUDData ( atomUDD,-MaxReal );
+          res = atm->GetResidue();
+          if (res)  {
+            if (res->GetUDData(resUDD,rarea)==UDDATA_Ok)
+              res->PutUDData ( resUDD,-MaxReal );
+          }
+        }
+
+        n = 0;
+        for (i=0;i<nAtoms;i++)  {
+          atm = atom[i];
+          if (!atm)  continue;
+          if (atm->Ter || (!(atm->WhatIsSet & ASET_Coordinates)))
+            continue;
+          if (atm->GetModel()!=model[m])  continue;
+          if ((!(flags & SASA_Hydrogens)) &&
+              atm->isHydrogen())  continue;
+          if ((!(flags & SASA_Waters)) && atm->isSolvent())
+            continue;
+          A[n] = atm;
+          x[n] = atm->x;
+          y[n] = atm->y;
+          z[n] = atm->z;
+          r[n] = getVdWaalsRadius(atm->GetElementNo()) + probeR;
+          n++;
+        }
+        if (n<=0)  continue;
+
+        SA.SetSpheres ( x,y,z,r,n );
+        SA.GetAreas   ( area,0,n );
+
+        for (k=0;k<n;k++)  {
+          A[k]->PutUDData ( atomUDD,area[k] );
+          res = A[k]->GetResidue();
+          if (res)  res->PutUDData ( resUDD,0.0 );
+          sasa += area[k];
+        }
+        for (k=0;k<n;k++)  {
+          res = A[k]->GetResidue();
+          if (res)  {
+            res->GetUDData ( resUDD,rarea );
+            res->PutUDData ( resUDD,rarea+area[k] );
+          }
+        }
+
+      }
+
+    FreeVectorMemory ( area,0 );
+    FreeVectorMemory ( r   ,0 );
+    FreeVectorMemory ( z   ,0 );
+    FreeVectorMemory ( y   ,0 );
+    FreeVectorMemory ( x   ,0 );
+    delete[] A;
+
+    return sasa;
 
-  void  SortContacts ( PContact contact, int ncontacts,
-                       CNSORT_DIR sortmode )  {
-  QSortContacts SC;
-    if (sortmode!=CNSORT_OFF)
-      SC.Sort ( contact,ncontacts,sortmode );
   }
 
 
@@ -4085,9 +5075,8 @@ namespace mmdb  {
 
   int  SuperposeAtoms ( mat44 & T, PPAtom A1, int nA, PPAtom A2,
                         ivector C )  {
-  realtype xc1,yc1,zc1, xc2,yc2,zc2, det,B;
-  rmatrix  A,U,V;
-  rvector  W,RV1;
+  realtype xc1,yc1,zc1, xc2,yc2,zc2, E0,lambda;
+  mat33    A,R;
   vect3    vc1,vc2;
   int      i,j,k,i1,i2,nat;
 
@@ -4160,11 +5149,10 @@ namespace mmdb  {
 
     //  3.  Calculate the correlation matrix
 
-    GetMatrixMemory ( A,3,3,1,1 );
-
-    for (i=1;i<=3;i++)
-      for (j=1;j<=3;j++)
+    for (i=0;i<3;i++)
+      for (j=0;j<3;j++)
         A[i][j] = 0.0;
+    E0 = 0.0;
 
     if (C)  {
 
@@ -4178,9 +5166,11 @@ namespace mmdb  {
             vc2[0] = A2[i2]->x - xc2;
             vc2[1] = A2[i2]->y - yc2;
             vc2[2] = A2[i2]->z - zc2;
-            for (i=1;i<=3;i++)
-              for (j=1;j<=3;j++)
-                A[i][j] += vc1[j-1]*vc2[i-1];
+            for (i=0;i<3;i++)  {
+              for (j=0;j<3;j++)
+                A[i][j] += vc1[j]*vc2[i];
+              E0 += vc1[i]*vc1[i] + vc2[i]*vc2[i];
+            }
           }
         }
 
@@ -4194,81 +5184,33 @@ namespace mmdb  {
           vc2[0] = A2[k]->x - xc2;
           vc2[1] = A2[k]->y - yc2;
           vc2[2] = A2[k]->z - zc2;
-          for (i=1;i<=3;i++)
-            for (j=1;j<=3;j++)
-              A[i][j] += vc1[j-1]*vc2[i-1];
+          for (i=0;i<3;i++)  {
+            for (j=0;j<3;j++)
+              A[i][j] += vc1[j]*vc2[i];
+            E0 += vc1[i]*vc1[i] + vc2[i]*vc2[i];
+          }
         }
 
     }
 
 
-    //  4. Calculate transformation matrix (to be applied to A1)
-
-    det = A[1][1]*A[2][2]*A[3][3] +
-          A[1][2]*A[2][3]*A[3][1] +
-          A[2][1]*A[3][2]*A[1][3] -
-          A[1][3]*A[2][2]*A[3][1] -
-          A[1][1]*A[2][3]*A[3][2] -
-          A[3][3]*A[1][2]*A[2][1];
-
-    //  4.1 SV-decompose the correlation matrix
-
-    GetMatrixMemory ( U  ,3,3,1,1 );
-    GetMatrixMemory ( V  ,3,3,1,1 );
-    GetVectorMemory ( W  ,3,1 );
-    GetVectorMemory ( RV1,3,1 );
+    //  4. Calculate rotational part of T (to be applied to A1) by
+    //     the quaternion method
 
-    math::SVD ( 3,3,3,A,U,V,W,RV1,true,true,i );
-
-    if (i!=0)  {
-      FreeVectorMemory ( RV1,1 );
-      FreeVectorMemory ( W  ,1 );
-      FreeMatrixMemory ( V  ,3,1,1 );
-      FreeMatrixMemory ( U  ,3,1,1 );
-      FreeMatrixMemory ( A  ,3,1,1 );
+    if (math::QCPRotation(A,E0/2.0,R,lambda)!=math::QCP_Ok)
       return SPOSEAT_SVD_Fail;
-    }
-
-    //  4.2 Check for parasite inversion and fix it if found
-
-    if (det<=0.0)  {
-      k = 0;
-      B = MaxReal;
-      for (j=1;j<=3;j++)
-        if (W[j]<B)  {
-          B = W[j];
-          k = j;
-        }
-      for (j=1;j<=3;j++)
-        V[j][k] = -V[j][k];
-    }
-
-    //  4.3 Calculate rotational part of T
 
-    for (j=1;j<=3;j++)
-      for (k=1;k<=3;k++)  {
-        B = 0.0;
-        for (i=1;i<=3;i++)
-          B += U[j][i]*V[k][i];
-        T[j-1][k-1] = B;
-      }
+    for (i=0;i<3;i++)
+      for (j=0;j<3;j++)
+        T[i][j] = R[i][j];
 
 
-    //  4.4 Add translational part to T
+    //  5. Add translational part to T
 
     T[0][3] = xc2 - T[0][0]*xc1 - T[0][1]*yc1 - T[0][2]*zc1;
     T[1][3] = yc2 - T[1][0]*xc1 - T[1][1]*yc1 - T[1][2]*zc1;
     T[2][3] = zc2 - T[2][0]*xc1 - T[2][1]*yc1 - T[2][2]*zc1;
 
-
-    //  5. Release memory and quit
-
-    FreeVectorMemory ( RV1,1 );
-    FreeVectorMemory ( W  ,1 );
-    FreeMatrixMemory ( V  ,3,1,1 );
-    FreeMatrixMemory ( U  ,3,1,1 );
-    FreeMatrixMemory ( A  ,3,1,1 );
-
     return SPOSEAT_Ok;
 
   }
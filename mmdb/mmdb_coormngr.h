@@ -31,7 +31,10 @@
 //       Project :  MacroMolecular Data Base (MMDB)
 //       ~~~~~~~~~
 //  **** Classes :  mmdb::Brick       ( space brick                  )
-//       ~~~~~~~~~  mmdb::CoorManager ( MMDB atom coordinate manager )
+//       ~~~~~~~~~  mmdb::BrickGrid   ( flat persistent brick grid   )
+//                  mmdb::ContactCSR  ( contacts in CSR form         )
+//                  mmdb::SurfaceArea ( Shrake-Rupley surface areas  )
+//                  mmdb::CoorManager ( MMDB atom coordinate manager )
 //
 //  (C) E. Krissinel 2000-2013
 //
@@ -107,6 +110,146 @@ namespace mmdb  {
   };
 
 
+  // ==========================  BrickGrid  ===========================
+
+  //    BrickGrid is a persistent spatial index over an array of atoms.
+  //  Unlike Brick, which allocates an object per brick, BrickGrid
+  //  keeps all bricked atoms in flat vectors ordered brick by brick:
+  //  atoms of brick (nx,ny,nz) occupy positions cell[n]..cell[n+1]-1,
+  //  n = (nx*nby+ny)*nbz+nz, in vectors id (indices of atoms in the
+  //  bricked array) and x,y,z (their coordinates at the time of
+  //  bricking). Ter atoms and atoms without coordinates are not
+  //  bricked. The grid does not own the atoms and does not follow
+  //  their changes: callers must remake it after atoms are moved,
+  //  added or deleted.
+
+  DefineClass(BrickGrid);
+
+  class BrickGrid  {
+
+    public :
+      PPAtom   atom;      // bricked atom array (not owned)
+      int      nAtoms;    // length of the bricked atom or point array
+      int      nGridded;  // number of atoms put into bricks
+      ivector  id;        // [0..nGridded-1] indices of atoms in atom[]
+      rvector  x,y,z;     // [0..nGridded-1] coordinates of atoms
+      ivector  cell;      // [0..nbx*nby*nbz] brick offsets in id,x,y,z
+      realtype size;      // brick size in angstroms
+      realtype x0,y0,z0;  // origin of brick (0,0,0)
+      int      nbx,nby,nbz; // grid dimensions
+
+      BrickGrid ();
+      ~BrickGrid();
+
+      void  FreeMemory();
+      bool  isReady   ()  { return (cell!=NULL); }
+
+      void  MakeGrid  ( PPAtom atmvec, int avlen,
+                        realtype Margin, realtype BrickSize=6.0 );
+
+      //   This MakeGrid(..) bricks n points with coordinates
+      // (ax[i],ay[i],az[i]) rather than atoms; then atom is NULL and
+      // id refers to the point numbers.
+      void  MakeGrid  ( rvector ax, rvector ay, rvector az, int n,
+                        realtype Margin, realtype BrickSize=6.0 );
+
+      //   GetBrickRange(..) returns ranges nx1<=nx<nx2, ny1<=ny<ny2,
+      // nz1<=nz<nz2 of bricks overlapping with the given box. The
+      // ranges are empty (nx1>=nx2 etc.) if the box is off the grid.
+      void  GetBrickRange ( realtype xmin, realtype ymin, realtype zmin,
+                            realtype xmax, realtype ymax, realtype zmax,
+                            int & nx1, int & ny1, int & nz1,
+                            int & nx2, int & ny2, int & nz2 );
+
+      //   GetShellAtoms(..) appends indices (in atom[]) of all bricked
+      // atoms found on distance d1<=d<=d2 from point (xc,yc,zc) to
+      // vector hit, starting from position nHits. The vector is
+      // (re)allocated as necessary, nAlloc keeping its allocated
+      // length between the calls. Returns the total number of hits.
+      int   GetShellAtoms  ( realtype xc, realtype yc, realtype zc,
+                             realtype d1, realtype d2,
+                             ivector & hit, int & nAlloc, int nHits=0 );
+      int   GetSphereAtoms ( realtype xc, realtype yc, realtype zc,
+                             realtype r,
+                             ivector & hit, int & nAlloc, int nHits=0 )
+        { return GetShellAtoms ( xc,yc,zc,0.0,r,hit,nAlloc,nHits ); }
+
+      //   GetCylinderAtoms(..) and GetSlabAtoms(..) work as
+      // GetShellAtoms(..) for atoms found within distance r from
+      // the segment (x1,y1,z1)-(x2,y2,z2) (excluding the caps), and
+      // from the plane a*x+b*y+c*z=d, respectively.
+      int   GetCylinderAtoms ( realtype x1, realtype y1, realtype z1,
+                               realtype x2, realtype y2, realtype z2,
+                               realtype r,
+                               ivector & hit, int & nAlloc, int nHits=0 );
+      int   GetSlabAtoms     ( realtype a,  realtype b,  realtype c,
+                               realtype d,  realtype r,
+                               ivector & hit, int & nAlloc, int nHits=0 );
+
+    protected :
+      void  InitBrickGrid();
+      void  PutPoints    ( rvector ax, rvector ay, rvector az,
+                           bvector use, int n,
+                           realtype Margin, realtype BrickSize );
+
+  };
+
+  //   AddHit(..) appends value n to vector hit[0..nHits-1], which is
+  // reallocated if nHits reaches its allocated length nAlloc.
+  extern void AddHit ( ivector & hit, int & nAlloc, int & nHits, int n );
+
+
+  // =========================  SurfaceArea  ==========================
+
+  //    SurfaceArea calculates solvent accessible surface areas of
+  //  spheres by the Shrake-Rupley method: a set of nPoints points is
+  //  evenly spread over each sphere, and the area is proportional to
+  //  the number of points not buried in the neighbouring spheres.
+  //  Radii given in SetSpheres(..) should include the probe radius.
+  //  Neighbours are found with a BrickGrid built once for all
+  //  spheres; GetAreas(..) does not change the object and may be
+  //  called concurrently for different ranges of spheres.
+
+  DefineClass(SurfaceArea);
+
+  class SurfaceArea  {
+
+    public :
+
+      SurfaceArea ();
+      ~SurfaceArea();
+
+      void  FreeMemory();
+
+      //   SetSpherePoints(..) makes the unit sphere point set. It
+      // is called with the default number of points on
+      // construction.
+      void  SetSpherePoints ( int nPoints );
+      int   GetNofSpherePoints()  { return nPts; }
+
+      //   SetSpheres(..) copies n sphere centres and radii and
+      // bricks them.
+      void  SetSpheres ( rvector x, rvector y, rvector z, rvector r,
+                         int n );
+
+      //   GetAreas(..) calculates accessible areas of spheres
+      // i1<=i<i2 into area[i].
+      void  GetAreas   ( rvector area, int i1, int i2 );
+
+    protected :
+      rvector   px,py,pz;   // unit sphere points
+      int       nPts;       // number of sphere points
+      rvector   sx,sy,sz;   // sphere centres
+      rvector   sr;         // sphere radii
+      int       nSpheres;   // number of spheres
+      realtype  rmax;       // maximal sphere radius
+      BrickGrid grid;       // bricked sphere centres
+
+      void  InitSurfaceArea();
+
+  };
+
+
 
   //  ====================  GenSym  ========================
 
@@ -188,6 +331,57 @@ namespace mmdb  {
   extern void DeleteMContacts ( PPMContact & mcontact, int nContacts );
 
 
+  // ========================  ContactCSR  ===========================
+
+  //    ContactCSR keeps contacts in compressed sparse row form:
+  //  contacts of atom i of the 1st index are with atoms col[k] of
+  //  the 2nd index, row[i]<=k<row[i+1], in ascending order of col[k];
+  //  dist[k] are the corresponding distances, if requested. Storage
+  //  may be preallocated with Reserve(..); with fixedSize set, it is
+  //  never reallocated and contacts which do not fit are dropped,
+  //  which is signalled by the overflow flag.
+
+  DefineClass(ContactCSR);
+
+  class ContactCSR  {
+
+    friend class CoorManager;
+
+    public :
+      int         nRows;      // number of rows (atoms in 1st index)
+      int         nContacts;  // number of contacts
+      ivector     row;        // [0..nRows] row offsets
+      ivector     col;        // [0..nContacts-1] 2nd index atoms
+      shortreal * dist;       // [0..nContacts-1] distances or NULL
+      bool        overflow;   // contacts dropped in fixed size mode
+
+      ContactCSR ();
+      ~ContactCSR();
+
+      void  FreeMemory();
+
+      //   Reserve(..) makes room for at least maxContacts contacts
+      // with distances if withDist is true. If fixedSize is true,
+      // the storage will not be reallocated when filled.
+      void  Reserve ( int maxContacts, bool withDist=true,
+                      bool fixedSize=false );
+
+      int   GetNofNeighbours ( int i )  { return row[i+1]-row[i]; }
+
+    protected :
+      int   nRowsAlloc;
+      int   nAlloc;
+      bool  fixed;
+      bool  useDist;
+
+      void  InitContactCSR();
+      void  StartRows ( int n, bool withDist );
+      void  AddContact ( int j, realtype d );
+      void  EndRow     ( int i );
+
+  };
+
+
   // ======================  CoorManager  =========================
 
   DefineClass(CoorManager);
@@ -211,6 +405,19 @@ namespace mmdb  {
     GSM_NoCell           = 3
   };
 
+  //  ----  distance matrix tile function for StreamDistanceMatrix(..)
+  //  The tile contains distances between atoms i1<=i<i2 of the 1st
+  //  set and j1<=j<j2 of the 2nd set as tile[(i-i1)*(j2-j1)+(j-j1)].
+  typedef void DistTileFunc ( void * UserData, int i1, int i2,
+                              int j1, int j2, rvector tile );
+  typedef DistTileFunc * PDistTileFunc;
+
+  //  ----  CalcSASA(..) flags
+  enum SASA_FLAG  {
+    SASA_Hydrogens = 0x00000001,  // include hydrogens
+    SASA_Waters    = 0x00000002   // include solvent molecules
+  };
+
   class CoorManager : public Root  {
 
     public :
@@ -584,6 +791,11 @@ namespace mmdb  {
                 realtype   xorth, realtype   yorth, realtype   zorth,
                 realtype & xfrac, realtype & yfrac, realtype & zfrac );
 
+      //   These Frac2Orth(..) and Orth2Frac(..) transform n points
+      // (x[i],y[i],z[i]), i=0..n-1, in place.
+      bool Frac2Orth ( rvector x, rvector y, rvector z, int n );
+      bool Orth2Frac ( rvector x, rvector y, rvector z, int n );
+
 
       //   Below, F and T are transformation matrices in fractional and
       // orthogonal coordinates, respectively.
@@ -807,6 +1019,84 @@ namespace mmdb  {
                                     // change
                          );
 
+
+      //  ---------------  Distance matrices  ---------------------
+
+      //   GetDistanceMatrix(..) calculates distances D[i][j] between
+      // atoms A1[i] and A2[j]. D is allocated as [0..n1-1][0..n2-1]
+      // if it is NULL on input, otherwise it should be allocated by
+      // the application. If band>=0, only distances with
+      // |i-j|<=band are calculated. Distances not calculated and
+      // those involving NULL pointers, Ter atoms or atoms without
+      // coordinates are set to -1.
+      void  GetDistanceMatrix ( PPAtom A1, int n1, PPAtom A2, int n2,
+                                rmatrix & D, int band=-1 );
+
+      //   Same as above, but returns single precision distances in
+      // vector D[i*n2+j] of length n1*n2 allocated by the
+      // application.
+      void  GetDistanceMatrix ( PPAtom A1, int n1, PPAtom A2, int n2,
+                                shortreal * D, int band=-1 );
+
+      //   GetContactMap(..) sets C[i][j] to 1 if atoms A1[i] and
+      // A2[j] are within distance contDist, and to 0 otherwise.
+      // C is allocated and band is used as in GetDistanceMatrix(..).
+      void  GetContactMap ( PPAtom A1, int n1, PPAtom A2, int n2,
+                            realtype contDist, bmatrix & C,
+                            int band=-1 );
+
+      //   StreamDistanceMatrix(..) calculates the distance matrix
+      // in tiles of up to tileSize x tileSize distances and passes
+      // them to function Fnc one by one, so that the whole matrix
+      // is never kept in memory. Tiles lying completely outside the
+      // band are not passed.
+      void  StreamDistanceMatrix ( PPAtom A1, int n1,
+                                   PPAtom A2, int n2,
+                                   int tileSize, PDistTileFunc Fnc,
+                                   void * UserData, int band=-1 );
+
+
+      //  ---------------  Solvent accessible surface  ------------
+
+      //   CalcSASA(..) calculates solvent accessible surface areas
+      // of atoms of model modelNo (all models, each one separately,
+      // if modelNo<=0), using van der Waals radii from mmdb_tables
+      // and probe radius probeR. Hydrogens and solvent molecules are
+      // not considered unless requested by SASA_FLAG flags.
+      //   Areas are stored as real user-defined data named "SASA"
+      // in atoms (UDR_ATOM) and residues (UDR_RESIDUE, sum over
+      // residue atoms); UDD handles may be then obtained with
+      // GetUDDHandle(..). Atoms and residues left out of the
+      // calculation get no data. Returns the total area.
+      realtype CalcSASA ( int modelNo=0, realtype probeR=1.4,
+                          int nPoints=200, int flags=0 );
+
+      //   This version of SeekContacts(..) returns contacts between
+      // atoms of AIndex1 and AIndex2 in CSR form; the meaning of
+      // dist1, dist2 and seqDist is the same as above. Storage in
+      // csr is reused and, if csr was preallocated with fixedSize
+      // set, not reallocated. Distances are returned only if
+      // getDist is true.
+      void  SeekContacts (
+               PPAtom       AIndex1,  //  1st atom index [0..ilen1-1]
+               int          ilen1,    //  length of 1st index
+               PPAtom       AIndex2,  //  2nd atom index [0..ilen2-1]
+               int          ilen2,    //  length of 2nd index
+               realtype     dist1,    //  minimal contact distance
+               realtype     dist2,    //  maximal contact distance
+               int          seqDist,  //  the sequence distance to neglect
+               RContactCSR  csr,      //  resulting contacts
+               bool         getDist=true
+                         );
+
+      //   CoordinatesMoved() is called after the manager has moved
+      // atoms in place (ApplyTransform(), BringToUnitCell() etc.), so
+      // that derived classes may drop their spatial indices. Code
+      // that puts new coordinates into all atoms of the manager at
+      // once, such as CoordBlock::PutCoordinates(..), should call it
+      // as well.
+      virtual void CoordinatesMoved() {}
+
     protected :
 
       //  bricks
@@ -929,7 +1219,8 @@ namespace mmdb  {
   //   If vector C is given, then the correspondence of atoms is
   // established as A1[i] <-> A2[C[i]] only for those i that C[i]>=0.
   // The default option (C==NULL) is thus identical to C[i]==i, 0<=i<nA.
-  //   Upon normal completion, the procedure returns SPOSEAT_Ok.
+  //   Upon normal completion, the procedure returns SPOSEAT_Ok. The
+  // rotation is found by the quaternion method (mmdb_math_superpose.h).
 
   extern int SuperposeAtoms ( mat44 & T, PPAtom A1, int nA, PPAtom A2,
                               ivector C=NULL );
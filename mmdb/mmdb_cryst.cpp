@@ -1394,33 +1394,35 @@ namespace mmdb  {
   bool Cryst::Frac2Orth (
                 realtype x,    realtype y,    realtype z,
                 realtype & xx, realtype & yy, realtype & zz ) {
-    if (areMatrices())  {
-      xx = RO[0][0]*x + RO[0][1]*y + RO[0][2]*z + RO[0][3];
-      yy = RO[1][0]*x + RO[1][1]*y + RO[1][2]*z + RO[1][3];
-      zz = RO[2][0]*x + RO[2][1]*y + RO[2][2]*z + RO[2][3];
-      return true;
-    } else  {
-      xx = x;
-      yy = y;
-      zz = z;
-      return false;
-    }
+    xx = x;
+    yy = y;
+    zz = z;
+    return Frac2Orth ( &xx,&yy,&zz,1 );
   }
 
   bool Cryst::Orth2Frac (
                 realtype x,    realtype y,    realtype z,
                 realtype & xx, realtype & yy, realtype & zz ) {
+    xx = x;
+    yy = y;
+    zz = z;
+    return Orth2Frac ( &xx,&yy,&zz,1 );
+  }
+
+  bool Cryst::Frac2Orth ( rvector x, rvector y, rvector z, int n )  {
     if (areMatrices())  {
-      xx = RF[0][0]*x + RF[0][1]*y + RF[0][2]*z + RF[0][3];
-      yy = RF[1][0]*x + RF[1][1]*y + RF[1][2]*z + RF[1][3];
-      zz = RF[2][0]*x + RF[2][1]*y + RF[2][2]*z + RF[2][3];
+      Mat4Transform ( RO,x,y,z,n );
+      return true;
+    }
+    return false;
+  }
+
+  bool Cryst::Orth2Frac ( rvector x, rvector y, rvector z, int n )  {
+    if (areMatrices())  {
+      Mat4Transform ( RF,x,y,z,n );
       return true;
-    } else  {
-      xx = x;
-      yy = y;
-      zz = z;
-      return false;
     }
+    return false;
   }
 
 
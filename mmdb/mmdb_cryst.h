@@ -323,6 +323,12 @@ namespace mmdb  {
                 realtype x,    realtype y,    realtype z,
                 realtype & xx, realtype & yy, realtype & zz );
 
+      //   These Frac2Orth(..) and Orth2Frac(..) transform n points
+      // (x[i],y[i],z[i]), i=0..n-1, in place, with same results as
+      // the above functions applied point by point.
+      bool Frac2Orth ( rvector x, rvector y, rvector z, int n );
+      bool Orth2Frac ( rvector x, rvector y, rvector z, int n );
+
       //   Below, F and T are transformation matrices in fractional and
       // orthogonal coordinates, respectively.
       bool Frac2Orth ( mat44 & F, mat44 & T );
@@ -0,0 +1,371 @@
+//  $Id: mmdb_interact.cpp $
+//  =================================================================
+//
+//   CCP4 Coordinate Library: support of coordinate-related
+//   functionality in protein crystallography applications.
+//
+//   Copyright (C) The MMDB contributors 2026.
+//
+//    This library is free software: you can redistribute it and/or
+//    modify it under the terms of the GNU Lesser General Public
+//    License version 3, modified in accordance with the provisions
+//    of the license to address the requirements of UK law.
+//
+//    You should have received a copy of the modified GNU Lesser
+//    General Public License along with this library. If not, copies
+//    may be downloaded from http://www.ccp4.ac.uk/ccp4license.php
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//  =================================================================
+//
+//    18.10.26   <--  Date of Last Modification.
+//                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  -----------------------------------------------------------------
+//
+//  **** Module  :  mmdb_interact <implementation>
+//       ~~~~~~~~~
+//       Project :  MacroMolecular Data Base (MMDB)
+//       ~~~~~~~~~
+//  **** Classes :  mmdb::Interaction       ( typed atom interaction  )
+//       ~~~~~~~~~  mmdb::InteractionFinder ( H-bonds and salt bridges )
+//
+//  (C) The MMDB contributors 2026
+//
+//  =================================================================
+//
+
+#include <math.h>
+#include <string.h>
+
+#include "mmdb_interact.h"
+#include "mmdb_tables.h"
+
+namespace mmdb  {
+
+  // ====================  InteractionFinder  =======================
+
+  //  flag of polar atoms having an antecedent
+  #define  PATOM_Antecedent  0x0100
+
+  //  number of candidate pairs checked in one batch
+  #define  InteractionBatch  256
+
+  //  maximal distance between a polar atom and its antecedent
+  #define  AntecedentDist2   3.61
+
+  InteractionFinder::InteractionFinder()  {
+    InitInteractionFinder();
+  }
+
+  InteractionFinder::~InteractionFinder()  {
+    FreeMemory();
+  }
+
+  void  InteractionFinder::InitInteractionFinder()  {
+    hbDist   = 3.5;
+    sbDist   = 4.0;
+    minAngle = 90.0;
+    types    = INTERACT_All;
+    pid1     = NULL;
+    pid2     = NULL;
+    flag1    = NULL;
+    flag2    = NULL;
+    x1       = NULL;
+    y1       = NULL;
+    z1       = NULL;
+    ax1      = NULL;
+    ay1      = NULL;
+    az1      = NULL;
+    x2       = NULL;
+    y2       = NULL;
+    z2       = NULL;
+    ax2      = NULL;
+    ay2      = NULL;
+    az2      = NULL;
+    np1      = 0;
+    np2      = 0;
+    nAlloc1  = 0;
+    nAlloc2  = 0;
+    bi       = NULL;
+    bj       = NULL;
+    bd2      = NULL;
+    bok      = NULL;
+  }
+
+  void  InteractionFinder::FreeMemory()  {
+    FreeVectorMemory ( pid1 ,0 );
+    FreeVectorMemory ( pid2 ,0 );
+    FreeVectorMemory ( flag1,0 );
+    FreeVectorMemory ( flag2,0 );
+    FreeVectorMemory ( x1   ,0 );
+    FreeVectorMemory ( y1   ,0 );
+    FreeVectorMemory ( z1   ,0 );
+    FreeVectorMemory ( ax1  ,0 );
+    FreeVectorMemory ( ay1  ,0 );
+    FreeVectorMemory ( az1  ,0 );
+    FreeVectorMemory ( x2   ,0 );
+    FreeVectorMemory ( y2   ,0 );
+    FreeVectorMemory ( z2   ,0 );
+    FreeVectorMemory ( ax2  ,0 );
+    FreeVectorMemory ( ay2  ,0 );
+    FreeVectorMemory ( az2  ,0 );
+    FreeVectorMemory ( bi   ,0 );
+    FreeVectorMemory ( bj   ,0 );
+    FreeVectorMemory ( bd2  ,0 );
+    FreeVectorMemory ( bok  ,0 );
+    np1     = 0;
+    np2     = 0;
+    nAlloc1 = 0;
+    nAlloc2 = 0;
+    grid.FreeMemory();
+  }
+
+  int  InteractionFinder::GetPolarAtoms ( PPAtom A, int n,
+                          ivector & pid, ivector & flag,
+                          rvector & x,  rvector & y,  rvector & z,
+                          rvector & ax, rvector & ay, rvector & az,
+                          int & nAlloc )  {
+  //  Collects polar atoms of A relevant for the interaction types
+  //  looked for, and finds their antecedents
+  PResidue res;
+  PAtom    a,b;
+  realtype dx,dy,dz, d2,d2min;
+  int      i,j,f,mask,np;
+
+    if (n>nAlloc)  {
+      FreeVectorMemory ( pid ,0 );
+      FreeVectorMemory ( flag,0 );
+      FreeVectorMemory ( x   ,0 );
+      FreeVectorMemory ( y   ,0 );
+      FreeVectorMemory ( z   ,0 );
+      FreeVectorMemory ( ax  ,0 );
+      FreeVectorMemory ( ay  ,0 );
+      FreeVectorMemory ( az  ,0 );
+      GetVectorMemory  ( pid ,n,0 );
+      GetVectorMemory  ( flag,n,0 );
+      GetVectorMemory  ( x   ,n,0 );
+      GetVectorMemory  ( y   ,n,0 );
+      GetVectorMemory  ( z   ,n,0 );
+      GetVectorMemory  ( ax  ,n,0 );
+      GetVectorMemory  ( ay  ,n,0 );
+      GetVectorMemory  ( az  ,n,0 );
+      nAlloc = n;
+    }
+
+    mask = 0;
+    if (types & INTERACT_HBond)
+      mask |= PATOM_Donor | PATOM_Acceptor;
+    if (types & INTERACT_SaltBridge)
+      mask |= PATOM_Cation | PATOM_Anion;
+
+    np = 0;
+    for (i=0;i<n;i++)  {
+      a = A[i];
+      if (!a)  continue;
+      res = a->residue;
+      if ((!res) || a->Ter || (!(a->WhatIsSet & ASET_Coordinates)))
+        continue;
+      f = getPolarAtomType ( res->name,a->name,a->element ) & mask;
+      if (!f)  continue;
+      pid[np] = i;
+      x  [np] = a->x;
+      y  [np] = a->y;
+      z  [np] = a->z;
+      ax [np] = a->x;
+      ay [np] = a->y;
+      az [np] = a->z;
+      if (f & (PATOM_Donor | PATOM_Acceptor))  {
+        d2min = AntecedentDist2;
+        for (j=0;j<res->nAtoms;j++)  {
+          b = res->atom[j];
+          if (b && (b!=a) && (!b->Ter) &&
+              (b->WhatIsSet & ASET_Coordinates) &&
+              (!b->isHydrogen()) && a->isAltLocMatch(b))  {
+            dx = b->x - a->x;
+            dy = b->y - a->y;
+            dz = b->z - a->z;
+            d2 = dx*dx + dy*dy + dz*dz;
+            if (d2<=d2min)  {
+              d2min  = d2;
+              ax[np] = b->x;
+              ay[np] = b->y;
+              az[np] = b->z;
+              f     |= PATOM_Antecedent;
+            }
+          }
+        }
+      }
+      flag[np] = f;
+      np++;
+    }
+
+    return np;
+
+  }
+
+  void  InteractionFinder::CheckBatch ( int nb, RPInteraction inter,
+                                        int & nInter, int & nIAlloc )  {
+  PInteraction I1;
+  realtype     dx,dy,dz, ux,uy,uz, u2,v2, cosMin, hb2,sb2;
+  int          i,j,k,m, f1,f2, type,donor;
+
+    //  distances
+    for (k=0;k<nb;k++)  {
+      i  = bi[k];
+      j  = bj[k];
+      dx = x2[j] - x1[i];
+      dy = y2[j] - y1[i];
+      dz = z2[j] - z1[i];
+      bd2[k] = dx*dx + dy*dy + dz*dz;
+    }
+
+    //  angles at atoms of the 1st and 2nd vectors
+    cosMin = cos ( minAngle*Pi/180.0 );
+    for (k=0;k<nb;k++)  {
+      i  = bi[k];
+      j  = bj[k];
+      dx = x2[j] - x1[i];
+      dy = y2[j] - y1[i];
+      dz = z2[j] - z1[i];
+      bok[k] = true;
+      if (flag1[i] & PATOM_Antecedent)  {
+        ux = ax1[i] - x1[i];
+        uy = ay1[i] - y1[i];
+        uz = az1[i] - z1[i];
+        u2 = ux*ux + uy*uy + uz*uz;
+        v2 = bd2[k];
+        if (ux*dx+uy*dy+uz*dz>cosMin*sqrt(u2*v2))  bok[k] = false;
+      }
+      if (flag2[j] & PATOM_Antecedent)  {
+        ux = ax2[j] - x2[j];
+        uy = ay2[j] - y2[j];
+        uz = az2[j] - z2[j];
+        u2 = ux*ux + uy*uy + uz*uz;
+        v2 = bd2[k];
+        if (-(ux*dx+uy*dy+uz*dz)>cosMin*sqrt(u2*v2))  bok[k] = false;
+      }
+    }
+
+    //  classify
+    hb2 = hbDist*hbDist;
+    sb2 = sbDist*sbDist;
+    for (k=0;k<nb;k++)  {
+      i     = bi[k];
+      j     = bj[k];
+      f1    = flag1[i];
+      f2    = flag2[j];
+      type  = 0;
+      donor = 0;
+      if ((types & INTERACT_HBond) && bok[k] && (bd2[k]<=hb2))  {
+        if ((f1 & PATOM_Donor) && (f2 & PATOM_Acceptor))  donor |= 1;
+        if ((f2 & PATOM_Donor) && (f1 & PATOM_Acceptor))  donor |= 2;
+        if (donor)  type |= INTERACT_HBond;
+      }
+      if ((types & INTERACT_SaltBridge) && (bd2[k]<=sb2) &&
+          (((f1 & PATOM_Cation) && (f2 & PATOM_Anion)) ||
+           ((f1 & PATOM_Anion)  && (f2 & PATOM_Cation))))
+        type |= INTERACT_SaltBridge;
+      if (type)  {
+        if (nInter>=nIAlloc)  {
+          nIAlloc = 2*nIAlloc + InteractionBatch;
+          I1 = new Interaction[nIAlloc];
+          if (inter)  {
+            for (m=0;m<nInter;m++)
+              I1[m] = inter[m];
+            delete[] inter;
+          }
+          inter = I1;
+        }
+        inter[nInter].id1   = pid1[i];
+        inter[nInter].id2   = pid2[j];
+        inter[nInter].type  = type;
+        inter[nInter].donor = donor;
+        inter[nInter].dist  = sqrt(bd2[k]);
+        nInter++;
+      }
+    }
+
+  }
+
+  int  InteractionFinder::SeekInteractions ( PPAtom A1, int n1,
+                                             PPAtom A2, int n2,
+                                             RPInteraction inter,
+                                             int & nInter )  {
+  PAtom    a1,a2;
+  ivector  hit;
+  realtype dmax;
+  int      i,j,k, nHits,nAlloc, nb, nIAlloc, f1,f2;
+  bool     self,hb,sb;
+
+    inter  = NULL;
+    nInter = 0;
+
+    if ((!A1) || (!A2) || (n1<=0) || (n2<=0) || (!types))  return 0;
+
+    self = (A1==A2) && (n1==n2);
+
+    dmax = 0.0;
+    if (types & INTERACT_HBond)       dmax = hbDist;
+    if (types & INTERACT_SaltBridge)  dmax = RMax(dmax,sbDist);
+    if (dmax<=0.0)  return 0;
+
+    np1 = GetPolarAtoms ( A1,n1,pid1,flag1,x1,y1,z1,ax1,ay1,az1,
+                          nAlloc1 );
+    np2 = GetPolarAtoms ( A2,n2,pid2,flag2,x2,y2,z2,ax2,ay2,az2,
+                          nAlloc2 );
+    if ((np1<=0) || (np2<=0))  return 0;
+
+    if (!bi)  {
+      GetVectorMemory ( bi ,InteractionBatch,0 );
+      GetVectorMemory ( bj ,InteractionBatch,0 );
+      GetVectorMemory ( bd2,InteractionBatch,0 );
+      GetVectorMemory ( bok,InteractionBatch,0 );
+    }
+
+    grid.MakeGrid ( x2,y2,z2,np2,0.0,RMax(dmax,2.0) );
+
+    hit     = NULL;
+    nAlloc  = 0;
+    nb      = 0;
+    nIAlloc = 0;
+    for (i=0;i<np1;i++)  {
+      f1    = flag1[i];
+      a1    = A1[pid1[i]];
+      nHits = grid.GetSphereAtoms ( x1[i],y1[i],z1[i],dmax,hit,nAlloc );
+      for (k=0;k<nHits;k++)  {
+        j  = hit[k];
+        if (self && (pid2[j]<=pid1[i]))  continue;
+        f2 = flag2[j];
+        hb = (types & INTERACT_HBond) &&
+             (((f1 & PATOM_Donor)    && (f2 & PATOM_Acceptor)) ||
+              ((f1 & PATOM_Acceptor) && (f2 & PATOM_Donor)));
+        sb = (types & INTERACT_SaltBridge) &&
+             (((f1 & PATOM_Cation) && (f2 & PATOM_Anion)) ||
+              ((f1 & PATOM_Anion)  && (f2 & PATOM_Cation)));
+        if ((!hb) && (!sb))  continue;
+        a2 = A2[pid2[j]];
+        if ((a1->residue==a2->residue) || (!a1->isAltLocMatch(a2)))
+          continue;
+        bi[nb] = i;
+        bj[nb] = j;
+        nb++;
+        if (nb>=InteractionBatch)  {
+          CheckBatch ( nb,inter,nInter,nIAlloc );
+          nb = 0;
+        }
+      }
+    }
+    if (nb>0)
+      CheckBatch ( nb,inter,nInter,nIAlloc );
+
+    FreeVectorMemory ( hit,0 );
+
+    return nInter;
+
+  }
+
+}  // namespace mmdb
@@ -0,0 +1,139 @@
+//  $Id: mmdb_interact.h $
+//  =================================================================
+//
+//   CCP4 Coordinate Library: support of coordinate-related
+//   functionality in protein crystallography applications.
+//
+//   Copyright (C) The MMDB contributors 2026.
+//
+//    This library is free software: you can redistribute it and/or
+//    modify it under the terms of the GNU Lesser General Public
+//    License version 3, modified in accordance with the provisions
+//    of the license to address the requirements of UK law.
+//
+//    You should have received a copy of the modified GNU Lesser
+//    General Public License along with this library. If not, copies
+//    may be downloaded from http://www.ccp4.ac.uk/ccp4license.php
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//  =================================================================
+//
+//    18.10.26   <--  Date of Last Modification.
+//                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  -----------------------------------------------------------------
+//
+//  **** Module  :  mmdb_interact <interface>
+//       ~~~~~~~~~
+//       Project :  MacroMolecular Data Base (MMDB)
+//       ~~~~~~~~~
+//  **** Classes :  mmdb::Interaction       ( typed atom interaction  )
+//       ~~~~~~~~~  mmdb::InteractionFinder ( H-bonds and salt bridges )
+//
+//  (C) The MMDB contributors 2026
+//
+//  =================================================================
+//
+
+#ifndef __MMDB_Interact__
+#define __MMDB_Interact__
+
+#include "mmdb_coormngr.h"
+
+namespace mmdb  {
+
+  // =======================  Interaction  ==========================
+
+  enum INTERACTION_TYPE  {
+    INTERACT_HBond      = 0x0001,
+    INTERACT_SaltBridge = 0x0002,
+    INTERACT_All        = 0x0003
+  };
+
+  DefineStructure(Interaction);
+
+  struct Interaction  {
+    int      id1,id2; // indices of atoms in 1st and 2nd atom vectors
+    int      type;    // combination of INTERACT_XXXX flags
+    int      donor;   // H-bond donor: 1 or 2 for atom id1 or id2,
+                      // 3 if either atom may be the donor
+    realtype dist;    // distance between the atoms
+  };
+
+
+  // ====================  InteractionFinder  =======================
+
+  //   InteractionFinder finds hydrogen bonds and salt bridges between
+  // atoms of different residues. Atoms are classified as donors,
+  // acceptors, cations and anions by getPolarAtomType(..) (see
+  // mmdb_tables.h). An H-bond is found between a donor and an
+  // acceptor at distance d<=hbDist if the angles at both atoms,
+  // formed with their antecedents (nearest heavy atoms of the same
+  // residue within bonding distance), are not less than minAngle;
+  // atoms without antecedents, such as water, are not checked for
+  // angles. A salt bridge is found between a cation and an anion at
+  // distance d<=sbDist.
+  //   Candidate pairs are found with a brick grid over the polar
+  // atoms of the 2nd vector and checked in batches of flat arrays.
+  // Atoms with different non-empty alternative locations are not
+  // paired.
+
+  DefineClass(InteractionFinder);
+
+  class InteractionFinder  {
+
+    public :
+      realtype hbDist;    // maximal H-bond distance, 3.5 A
+      realtype sbDist;    // maximal salt bridge distance, 4.0 A
+      realtype minAngle;  // minimal angle at donor and acceptor,
+                          // degrees, 90.0
+      int      types;     // INTERACT_XXXX types to look for,
+                          // INTERACT_All
+
+      InteractionFinder ();
+      ~InteractionFinder();
+
+      void  FreeMemory();
+
+      //   SeekInteractions(..) finds interactions between atoms
+      // A1[0..n1-1] and A2[0..n2-1]; NULL pointers are allowed in
+      // the vectors. If A1 and A2 are the same vector with n1==n2,
+      // each interaction is found only once, with id1<id2. Vector
+      // inter is allocated by the function and should be disposed
+      // by the caller as 'delete[] inter'; it should be NULL on
+      // input. Returns the number of interactions found.
+      int   SeekInteractions ( PPAtom A1, int n1, PPAtom A2, int n2,
+                               RPInteraction inter, int & nInter );
+
+    protected :
+
+      //  Polar atoms of the two vectors: indices in the atom vector,
+      //  PATOM_XXXX flags, coordinates and antecedent coordinates
+      ivector  pid1,pid2, flag1,flag2;
+      rvector  x1,y1,z1, ax1,ay1,az1;
+      rvector  x2,y2,z2, ax2,ay2,az2;
+      int      np1,np2, nAlloc1,nAlloc2;
+
+      //  Batch of candidate pairs (indices of polar atoms)
+      ivector  bi,bj;
+      rvector  bd2;
+      bvector  bok;
+
+      BrickGrid grid;
+
+      void  InitInteractionFinder();
+      int   GetPolarAtoms ( PPAtom A, int n, ivector & pid,
+                            ivector & flag, rvector & x, rvector & y,
+                            rvector & z, rvector & ax, rvector & ay,
+                            rvector & az, int & nAlloc );
+      void  CheckBatch    ( int nb, RPInteraction inter,
+                            int & nInter, int & nIAlloc );
+
+  };
+
+}  // namespace mmdb
+
+#endif
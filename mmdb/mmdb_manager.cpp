@@ -30,8 +30,9 @@
 //       ~~~~~~~~~
 //       Project :  MacroMolecular Data Base (MMDB)
 //       ~~~~~~~~~
-//  **** Classes :  mmdb::Manager  ( MMDB file manager )
-//       ~~~~~~~~~
+//  **** Classes :  mmdb::Manager      ( MMDB file manager          )
+//       ~~~~~~~~~  mmdb::CoordBlock   ( contiguous atom coordinates )
+//                  mmdb::ManagerClone ( copy-on-write Manager clone )
 //
 //  (C) E. Krissinel 2000-2013
 //
@@ -386,4 +387,201 @@ namespace mmdb  {
 
   MakeStreamFunctions(Manager)
 
+
+
+  //  =====================   CoordBlock   ======================
+
+  CoordBlock::CoordBlock()  {
+    InitCoordBlock();
+  }
+
+  CoordBlock::~CoordBlock()  {
+    FreeMemory();
+  }
+
+  void  CoordBlock::InitCoordBlock()  {
+    nAtoms     = 0;
+    nAlloc     = 0;
+    block      = NULL;
+    x          = NULL;
+    y          = NULL;
+    z          = NULL;
+    occupancy  = NULL;
+    tempFactor = NULL;
+    charge     = NULL;
+    WhatIsSet  = NULL;
+  }
+
+  void  CoordBlock::FreeMemory()  {
+    if (block)      delete[] block;
+    if (WhatIsSet)  delete[] WhatIsSet;
+    InitCoordBlock();
+  }
+
+  void  CoordBlock::Allocate ( int n )  {
+    if (n>nAlloc)  {
+      FreeMemory();
+      nAlloc    = n;
+      block     = new realtype[6*n];
+      WhatIsSet = new word[n];
+    }
+    nAtoms     = n;
+    x          = block;
+    y          = &(block[nAlloc]);
+    z          = &(block[2*nAlloc]);
+    occupancy  = &(block[3*nAlloc]);
+    tempFactor = &(block[4*nAlloc]);
+    charge     = &(block[5*nAlloc]);
+  }
+
+  void  CoordBlock::GetCoordinates ( PManager M )  {
+  PPAtom A;
+  int    i,n;
+    A = NULL;
+    n = 0;
+    if (M)  M->GetAtomTable ( A,n );
+    Allocate ( n );
+    for (i=0;i<n;i++)
+      if (A[i])  {
+        x[i]          = A[i]->x;
+        y[i]          = A[i]->y;
+        z[i]          = A[i]->z;
+        occupancy[i]  = A[i]->occupancy;
+        tempFactor[i] = A[i]->tempFactor;
+        charge[i]     = A[i]->charge;
+        WhatIsSet[i]  = A[i]->WhatIsSet & (ASET_Coordinates |
+                        ASET_Occupancy | ASET_tempFactor | ASET_Charge);
+      } else  {
+        x[i]          = 0.0;
+        y[i]          = 0.0;
+        z[i]          = 0.0;
+        occupancy[i]  = 0.0;
+        tempFactor[i] = 0.0;
+        charge[i]     = 0.0;
+        WhatIsSet[i]  = 0;
+      }
+  }
+
+  bool  CoordBlock::PutCoordinates ( PManager M )  {
+  PPAtom A;
+  word   mask;
+  int    i,n;
+    A = NULL;
+    n = 0;
+    if (!M)  return false;
+    M->GetAtomTable ( A,n );
+    if (n!=nAtoms)  return false;
+    mask = ASET_Coordinates | ASET_Occupancy | ASET_tempFactor |
+           ASET_Charge;
+    for (i=0;i<n;i++)
+      if (A[i])  {
+        A[i]->x          = x[i];
+        A[i]->y          = y[i];
+        A[i]->z          = z[i];
+        A[i]->occupancy  = occupancy[i];
+        A[i]->tempFactor = tempFactor[i];
+        A[i]->charge     = charge[i];
+        A[i]->WhatIsSet  = (A[i]->WhatIsSet & (~mask)) | WhatIsSet[i];
+      }
+    M->CoordinatesMoved();
+    return true;
+  }
+
+  void  CoordBlock::Copy ( PCoordBlock B )  {
+  int i;
+    Allocate ( B->nAtoms );
+    for (i=0;i<nAtoms;i++)  {
+      x[i]          = B->x[i];
+      y[i]          = B->y[i];
+      z[i]          = B->z[i];
+      occupancy[i]  = B->occupancy[i];
+      tempFactor[i] = B->tempFactor[i];
+      charge[i]     = B->charge[i];
+      WhatIsSet[i]  = B->WhatIsSet[i];
+    }
+  }
+
+  void  CoordBlock::ApplyTransform ( mat44 & TMatrix )  {
+    if (nAtoms>0)
+      Mat4Transform ( TMatrix,x,y,z,nAtoms );
+  }
+
+
+
+  //  ====================   ManagerClone   =====================
+
+  ManagerClone::ManagerClone()  {
+    InitManagerClone();
+  }
+
+  ManagerClone::ManagerClone ( PManager M )  {
+    InitManagerClone();
+    Clone ( M );
+  }
+
+  ManagerClone::~ManagerClone()  {
+    FreeMemory();
+  }
+
+  void  ManagerClone::InitManagerClone()  {
+    manager = NULL;
+    own     = false;
+  }
+
+  void  ManagerClone::FreeMemory()  {
+    if (own && manager)  delete manager;
+    coord.FreeMemory();
+    InitManagerClone();
+  }
+
+  void  ManagerClone::Clone ( PManager M )  {
+    if (M!=manager)  {
+      if (own && manager)  delete manager;
+      manager = M;
+      own     = false;
+    }
+    coord.GetCoordinates ( M );
+  }
+
+  void  ManagerClone::Clone ( PManagerClone C )  {
+    if (C==this)  return;
+    if (C->manager!=manager)  {
+      if (own && manager)  delete manager;
+      manager = C->manager;
+      own     = false;
+    }
+    coord.Copy ( &(C->coord) );
+  }
+
+  PManager ManagerClone::Activate()  {
+    if (!manager)  return NULL;
+    if (!coord.PutCoordinates(manager))  return NULL;
+    return manager;
+  }
+
+  bool  ManagerClone::Update()  {
+  PPAtom A;
+  int    n;
+    if (!manager)  return false;
+    if (!own)  {
+      // the shared hierarchy must not have been edited
+      manager->GetAtomTable ( A,n );
+      if (n!=coord.nAtoms)  return false;
+    }
+    coord.GetCoordinates ( manager );
+    return true;
+  }
+
+  PManager ManagerClone::Detach()  {
+  PManager M;
+    if (manager && (!own))  {
+      M = new Manager();
+      M->Copy ( manager,MMDBFCM_All );
+      coord.PutCoordinates ( M );
+      manager = M;
+      own     = true;
+    }
+    return manager;
+  }
+
 }  // namespace mmdb
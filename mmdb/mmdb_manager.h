@@ -30,8 +30,9 @@
 //       ~~~~~~~~~
 //       Project :  MacroMolecular Data Base (MMDB)
 //       ~~~~~~~~~
-//  **** Classes :  mmdb::Manager  ( MMDB file manager )
-//       ~~~~~~~~~
+//  **** Classes :  mmdb::Manager      ( MMDB file manager          )
+//       ~~~~~~~~~  mmdb::CoordBlock   ( contiguous atom coordinates )
+//                  mmdb::ManagerClone ( copy-on-write Manager clone )
 //
 //  (C) E. Krissinel 2000-2013
 //
@@ -118,6 +119,143 @@ namespace mmdb  {
 
   };
 
+
+  // ======================  CoordBlock  ===========================
+
+  //   CoordBlock keeps coordinates, occupancies, temperature factors
+  // and charges of all atoms of a Manager in contiguous vectors,
+  // in the order of the atom index. Both taking and putting them
+  // back are done in a single pass over the index, so a CoordBlock
+  // is a cheap way to save, restore and exchange conformations of
+  // a structure without copying the hierarchy.
+
+  DefineClass(CoordBlock);
+
+  class CoordBlock  {
+
+    public :
+      int      nAtoms;     // length of the atom index
+      rvector  x,y,z;      // coordinates [0..nAtoms-1]
+      rvector  occupancy;  // occupancies
+      rvector  tempFactor; // temperature factors
+      rvector  charge;     // charges
+      wvector  WhatIsSet;  // ASET_XXXX masks of the above, 0 for
+                           // empty slots in the index
+
+      CoordBlock ();
+      ~CoordBlock();
+
+      void  FreeMemory();
+
+      //   GetCoordinates(..) takes the data from atoms of manager M.
+      // Allocated storage is reused if it is large enough.
+      void  GetCoordinates ( PManager M );
+
+      //   PutCoordinates(..) puts the data into atoms of manager M,
+      // which should have the same atom index as the one the data
+      // was taken from, and lets M drop its spatial indices (see
+      // CoorManager::CoordinatesMoved()). Returns false and does
+      // nothing if M is NULL or the index length is different.
+      bool  PutCoordinates ( PManager M );
+
+      void  Copy ( PCoordBlock B );
+
+      //   ApplyTransform(..) transforms all coordinates in the block
+      // by matrix TMatrix, same as CoorManager::ApplyTransform(..)
+      // does for atoms.
+      void  ApplyTransform ( mat44 & TMatrix );
+
+    protected :
+      rvector  block;      // storage for all real vectors
+      int      nAlloc;     // number of atoms allocated
+
+      void  InitCoordBlock();
+      void  Allocate ( int n );
+
+  };
+
+
+  // =====================  ManagerClone  ==========================
+
+  //   ManagerClone is a copy-on-write clone of a Manager. The clone
+  // shares the hierarchy (atom names, residue and chain tables,
+  // title and crystallographic records) with the source manager
+  // and has its own coordinates kept in a CoordBlock, so that
+  // making a clone costs one pass over the atom index.
+  //   The shared manager shows coordinates of the clone that was
+  // activated last, so that all Manager functions may be used
+  // on the clone after Activate(). Coordinates changed through the
+  // manager are taken back into the clone with Update().
+  //   Structural edits must not be done on the shared manager.
+  // Detach() makes a private deep copy of the source for the clone,
+  // which may be then edited freely; a detached clone is not
+  // affected by Activate() and Update() of other clones.
+  //   The source manager must not be edited or disposed while it is
+  // shared by clones.
+
+  DefineClass(ManagerClone);
+
+  class ManagerClone  {
+
+    public :
+
+      ManagerClone ();
+      ManagerClone ( PManager M );
+      ~ManagerClone();
+
+      void  FreeMemory();
+
+      //   Clone(..) makes the clone of manager M, taking over the
+      // coordinates of M.
+      void  Clone ( PManager M );
+
+      //   Clone(..) makes the clone of another clone, sharing the same
+      // manager. If C is detached, its private manager is shared,
+      // and C must not be edited or disposed while the new clone
+      // is in use.
+      void  Clone ( PManagerClone C );
+
+      bool  isShared   ()  { return !own; }
+      int   GetNumberOfAtoms ()  { return coord.nAtoms; }
+
+      //   GetCoordBlock() returns clone's coordinates, which may be
+      // modified directly. The block must not be disposed.
+      PCoordBlock GetCoordBlock()  { return &coord; }
+
+      //   GetManager() returns the manager that the clone refers to;
+      // it shows clone's coordinates only after Activate().
+      PManager GetManager ()  { return manager; }
+
+      //   Activate() puts clone's coordinates into the manager and
+      // returns the manager. Returns NULL and leaves the manager as
+      // it is if the clone has no manager or the manager's atom
+      // index does not match the clone, e.g. after a structural
+      // edit.
+      PManager Activate ();
+
+      //   Update() takes coordinates from the manager into the clone;
+      // the clone should have been activated last. Returns false and
+      // leaves the clone as it is if the clone has no manager or if
+      // the shared manager's atom index does not match the clone. A
+      // detached clone takes any number of atoms from its private
+      // manager.
+      bool  Update   ();
+
+      //   Detach() makes a private copy of the manager, with clone's
+      // coordinates, which may be edited structurally. Call Update()
+      // after editing to re-read coordinates. Returns the private
+      // manager, which belongs to the clone.
+      PManager Detach ();
+
+    protected :
+      PManager   manager;  // shared or private manager
+      bool       own;      // true if manager is private
+      CoordBlock coord;    // coordinates of the clone
+
+      void  InitManagerClone();
+
+  };
+
 }  // namespace mmdb
 
 #endif
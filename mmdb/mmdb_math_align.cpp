@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -114,12 +114,26 @@ namespace mmdb  {
       SNEq      = -1.0;
       Wg        =  0.0;
       Ws        = -1.0;
+      CC        = NULL;
+      DD        = NULL;
+      RR        = NULL;
+      SS        = NULL;
+      Prof      = NULL;
+      ProfLen   = 0;
+      nRowAlloc = 0;
+      AlgnPos   = 0;
     }
 
     void  Alignment::FreeMemory()  {
       FreeMatrixMemory ( VT,TLen+1,0,0 );
       FreeMatrixMemory ( ET,TLen+1,0,0 );
       FreeMatrixMemory ( FT,TLen+1,0,0 );
+      FreeVectorMemory ( CC,0 );
+      FreeVectorMemory ( DD,0 );
+      FreeVectorMemory ( RR,0 );
+      FreeVectorMemory ( SS,0 );
+      nRowAlloc = 0;
+      FreeProfile();
       if (AlgnS)  {
         delete[] AlgnS;
         AlgnS = NULL;
@@ -512,6 +526,376 @@ namespace mmdb  {
     }
 
 
+    //  ---------------  Linear-space alignment  ------------------
+
+    //  Flags of LinearPass(..)
+    #define  ALN_FreeT    0x0001  /* leading end of T is not weighted */
+    #define  ALN_FreeS    0x0002  /* leading end of S is not weighted */
+    #define  ALN_Local    0x0004  /* scores are not let below zero    */
+    #define  ALN_BestAll  0x0008  /* best score over the whole table  */
+    #define  ALN_BestCol  0x0010  /* best score in the last column    */
+    #define  ALN_BestRow  0x0020  /* best score in the last row       */
+
+    //  Score of impossible states; it is far from -MaxReal so that
+    //  sums of such scores do not overflow
+    #define  ALN_NoScore  (-1.0e-2*MaxReal)
+
+    static int PassFlags ( int Method )  {
+      switch (Method)  {
+        default             :
+        case ALIGN_GLOBAL   : return 0;
+        case ALIGN_LOCAL    : return ALN_FreeT | ALN_FreeS | ALN_Local |
+                                     ALN_BestAll;
+        case ALIGN_GLOBLOC  : return ALN_FreeT | ALN_BestCol;
+        case ALIGN_FREEENDS : return ALN_FreeT | ALN_FreeS |
+                                     ALN_BestCol | ALN_BestRow;
+      }
+    }
+
+    void  Alignment::GetRowMemory ( int n )  {
+      if (n>nRowAlloc)  {
+        FreeVectorMemory ( CC,0 );
+        FreeVectorMemory ( DD,0 );
+        FreeVectorMemory ( RR,0 );
+        FreeVectorMemory ( SS,0 );
+        GetVectorMemory  ( CC,n,0 );
+        GetVectorMemory  ( DD,n,0 );
+        GetVectorMemory  ( RR,n,0 );
+        GetVectorMemory  ( SS,n,0 );
+        nRowAlloc = n;
+      }
+    }
+
+    void  Alignment::MakeProfile ( cpstr S, int sLen,
+                                   cpstr T, int tLen )  {
+    //  Calculates Prof[c][j] = Score(c,S[j]) for all characters c
+    //  of T, for which they were not calculated yet. This replaces
+    //  calls to Score(..) in the table by array look-ups.
+    rvector p;
+    int     i,j,c;
+
+      if (!Prof)  {
+        Prof = new rvector[256];
+        for (c=0;c<256;c++)
+          Prof[c] = NULL;
+      }
+      ProfLen = sLen;
+
+      for (i=0;i<tLen;i++)  {
+        c = (unsigned char)T[i];
+        if (!Prof[c])  {
+          GetVectorMemory ( Prof[c],IMax(sLen,1),0 );
+          p = Prof[c];
+          for (j=0;j<sLen;j++)
+            p[j] = Score ( T[i],S[j] );
+        }
+      }
+
+    }
+
+    void  Alignment::FreeProfile()  {
+    int c;
+      if (Prof)  {
+        for (c=0;c<256;c++)
+          FreeVectorMemory ( Prof[c],0 );
+        delete[] Prof;
+        Prof = NULL;
+      }
+      ProfLen = 0;
+    }
+
+    realtype  Alignment::LinearPass ( cpstr T, int i0, int j0,
+                                      int M, int N, int dir,
+                                      realtype tb, int flags,
+                                      rvector V, rvector F,
+                                      int & iBest, int & jBest )  {
+    //   Calculates the alignment table row by row, keeping only the
+    // last row in V (best scores) and F (best scores ending with T
+    // against a space). If dir>0, rows and columns are T[i0..i0+M-1]
+    // and S[j0..j0+N-1]; if dir<0, they go backward from T[i0-1] and
+    // S[j0-1]. Leading spaces against T open at weight tb.
+    //   Returns the best score and its cell as given by flags, or the
+    // score in the last cell if no ALN_BestXXX flags are given.
+    rvector  p;
+    realtype vBest,diag,v,e,f,gs;
+    int      i,j;
+    bool     local;
+
+      gs    = Wg + Ws;
+      local = ((flags & ALN_Local)!=0);
+
+      V[0] = 0.0;
+      F[0] = 0.0;
+      for (j=1;j<=N;j++)  {
+        if (flags & ALN_FreeS)  V[j] = 0.0;
+                          else  V[j] = Wg + j*Ws;
+        F[j] = ALN_NoScore;
+      }
+
+      vBest = ALN_NoScore;
+      iBest = 0;
+      jBest = 0;
+      if (flags & ALN_BestAll)  {
+        for (j=0;j<=N;j++)
+          if (V[j]>vBest)  {
+            vBest = V[j];
+            jBest = j;
+          }
+      } else if (flags & ALN_BestCol)  {
+        vBest = V[N];
+        jBest = N;
+      }
+
+      for (i=1;i<=M;i++)  {
+
+        if (dir>0)  p = Prof[(unsigned char)T[i0+i-1]] + j0;
+              else  p = Prof[(unsigned char)T[i0-i]]   + j0 - 1;
+
+        diag = V[0];
+        if (flags & ALN_FreeT)  V[0] = 0.0;
+                          else  V[0] = tb + i*Ws;
+        F[0] = V[0];
+        v    = V[0];
+        e    = ALN_NoScore;
+
+        for (j=1;j<=N;j++)  {
+          e = RMax ( e+Ws,v+gs );
+          f = RMax ( F[j]+Ws,V[j]+gs );
+          v = diag + (*p);
+          p += dir;
+          diag = V[j];
+          if (e>v)  v = e;
+          if (f>v)  v = f;
+          if (local && (v<0.0))  v = 0.0;
+          V[j] = v;
+          F[j] = f;
+        }
+
+        if (flags & ALN_BestAll)  {
+          for (j=0;j<=N;j++)
+            if (V[j]>vBest)  {
+              vBest = V[j];
+              iBest = i;
+              jBest = j;
+            }
+        } else if ((flags & ALN_BestCol) && (V[N]>vBest))  {
+          vBest = V[N];
+          iBest = i;
+          jBest = N;
+        }
+
+      }
+
+      if (flags & ALN_BestRow)  {
+        for (j=0;j<=N;j++)
+          if (V[j]>vBest)  {
+            vBest = V[j];
+            iBest = M;
+            jBest = j;
+          }
+      }
+
+      if (!(flags & (ALN_BestAll | ALN_BestCol | ALN_BestRow)))  {
+        vBest = V[N];
+        iBest = M;
+        jBest = N;
+      }
+
+      return vBest;
+
+    }
+
+    void  Alignment::PutPair ( char A, char B )  {
+      AlgnS[AlgnPos] = A;
+      AlgnT[AlgnPos] = B;
+      AlgnPos++;
+    }
+
+    realtype  Alignment::LinearAlign ( cpstr S, cpstr T,
+                                       int i0, int i1, int j0, int j1,
+                                       realtype tb, realtype te )  {
+    //   Globally aligns T[i0..i1-1] and S[j0..j1-1] and puts the
+    // result in AlgnS and AlgnT from position AlgnPos on. Spaces
+    // against T at the ends of the alignment open at weights tb and
+    // te, which are either Wg or 0.0 if they continue a gap of the
+    // embracing alignment. Returns the score of alignment.
+    rvector  p;
+    realtype vmax,v;
+    int      M,N,mid,midj,type,i,j,k;
+
+      M = i1 - i0;
+      N = j1 - j0;
+
+      if (N<=0)  {
+        for (i=i0;i<i1;i++)
+          PutPair ( Space,T[i] );
+        if (M>0)  return RMax(tb,te) + M*Ws;
+        return 0.0;
+      }
+
+      if (M<=0)  {
+        for (j=j0;j<j1;j++)
+          PutPair ( S[j],Space );
+        return Wg + N*Ws;
+      }
+
+      if (M==1)  {
+        //  either T[i0] goes against a space, or it is put against
+        //  the best S[j0+k]
+        p    = Prof[(unsigned char)T[i0]] + j0;
+        vmax = RMax(tb,te) + Ws + Wg + N*Ws;
+        k    = -1;
+        for (j=0;j<N;j++)  {
+          v = p[j];
+          if (j>0)    v += Wg + j*Ws;
+          if (j<N-1)  v += Wg + (N-1-j)*Ws;
+          if (v>vmax)  {
+            vmax = v;
+            k    = j;
+          }
+        }
+        if (k<0)  {
+          if (tb>=te)  PutPair ( Space,T[i0] );
+          for (j=j0;j<j1;j++)
+            PutPair ( S[j],Space );
+          if (tb<te)   PutPair ( Space,T[i0] );
+        } else  {
+          for (j=0;j<N;j++)
+            if (j==k)  PutPair ( S[j0+j],T[i0] );
+                 else  PutPair ( S[j0+j],Space );
+        }
+        return vmax;
+      }
+
+      //  Find the cell, in which the best path crosses the middle
+      //  row, from the forward table of the upper half and backward
+      //  table of the lower half. The path either goes through
+      //  cell (mid,midj) (type 1), or has T[i0+mid-1] and T[i0+mid]
+      //  against spaces at column midj (type 2).
+      mid = M/2;
+      LinearPass ( T,i0,j0,mid,N,1,tb,0,CC,DD,i,j );
+      LinearPass ( T,i1,j1,M-mid,N,-1,te,0,RR,SS,i,j );
+
+      vmax = CC[0] + RR[N];
+      midj = 0;
+      type = 1;
+      for (j=1;j<=N;j++)  {
+        v = CC[j] + RR[N-j];
+        if (v>vmax)  {
+          vmax = v;
+          midj = j;
+        }
+      }
+      for (j=0;j<=N;j++)  {
+        v = DD[j] + SS[N-j] - Wg;
+        if (v>vmax)  {
+          vmax = v;
+          midj = j;
+          type = 2;
+        }
+      }
+
+      if (type==1)  {
+        LinearAlign ( S,T,i0,i0+mid,j0,j0+midj,tb,Wg );
+        LinearAlign ( S,T,i0+mid,i1,j0+midj,j1,Wg,te );
+      } else  {
+        LinearAlign ( S,T,i0,i0+mid-1,j0,j0+midj,tb,0.0 );
+        PutPair ( Space,T[i0+mid-1] );
+        PutPair ( Space,T[i0+mid]   );
+        LinearAlign ( S,T,i0+mid+1,i1,j0+midj,j1,0.0,te );
+      }
+
+      return vmax;
+
+    }
+
+    void  Alignment::AlignLinear ( cpstr S, cpstr T,
+                                   ALIGN_METHOD Method )  {
+    int i,j,i0,i1,j0,j1;
+
+      FreeMemory();
+
+      AlignKey = Method;
+      SLen     = strlen ( S );
+      TLen     = strlen ( T );
+
+      GetRowMemory ( SLen+1 );
+      MakeProfile  ( S,SLen,T,TLen );
+
+      i = SLen+TLen+1;
+      AlgnS   = new char[i];
+      AlgnT   = new char[i];
+      AlgnPos = 0;
+
+      if (Method==ALIGN_GLOBAL)  {
+        VAchieved = LinearAlign ( S,T,0,TLen,0,SLen,Wg,Wg );
+      } else  {
+        //  Find the end of the best alignment by forward pass, and
+        //  then its beginning by backward pass from the end
+        VAchieved = LinearPass ( T,0,0,TLen,SLen,1,Wg,
+                                 PassFlags(Method),CC,DD,i1,j1 );
+        LinearPass ( T,i1,j1,i1,j1,-1,Wg,
+                     PassFlags(Method) & (ALN_BestAll | ALN_BestCol |
+                                          ALN_BestRow),
+                     CC,DD,i,j );
+        i0 = i1 - i;
+        j0 = j1 - j;
+        if (Method!=ALIGN_LOCAL)  {
+          for (i=0;i<i0;i++)  PutPair ( Space,T[i] );
+          for (j=0;j<j0;j++)  PutPair ( S[j],Space );
+        }
+        LinearAlign ( S,T,i0,i1,j0,j1,Wg,Wg );
+        if (Method!=ALIGN_LOCAL)  {
+          for (j=j1;j<SLen;j++)  PutPair ( S[j],Space );
+          for (i=i1;i<TLen;i++)  PutPair ( Space,T[i] );
+        }
+      }
+
+      AlgnS[AlgnPos] = char(0);
+      AlgnT[AlgnPos] = char(0);
+
+    }
+
+    realtype  Alignment::AlignScore ( cpstr S, cpstr T,
+                                      ALIGN_METHOD Method )  {
+    int sLen,tLen,i,j;
+
+      sLen = strlen ( S );
+      tLen = strlen ( T );
+
+      FreeProfile  ();
+      GetRowMemory ( sLen+1 );
+      MakeProfile  ( S,sLen,T,tLen );
+
+      return LinearPass ( T,0,0,tLen,sLen,1,Wg,PassFlags(Method),
+                          CC,DD,i,j );
+
+    }
+
+    void  Alignment::AlignScores ( cpstr S, psvector T, int nT,
+                                   rvector score,
+                                   ALIGN_METHOD Method )  {
+    cpstr Tk;
+    int   sLen,tLen,flags,i,j,k;
+
+      sLen  = strlen ( S );
+      flags = PassFlags ( Method );
+
+      FreeProfile  ();
+      GetRowMemory ( sLen+1 );
+
+      for (k=0;k<nT;k++)  {
+        if (T[k])  Tk = T[k];
+             else  Tk = "";
+        tLen = strlen ( Tk );
+        MakeProfile ( S,sLen,Tk,tLen );
+        score[k] = LinearPass ( Tk,0,0,tLen,sLen,1,Wg,flags,
+                                CC,DD,i,j );
+      }
+
+    }
+
+
     realtype Alignment::Score ( char A, char B )  {
       if (A==B)  return SEq;
       if ((A==Space) || (B==Space))  return Ws;
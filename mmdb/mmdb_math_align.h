@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -95,6 +95,35 @@ namespace mmdb  {
         void Align          ( cpstr S, cpstr T,
                               ALIGN_METHOD Method=ALIGN_GLOBAL );
 
+        //   AlignLinear(..) aligns S and T in memory proportional to
+        // the length of S, rather than to the product of lengths, by
+        // the divide-and-conquer method of Hirschberg extended to
+        // affine gaps (E.W.Myers, W.Miller, CABIOS 4, 11-17 (1988)).
+        // Gaps of length L are weighted as WGap+L*WSpace, and the
+        // alignment found is optimal in this model. Align(..) treats
+        // gaps at the table borders and in backtracing somewhat
+        // differently, therefore the alignments and scores of the two
+        // functions may differ. In GLOBLOC and FREEENDS modes,
+        // non-aligned ends are put against spaces. The results are
+        // retrieved with the same functions as after Align(..).
+        void AlignLinear    ( cpstr S, cpstr T,
+                              ALIGN_METHOD Method=ALIGN_GLOBAL );
+
+        //   AlignScore(..) returns the score of the alignment, which
+        // AlignLinear(..) would find, without making the alignment.
+        // It needs one pass over the table and does not change the
+        // results of the last alignment.
+        realtype AlignScore ( cpstr S, cpstr T,
+                              ALIGN_METHOD Method=ALIGN_GLOBAL );
+
+        //   AlignScores(..) calculates AlignScore(S,T[k],Method) for
+        // k=0..nT-1 and puts them in score[0..nT-1]. Scores of S
+        // are calculated only once for all T[k]. NULL T[k] are taken
+        // as empty strings.
+        void AlignScores    ( cpstr S, psvector T, int nT,
+                              rvector score,
+                              ALIGN_METHOD Method=ALIGN_GLOBAL );
+
         inline pstr     GetAlignedS()  {  return AlgnS;      }
         inline pstr     GetAlignedT()  {  return AlgnT;      }
         inline realtype GetScore   ()  {  return VAchieved;  }
@@ -117,6 +146,13 @@ namespace mmdb  {
         realtype VAchieved;
         realtype SEq,SNEq, Wg,Ws;
 
+        //  Linear-space alignment: table rows, scores of S for every
+        //  character met in T (NULL for others), number of elements
+        //  in rows and alignment position
+        rvector  CC,DD,RR,SS;
+        rvector  * Prof;
+        int      ProfLen,nRowAlloc,AlgnPos;
+
         virtual void  InitAlignment();
         virtual void  FreeMemory   ();
         virtual realtype  Score    ( char A, char B );
@@ -129,6 +165,18 @@ namespace mmdb  {
         void    AdjustEnds   ( cpstr S, cpstr T, int J, int I );
         void    PrintVT      ( cpstr S, cpstr T );
 
+        void     GetRowMemory ( int n );
+        void     MakeProfile  ( cpstr S, int sLen, cpstr T, int tLen );
+        void     FreeProfile  ();
+        realtype LinearPass   ( cpstr T, int i0, int j0, int M, int N,
+                                int dir, realtype tb, int flags,
+                                rvector V, rvector F,
+                                int & iBest, int & jBest );
+        realtype LinearAlign  ( cpstr S, cpstr T, int i0, int i1,
+                                int j0, int j1, realtype tb,
+                                realtype te );
+        void     PutPair      ( char A, char B );
+
     };
 
 
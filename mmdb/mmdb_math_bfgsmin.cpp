@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -52,6 +52,8 @@ namespace mmdb  {
       MFuncData   = NULL;
       PFunc       = NULL;
       PFuncData   = NULL;
+      GFunc       = NULL;
+      GFuncData   = NULL;
 
       N           = 0;
       NAlloc      = 0;
@@ -79,6 +81,17 @@ namespace mmdb  {
       ForDiff     = false;
       CalcHess    = false;
 
+      LimMem      = false;
+      LS          = NULL;
+      LY          = NULL;
+      LRho        = NULL;
+      LAlpha      = NULL;
+      LGamma      = 1.0;
+      NHist       = 0;
+      HAlloc      = 0;
+      LFirst      = 0;
+      LCount      = 0;
+
       Etha        = 0.0;
       SqrtEtha    = 0.0;
       CubertEtha  = 0.0;
@@ -126,6 +139,11 @@ namespace mmdb  {
       PFunc     = Fnc;
     }
 
+    void  BFGSMin::SetGradFunction ( void * UserData, PBFGSGradFunc Fnc )  {
+      GFuncData = UserData;
+      GFunc     = Fnc;
+    }
+
 
     //  -------------------------------------------------------------------
 
@@ -360,6 +378,41 @@ namespace mmdb  {
     }
 
 
+    //  -------------------------------------------------------------------
+
+    void  BFGSMin::AGrad ( rvector X, rvector G )  {
+
+    //  Analytical gradient; components, which would lead out of
+    //  the limits, are frozen as in FDGrad(..)
+
+    realtype Tol, BB1,BB2;
+    int      j;
+
+      (*GFunc)(GFuncData,N,X,G);
+
+      for (j=1;j<=N;j++)  {
+        Freese[j] = false;
+        if (TL || LL)  {
+          BB1 = fabs(X[j]);
+          BB2 = 1.0/Sx[j];
+          if (BB1>BB2)  Tol = BB1*SqrtEtha;
+                  else  Tol = BB2*SqrtEtha;
+          if (TL)  {
+            if ((fabs(X[j]-TL[j])<=Tol) && (G[j]<0.0))  {
+              G[j] = 0.0;   Freese[j] = true;
+            }
+          }
+          if (LL)  {
+            if ((fabs(X[j]-LL[j])<=Tol) && (G[j]>0.0))  {
+              G[j] = 0.0;   Freese[j] = true;
+            }
+          }
+        }
+      }
+
+    }
+
+
     //  -------------------------------------------------------------------
 
     void  BFGSMin::FDGrad ( rvector X, rvector G, realtype Fc )  {
@@ -435,8 +488,9 @@ namespace mmdb  {
     //  -------------------------------------------------------------------
 
     void  BFGSMin::Gradient ( rvector X, rvector G, realtype Fc )  {
-      if (ForDiff)  FDGrad ( X,G,Fc );
-              else  CDGrad ( X,G );
+      if (GFunc)         AGrad  ( X,G );
+      else if (ForDiff)  FDGrad ( X,G,Fc );
+                   else  CDGrad ( X,G );
     }
 
 
@@ -579,6 +633,114 @@ namespace mmdb  {
     }
 
 
+    //  -------------------------------------------------------------------
+
+    void  BFGSMin::LBFGSDirection ( rvector X, rvector G, rvector P )  {
+
+    //  Calculates direction P = -H*G, where H is the limited-memory
+    //  approximation of the inverse Hessian (two-loop recursion).
+    //  Without history, H is the inverse of the initial Hessian of
+    //  the unfactorized BFGS (see InitHessUnFac(..)). Components,
+    //  which are frozen or would leave the limits at X, do not move.
+
+    int      i,k,l;
+    realtype a,b,Temp, Tol,BB1,BB2;
+    rvector  s,y;
+
+      for (i=1;i<=N;i++)
+        P[i] = -G[i];
+
+      for (l=LCount-1;l>=0;l--)  {
+        k = (LFirst+l) % NHist;
+        s = LS[k];
+        y = LY[k];
+        a = 0.0;
+        for (i=1;i<=N;i++)
+          a += s[i]*P[i];
+        a *= LRho[k];
+        LAlpha[k] = a;
+        for (i=1;i<=N;i++)
+          P[i] -= a*y[i];
+      }
+
+      if (LCount>0)  {
+        for (i=1;i<=N;i++)
+          P[i] *= LGamma;
+      } else  {
+        Temp = fabs(Func);
+        if (TpF>Temp)  Temp = TpF;
+        for (i=1;i<=N;i++)
+          P[i] /= Temp*Sx[i]*Sx[i];
+      }
+
+      for (l=0;l<LCount;l++)  {
+        k = (LFirst+l) % NHist;
+        s = LS[k];
+        y = LY[k];
+        b = 0.0;
+        for (i=1;i<=N;i++)
+          b += y[i]*P[i];
+        b = LAlpha[k] - LRho[k]*b;
+        for (i=1;i<=N;i++)
+          P[i] += b*s[i];
+      }
+
+      //  Choose_Lambda(..) stops steps slightly inside the limits, so
+      //  that components are taken as being on a limit within the same
+      //  tolerance as in AGrad(..)
+      for (i=1;i<=N;i++)
+        if (Freese[i])  P[i] = 0.0;
+        else if (TL || LL)  {
+          BB1 = fabs(X[i]);
+          BB2 = 1.0/Sx[i];
+          if (BB1>BB2)  Tol = BB1*SqrtEtha;
+                  else  Tol = BB2*SqrtEtha;
+          if (TL && (X[i]>=TL[i]-Tol) && (P[i]>0.0))  P[i] = 0.0;
+          if (LL && (X[i]<=LL[i]+Tol) && (P[i]<0.0))  P[i] = 0.0;
+        }
+
+    }
+
+
+    //  -------------------------------------------------------------------
+
+    void  BFGSMin::LBFGSUpdate ( rvector Xc, rvector Xp,
+                                 rvector Gc, rvector Gp )  {
+
+    //  Puts the last step into L-BFGS history, replacing the oldest
+    //  one if the history is full. The step is skipped if it does
+    //  not satisfy the curvature condition.
+
+    int      i,k;
+    realtype sy,NormS,NormY;
+    rvector  s,y;
+
+      if (LCount<NHist)  k = (LFirst+LCount) % NHist;
+                   else  k = LFirst;
+      s = LS[k];
+      y = LY[k];
+
+      sy    = 0.0;
+      NormS = 0.0;
+      NormY = 0.0;
+      for (i=1;i<=N;i++)  {
+        s[i]   = Xp[i] - Xc[i];
+        y[i]   = Gp[i] - Gc[i];
+        sy    += s[i]*y[i];
+        NormS += s[i]*s[i];
+        NormY += y[i]*y[i];
+      }
+
+      if (sy>sqrt(MachEps*NormS*NormY))  {
+        LRho[k] = 1.0/sy;
+        LGamma  = sy/NormY;
+        if (LCount<NHist)  LCount++;
+                     else  LFirst = (LFirst+1) % NHist;
+      }
+
+    }
+
+
     //  -------------------------------------------------------------------
 
     void  BFGSMin::Choose_Lambda ( rvector X, rvector S,
@@ -726,10 +888,18 @@ namespace mmdb  {
     void  BFGSMin::GetMemory()  {
       if (N!=NAlloc)  {
         FreeMemory();
-        GetMatrixMemory ( Hsn   , N,N, 1,1 );
+        if (LimMem)  {
+          GetMatrixMemory ( LS    , NHist,N, 0,1 );
+          GetMatrixMemory ( LY    , NHist,N, 0,1 );
+          GetVectorMemory ( LRho  , NHist, 0 );
+          GetVectorMemory ( LAlpha, NHist, 0 );
+          HAlloc = NHist;
+        } else  {
+          GetMatrixMemory ( Hsn   , N,N, 1,1 );
+          GetVectorMemory ( HDiag , N, 1 );
+        }
         GetVectorMemory ( GPlus , N, 1 );
         GetVectorMemory ( GradX , N, 1 );
-        GetVectorMemory ( HDiag , N, 1 );
         GetVectorMemory ( SN    , N, 1 );
         GetVectorMemory ( Sx    , N, 1 );
         GetVectorMemory ( XPlus , N, 1 );
@@ -738,7 +908,7 @@ namespace mmdb  {
         if (CalcHess)  {
           GetVectorMemory ( StepSize , N, 1 );
           GetVectorMemory ( FNeighbor, N, 1 );
-        } else  {
+        } else if (!LimMem)  {
           GetVectorMemory ( us       , N, 1 );
           GetVectorMemory ( uy       , N, 1 );
           GetVectorMemory ( ut       , N, 1 );
@@ -763,8 +933,13 @@ namespace mmdb  {
         FreeVectorMemory ( GradX    , 1 );
         FreeVectorMemory ( GPlus    , 1 );
         FreeMatrixMemory ( Hsn      , NAlloc, 1,1 );
+        FreeMatrixMemory ( LS       , HAlloc, 0,1 );
+        FreeMatrixMemory ( LY       , HAlloc, 0,1 );
+        FreeVectorMemory ( LRho     , 0 );
+        FreeVectorMemory ( LAlpha   , 0 );
       }
       NAlloc = 0;
+      HAlloc = 0;
     }
 
 
@@ -818,9 +993,10 @@ namespace mmdb  {
 
       TL       = TopLimit;
       LL       = LowLimit;
-      ForDiff  = true;
+      ForDiff  = (GFunc==NULL);
       N        = MinN;
       CalcHess = Hess;
+      LimMem   = false;
 
       ModF     = false;
 
@@ -919,7 +1095,150 @@ namespace mmdb  {
         if (RetCode>=0)  {
           UMStop ( x0,GPlus,RetCode,ItnCnt,MaxTkn );
           if ((!CalcHess) && (TermCode==BFGS_NoTermination))
-            BFGSUnFac ( x0,XPlus,GradX,GPlus,false,HDiag,Hsn );
+            BFGSUnFac ( x0,XPlus,GradX,GPlus,(GFunc!=NULL),
+                        HDiag,Hsn );
+        }
+        CopyPlus ( x0 );
+        Print    ( ItnCnt, x0,GradX,Func );
+      }
+
+      Relax     ();
+      FreeMemory();
+      FuncValue       = Func;
+      TerminationCode = TermCode;
+
+    }
+
+
+    //  -------------------------------------------------------------------
+
+    void  BFGSMin::LBFGS_Driver ( int        MinN,
+                                  rvector    x0,
+                                  rvector    TypX,
+                                  realtype & FuncValue,
+                                  int      & TerminationCode,
+                                  int        Digits,
+                                  int        ItnLmt,
+                                  realtype   TypF,
+                                  realtype   GrdTol,
+                                  realtype   StpTol,
+                                  realtype   MaxStp,
+                                  int        MHist,
+                                  rvector    LowLimit,
+                                  rvector    TopLimit )  {
+
+    //  Limited-memory version of BFGS_Driver(..)
+
+    int      i,RetCode;
+    int      ItnCnt;
+    realtype d;
+    bool     MaxTkn;
+
+      TL       = TopLimit;
+      LL       = LowLimit;
+      ForDiff  = (GFunc==NULL);
+      N        = MinN;
+      CalcHess = false;
+      LimMem   = true;
+      if (MHist>0)  NHist = MHist;
+              else  NHist = 7;
+      LFirst   = 0;
+      LCount   = 0;
+
+      ModF     = false;
+
+      GetMemory();
+
+      UMInCk ( x0,TypX,Digits,TypF,
+               GrdTol,StpTol,MaxStp,
+               ItnLmt );
+      if (TermCode!=BFGS_NoTermination)  {
+        FreeMemory();
+        FuncValue       = Func;
+        TerminationCode = TermCode;
+        return;
+      }
+
+      ItnCnt = 0;
+
+      MinFunc1 ( x0,Func );
+      if (TermCode!=BFGS_NoTermination)  {
+        FreeMemory();
+        FuncValue       = Func;
+        TerminationCode = TermCode;
+        return;
+      }
+      FOpt  = Func;
+      FPlus = Func;
+      for (i=1;i<=N;i++)  {
+        XOpt [i] = x0[i];
+        XPlus[i] = x0[i];
+      }
+      ModF = true;
+      Gradient ( x0,GradX,Func );
+      Print    ( ItnCnt,x0,GradX,Func );
+      for (i=1;i<=N;i++)
+        GPlus[i] = GradX[i];
+      if (TermCode!=BFGS_NoTermination)  {
+        Relax     ();
+        CopyPlus  ( x0 );
+        FreeMemory();
+        FuncValue       = Func;
+        TerminationCode = TermCode;
+        return;
+      }
+
+      UMStop0 ( x0,GradX );
+      if  (TermCode!=BFGS_NoTermination)  {
+        FreeMemory();
+        FuncValue       = Func;
+        TerminationCode = TermCode;
+        return;
+      }
+
+      RetCode = 0;
+      while (TermCode==BFGS_NoTermination)  {
+        ItnCnt++;
+        LBFGSDirection ( x0,GradX,SN );
+        d = 0.0;
+        for (i=1;i<=N;i++)
+          d += GradX[i]*SN[i];
+        if ((d>=0.0) && (LCount>0))  {
+          // not a descent direction: restart from the initial Hessian
+          LCount = 0;
+          LBFGSDirection ( x0,GradX,SN );
+        }
+        LineSearch ( x0,GradX,SN,Func,RetCode,MaxTkn );
+        if ((RetCode==1) && ForDiff)  {
+          // retry with central differences
+          RetCode = -1;
+          ForDiff = false;
+        } else if ((RetCode==1) && (LCount>0))  {
+          // retry with the initial Hessian
+          RetCode = -1;
+          LCount  = 0;
+        }
+        Relax();
+        if (TermCode!=BFGS_NoTermination)  {
+          CopyPlus  ( x0 );
+          FreeMemory();
+          FuncValue       = Func;
+          TerminationCode = TermCode;
+          return;
+        } else
+          Gradient ( XPlus,GPlus,FPlus );
+        if (TermCode!=BFGS_NoTermination)  {
+          Relax     ();
+          CopyPlus  ( x0 );
+          FreeMemory();
+          FuncValue       = Func;
+          TerminationCode = TermCode;
+          return;
+        }
+        if (RetCode>=0)  {
+          UMStop ( x0,GPlus,RetCode,ItnCnt,MaxTkn );
+          if (TermCode==BFGS_NoTermination)
+            LBFGSUpdate ( x0,XPlus,GradX,GPlus );
         }
         CopyPlus ( x0 );
         Print    ( ItnCnt, x0,GradX,Func );
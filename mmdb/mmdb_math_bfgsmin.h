@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -67,6 +67,10 @@ namespace mmdb  {
                                realtype & F );
     typedef BFGSMinFunc * PBFGSMinFunc;
 
+    typedef void BFGSGradFunc ( void * UserData, int N, rvector X,
+                                rvector G );
+    typedef BFGSGradFunc * PBFGSGradFunc;
+
     typedef void BFGSPrintFunc ( void * UserData, int N, int Itn,
                                  rvector X, rvector G, realtype F );
     typedef BFGSPrintFunc * PBFGSPrintFunc;
@@ -87,6 +91,12 @@ namespace mmdb  {
         void  SetMinFunction   ( void * UserData, PBFGSMinFunc   Fnc );
         void  SetPrintFunction ( void * UserData, PBFGSPrintFunc Fnc );
 
+        //   SetGradFunction(..) sets function Fnc, which calculates
+        // the gradient G[1..N] of F at point X[1..N]. If it is set,
+        // the drivers use it instead of finite differences. Setting
+        // it to NULL restores finite differences.
+        void  SetGradFunction  ( void * UserData, PBFGSGradFunc  Fnc );
+
 
         // ======================================================
         //
@@ -190,6 +200,37 @@ namespace mmdb  {
                                  rvector    LowLimit = NULL,
                                  rvector    TopLimit = NULL );
 
+
+        // ======================================================
+        //
+        //    LBFGS_Driver(..) is the limited-memory version of
+        //  BFGS_Driver(..) (J.Nocedal, Math.Comp. 35, 773-782
+        //  (1980)). Instead of the NxN Hessian, it keeps the last
+        //  MHist steps and gradient changes (7 if MHist<=0), which
+        //  takes memory of order MHist*N and makes it suitable for
+        //  problems with many variables. The parameters and return
+        //  codes are the same as in BFGS_Driver(..). For large N,
+        //  the gradient function should be set (SetGradFunction(..)),
+        //  because finite differences need N function evaluations
+        //  per gradient.
+        //
+        // ======================================================
+
+        void  LBFGS_Driver     ( int        MinN,
+                                 rvector    x0,
+                                 rvector    TypX,
+                                 realtype & FuncValue,
+                                 int      & TerminationCode,
+                                 int        Digits   = 0,
+                                 int        ItnLmt   = 0,
+                                 realtype   TypF     = 0.0,
+                                 realtype   GrdTol   = 0.0,
+                                 realtype   StpTol   = 0.0,
+                                 realtype   MaxStp   = MaxReal,
+                                 int        MHist    = 0,
+                                 rvector    LowLimit = NULL,
+                                 rvector    TopLimit = NULL );
+
         void  Stop();  // generates stop signal to stop optimization
 
 
@@ -199,6 +240,8 @@ namespace mmdb  {
         void *          MFuncData;
         PBFGSPrintFunc  PFunc;
         void *          PFuncData;
+        PBFGSGradFunc   GFunc;
+        void *          GFuncData;
 
         int             N,NAlloc;
         rmatrix         Hsn;
@@ -215,6 +258,15 @@ namespace mmdb  {
                                   // be employed (which is more expensive).
         bool            CalcHess;
 
+        //  L-BFGS history: steps LS[k] and gradient changes LY[k],
+        //  k = (LFirst+l) mod NHist for l=0..LCount-1, from the
+        //  oldest to the newest, 1/(LS[k]*LY[k]) in LRho[k]
+        bool            LimMem;
+        rmatrix         LS,LY;
+        rvector         LRho,LAlpha;
+        realtype        LGamma;
+        int             NHist,HAlloc,LFirst,LCount;
+
         realtype        Etha,SqrtEtha,CubertEtha,TpF,GrdEps,StpEps,MxStep;
         realtype        SqrtEps;
         int             CnsMax,MaxItn,TermCode;
@@ -232,6 +284,7 @@ namespace mmdb  {
         virtual void Gradient ( rvector X, rvector G, realtype Fc );
         virtual void FDHessF  ( realtype Fc, rvector X );
 
+        void  AGrad         ( rvector X, rvector G );
         void  FDGrad        ( rvector X, rvector G, realtype Fc );
         void  CDGrad        ( rvector X, rvector G );
         void  MdHess        ( rmatrix H, rvector HDg );
@@ -240,6 +293,9 @@ namespace mmdb  {
                               rvector  Gc,      rvector Gp,
                               bool     AnalGrad, rvector HDg,
                               rmatrix  H );
+        void  LBFGSDirection ( rvector X, rvector G, rvector P );
+        void  LBFGSUpdate    ( rvector Xc, rvector Xp,
+                               rvector Gc, rvector Gp );
         void  Choose_Lambda ( rvector X, rvector S, realtype & Lambda0 );
         void  LineSearch    ( rvector    px0,       rvector   G,
                               rvector    P,         realtype pFunc,
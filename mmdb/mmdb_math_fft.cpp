@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -33,6 +33,11 @@
 //                   mmdb::math::TwoFFT
 //                   mmdb::math::Convolve
 //                   mmdb::math::mConvolve
+//                   mmdb::math::FFTSizeOk
+//                   mmdb::math::GetFFTGridSample
+//  **** Classes :   mmdb::math::FFTPlan     ( planned complex 1-D FFT )
+//       ~~~~~~~~~   mmdb::math::RealFFTPlan ( planned real 1-D FFT    )
+//                   mmdb::math::RealFFT3D   ( planned real 3-D FFT    )
 //
 //  (C) E.Krissinel  2005-2013
 //
@@ -333,6 +338,701 @@ namespace mmdb  {
 
     }
 
+
+
+    //  =======================  Planned FFT  ==========================
+
+    //  Number of columns transformed together in RealFFT3D
+    #define  FFT_ColBlock  16
+
+    bool FFTSizeOk ( int n )  {
+    int i,f[8] = {2,3,5,7,11,13,17,19};
+      if (n<=0)  return false;
+      for (i=0;i<8;i++)
+        while ((n % f[i])==0)
+          n /= f[i];
+      return (n==1);
+    }
+
+    int GetFFTGridSample ( int minsmp, int nmul, realtype sample )  {
+    //  Calculations are done in single precision, as in csymlib,
+    //  so that the grids are exactly the same; grid of 1 point is
+    //  not accepted, also as in csymlib
+    float r1min,r1max,r2min,r2max, smp;
+    int   n;
+
+      if (minsmp<=0)  return nmul;
+
+      smp   = (float)sample;
+      r1min = 1.0;
+      r1max = 1.6;
+      r2min = 1.4;
+      r2max = 4.0;
+      if (smp>=1.0)  {
+        r1max = smp;
+        r2min = smp*0.95;
+        if (r2min<1.0)  r2min = 1.0;
+      }
+
+      n = (int)rint((r1max*minsmp)/nmul)*nmul;
+      while (n>(int)rint(r1min*minsmp))  {
+        if ((n>1) && FFTSizeOk(n))  return n;
+        n -= nmul;
+      }
+
+      n = (int)rint((r2min*minsmp)/nmul)*nmul;
+      while (n<(int)rint(r2max*minsmp))  {
+        if ((n>1) && FFTSizeOk(n))  return n;
+        n += nmul;
+      }
+
+      return -1;
+
+    }
+
+
+    //   Butterflies of the self-sorting transform. A stage of radix r
+    // takes r points a_j = x[q+s*(p+j*m)], j=0..r-1, makes their
+    // r-point DFT b_k, multiplies b_k by twiddles exp(-+2*Pi*i*p*k/(r*m))
+    // and puts them into y[q+s*(r*p+k)], for all p<m and q<s. Complex
+    // indices are doubled for real vectors below.
+
+    static void FFTRadix2 ( rvector x, rvector y, int s, int m,
+                            rvector tw, bool Forward )  {
+    realtype ar,ai,br,bi, dr,di, wr,wi;
+    int      p,q, i0,i1,o0,o1;
+      for (p=0;p<m;p++)  {
+        wr = tw[2*p];
+        if (Forward)  wi =  tw[2*p+1];
+                else  wi = -tw[2*p+1];
+        for (q=0;q<s;q++)  {
+          i0 = 2*(q+s*p);
+          i1 = i0 + 2*s*m;
+          o0 = 2*(q+2*s*p);
+          o1 = o0 + 2*s;
+          ar = x[i0];   ai = x[i0+1];
+          br = x[i1];   bi = x[i1+1];
+          y[o0]   = ar + br;
+          y[o0+1] = ai + bi;
+          dr = ar - br;
+          di = ai - bi;
+          y[o1]   = dr*wr - di*wi;
+          y[o1+1] = dr*wi + di*wr;
+        }
+      }
+    }
+
+    static void FFTRadix3 ( rvector x, rvector y, int s, int m,
+                            rvector tw, bool Forward )  {
+    realtype a0r,a0i, tr,ti, ur,ui, vr,vi, br,bi;
+    realtype w1r,w1i,w2r,w2i, c3;
+    int      p,q, i0,i1,i2,o0,o1,o2, sm;
+      c3 = 0.5*sqrt(3.0);
+      if (Forward)  c3 = -c3;
+      sm = 2*s*m;
+      for (p=0;p<m;p++)  {
+        w1r = tw[4*p];    w1i = tw[4*p+1];
+        w2r = tw[4*p+2];  w2i = tw[4*p+3];
+        if (!Forward)  {
+          w1i = -w1i;
+          w2i = -w2i;
+        }
+        for (q=0;q<s;q++)  {
+          i0  = 2*(q+s*p);
+          i1  = i0 + sm;
+          i2  = i1 + sm;
+          o0  = 2*(q+3*s*p);
+          o1  = o0 + 2*s;
+          o2  = o1 + 2*s;
+          a0r = x[i0];
+          a0i = x[i0+1];
+          tr  = x[i1]   + x[i2];
+          ti  = x[i1+1] + x[i2+1];
+          //  u = a0 - t/2,  v = i*c3*(a1-a2)
+          ur  = a0r - 0.5*tr;
+          ui  = a0i - 0.5*ti;
+          vr  = -c3*(x[i1+1]-x[i2+1]);
+          vi  =  c3*(x[i1]  -x[i2]);
+          y[o0]   = a0r + tr;
+          y[o0+1] = a0i + ti;
+          br = ur + vr;
+          bi = ui + vi;
+          y[o1]   = br*w1r - bi*w1i;
+          y[o1+1] = br*w1i + bi*w1r;
+          br = ur - vr;
+          bi = ui - vi;
+          y[o2]   = br*w2r - bi*w2i;
+          y[o2+1] = br*w2i + bi*w2r;
+        }
+      }
+    }
+
+    static void FFTRadix4 ( rvector x, rvector y, int s, int m,
+                            rvector tw, bool Forward )  {
+    realtype a0r,a0i,a1r,a1i,a2r,a2i,a3r,a3i;
+    realtype t0r,t0i,t1r,t1i,t2r,t2i,t3r,t3i, br,bi;
+    realtype w1r,w1i,w2r,w2i,w3r,w3i;
+    int      p,q, i0,o0, sm,s2;
+      sm = 2*s*m;
+      s2 = 2*s;
+      for (p=0;p<m;p++)  {
+        w1r = tw[6*p];    w1i = tw[6*p+1];
+        w2r = tw[6*p+2];  w2i = tw[6*p+3];
+        w3r = tw[6*p+4];  w3i = tw[6*p+5];
+        if (!Forward)  {
+          w1i = -w1i;
+          w2i = -w2i;
+          w3i = -w3i;
+        }
+        for (q=0;q<s;q++)  {
+          i0  = 2*(q+s*p);
+          o0  = 2*(q+4*s*p);
+          a0r = x[i0];       a0i = x[i0+1];
+          a1r = x[i0+sm];    a1i = x[i0+sm+1];
+          a2r = x[i0+2*sm];  a2i = x[i0+2*sm+1];
+          a3r = x[i0+3*sm];  a3i = x[i0+3*sm+1];
+          t0r = a0r + a2r;   t0i = a0i + a2i;
+          t1r = a0r - a2r;   t1i = a0i - a2i;
+          t2r = a1r + a3r;   t2i = a1i + a3i;
+          //  t3 = -+i*(a1-a3)
+          if (Forward)  {
+            t3r =  (a1i - a3i);
+            t3i = -(a1r - a3r);
+          } else  {
+            t3r = -(a1i - a3i);
+            t3i =  (a1r - a3r);
+          }
+          y[o0]   = t0r + t2r;
+          y[o0+1] = t0i + t2i;
+          br = t1r + t3r;
+          bi = t1i + t3i;
+          y[o0+s2]   = br*w1r - bi*w1i;
+          y[o0+s2+1] = br*w1i + bi*w1r;
+          br = t0r - t2r;
+          bi = t0i - t2i;
+          y[o0+2*s2]   = br*w2r - bi*w2i;
+          y[o0+2*s2+1] = br*w2i + bi*w2r;
+          br = t1r - t3r;
+          bi = t1i - t3i;
+          y[o0+3*s2]   = br*w3r - bi*w3i;
+          y[o0+3*s2+1] = br*w3i + bi*w3r;
+        }
+      }
+    }
+
+    static void FFTRadix5 ( rvector x, rvector y, int s, int m,
+                            rvector tw, bool Forward )  {
+    realtype a0r,a0i, t1r,t1i,t2r,t2i,t3r,t3i,t4r,t4i;
+    realtype u1r,u1i,u2r,u2i, v1r,v1i,v2r,v2i, br,bi, w[8];
+    realtype c1,c2,s1,s2;
+    int      p,q,k, i0,o0, sm,ss;
+      c1 = cos(0.4*Pi);
+      c2 = cos(0.8*Pi);
+      s1 = sin(0.4*Pi);
+      s2 = sin(0.8*Pi);
+      if (Forward)  {
+        s1 = -s1;
+        s2 = -s2;
+      }
+      sm = 2*s*m;
+      ss = 2*s;
+      for (p=0;p<m;p++)  {
+        for (k=0;k<8;k++)
+          w[k] = tw[8*p+k];
+        if (!Forward)
+          for (k=1;k<8;k+=2)
+            w[k] = -w[k];
+        for (q=0;q<s;q++)  {
+          i0  = 2*(q+s*p);
+          o0  = 2*(q+5*s*p);
+          a0r = x[i0];
+          a0i = x[i0+1];
+          t1r = x[i0+sm]   + x[i0+4*sm];
+          t1i = x[i0+sm+1] + x[i0+4*sm+1];
+          t2r = x[i0+2*sm]   + x[i0+3*sm];
+          t2i = x[i0+2*sm+1] + x[i0+3*sm+1];
+          t3r = x[i0+sm]   - x[i0+4*sm];
+          t3i = x[i0+sm+1] - x[i0+4*sm+1];
+          t4r = x[i0+2*sm]   - x[i0+3*sm];
+          t4i = x[i0+2*sm+1] - x[i0+3*sm+1];
+          u1r = a0r + c1*t1r + c2*t2r;
+          u1i = a0i + c1*t1i + c2*t2i;
+          u2r = a0r + c2*t1r + c1*t2r;
+          u2i = a0i + c2*t1i + c1*t2i;
+          //  v1 = i*(s1*t3+s2*t4),  v2 = i*(s2*t3-s1*t4)
+          v1r = -(s1*t3i + s2*t4i);
+          v1i =   s1*t3r + s2*t4r;
+          v2r = -(s2*t3i - s1*t4i);
+          v2i =   s2*t3r - s1*t4r;
+          y[o0]   = a0r + t1r + t2r;
+          y[o0+1] = a0i + t1i + t2i;
+          br = u1r + v1r;
+          bi = u1i + v1i;
+          y[o0+ss]     = br*w[0] - bi*w[1];
+          y[o0+ss+1]   = br*w[1] + bi*w[0];
+          br = u2r + v2r;
+          bi = u2i + v2i;
+          y[o0+2*ss]   = br*w[2] - bi*w[3];
+          y[o0+2*ss+1] = br*w[3] + bi*w[2];
+          br = u2r - v2r;
+          bi = u2i - v2i;
+          y[o0+3*ss]   = br*w[4] - bi*w[5];
+          y[o0+3*ss+1] = br*w[5] + bi*w[4];
+          br = u1r - v1r;
+          bi = u1i - v1i;
+          y[o0+4*ss]   = br*w[6] - bi*w[7];
+          y[o0+4*ss+1] = br*w[7] + bi*w[6];
+        }
+      }
+    }
+
+    static void FFTRadixN ( rvector x, rvector y, int s, int m, int r,
+                            rvector tw, bool Forward )  {
+    //  general odd radix r<=19; r roots of unity follow the twiddles
+    realtype ar[19],ai[19], br,bi, wr,wi;
+    rvector  w,rt;
+    int      p,q,j,k,l, i0,o0, sm;
+      sm = 2*s*m;
+      rt = &(tw[2*m*(r-1)]);
+      for (p=0;p<m;p++)  {
+        w = &(tw[2*p*(r-1)]);
+        for (q=0;q<s;q++)  {
+          i0 = 2*(q+s*p);
+          o0 = 2*(q+r*s*p);
+          for (j=0;j<r;j++)  {
+            ar[j] = x[i0+j*sm];
+            ai[j] = x[i0+j*sm+1];
+          }
+          br = ar[0];
+          bi = ai[0];
+          for (j=1;j<r;j++)  {
+            br += ar[j];
+            bi += ai[j];
+          }
+          y[o0]   = br;
+          y[o0+1] = bi;
+          for (k=1;k<r;k++)  {
+            br = ar[0];
+            bi = ai[0];
+            l  = 0;
+            for (j=1;j<r;j++)  {
+              l += k;
+              if (l>=r)  l -= r;
+              wr = rt[2*l];
+              if (Forward)  wi =  rt[2*l+1];
+                      else  wi = -rt[2*l+1];
+              br += ar[j]*wr - ai[j]*wi;
+              bi += ar[j]*wi + ai[j]*wr;
+            }
+            wr = w[2*k-2];
+            if (Forward)  wi =  w[2*k-1];
+                    else  wi = -w[2*k-1];
+            y[o0+2*k*s]   = br*wr - bi*wi;
+            y[o0+2*k*s+1] = br*wi + bi*wr;
+          }
+        }
+      }
+    }
+
+
+    //  ----------------------  FFTPlan  ---------------------------
+
+    FFTPlan::FFTPlan()  {
+      InitFFTPlan();
+    }
+
+    FFTPlan::~FFTPlan()  {
+      FreeMemory();
+    }
+
+    void FFTPlan::InitFFTPlan()  {
+      N       = 0;
+      nStages = 0;
+      radix   = NULL;
+      twStart = NULL;
+      twiddle = NULL;
+      work    = NULL;
+    }
+
+    void FFTPlan::FreeMemory()  {
+      FreeVectorMemory ( radix  ,0 );
+      FreeVectorMemory ( twStart,0 );
+      FreeVectorMemory ( twiddle,0 );
+      FreeVectorMemory ( work   ,0 );
+      N       = 0;
+      nStages = 0;
+    }
+
+    bool FFTPlan::SetSize ( int n )  {
+    int      f[9] = {4,2,3,5,7,11,13,17,19};
+    int      i,k,p,r,m,len,nt;
+    realtype a;
+
+      FreeMemory();
+      if (!FFTSizeOk(n))  return false;
+
+      N = n;
+
+      //  factorize n, taking radix 4 first
+      GetVectorMemory ( radix  ,32,0 );
+      GetVectorMemory ( twStart,32,0 );
+      m = n;
+      for (i=0;i<9;i++)
+        while ((m % f[i])==0)  {
+          radix[nStages++] = f[i];
+          m /= f[i];
+        }
+
+      //  twiddle factors exp(-2*Pi*i*p*k/len), p<len/r, 0<k<r, for
+      //  every stage, followed by roots of unity for radices over 5
+      nt  = 0;
+      len = N;
+      for (i=0;i<nStages;i++)  {
+        r = radix[i];
+        twStart[i] = nt;
+        nt += 2*(len/r)*(r-1);
+        if (r>5)  nt += 2*r;
+        len /= r;
+      }
+      GetVectorMemory ( twiddle,IMax(nt,1),0 );
+
+      len = N;
+      for (i=0;i<nStages;i++)  {
+        r  = radix[i];
+        m  = len/r;
+        nt = twStart[i];
+        for (p=0;p<m;p++)
+          for (k=1;k<r;k++)  {
+            a = -2.0*Pi*((realtype)(p*k))/len;
+            twiddle[nt++] = cos(a);
+            twiddle[nt++] = sin(a);
+          }
+        if (r>5)
+          for (k=0;k<r;k++)  {
+            a = -2.0*Pi*k/r;
+            twiddle[nt++] = cos(a);
+            twiddle[nt++] = sin(a);
+          }
+        len = m;
+      }
+
+      GetVectorMemory ( work,2*N,0 );
+
+      return true;
+
+    }
+
+    void FFTPlan::Transform ( rvector c, bool Forward )  {
+    rvector x,y,t;
+    int     i,s,m,len;
+
+      if (N<=1)  return;
+
+      x   = c;
+      y   = work;
+      s   = 1;
+      len = N;
+      for (i=0;i<nStages;i++)  {
+        m = len/radix[i];
+        t = &(twiddle[twStart[i]]);
+        switch (radix[i])  {
+          case 2  : FFTRadix2 ( x,y,s,m,t,Forward );           break;
+          case 3  : FFTRadix3 ( x,y,s,m,t,Forward );           break;
+          case 4  : FFTRadix4 ( x,y,s,m,t,Forward );           break;
+          case 5  : FFTRadix5 ( x,y,s,m,t,Forward );           break;
+          default : FFTRadixN ( x,y,s,m,radix[i],t,Forward );
+        }
+        t    = x;
+        x    = y;
+        y    = t;
+        s   *= radix[i];
+        len  = m;
+      }
+
+      if (x!=c)
+        for (i=0;i<2*N;i++)
+          c[i] = x[i];
+
+    }
+
+
+    //  --------------------  RealFFTPlan  -------------------------
+
+    RealFFTPlan::RealFFTPlan()  {
+      InitRealFFTPlan();
+    }
+
+    RealFFTPlan::~RealFFTPlan()  {
+      FreeMemory();
+    }
+
+    void RealFFTPlan::InitRealFFTPlan()  {
+      N    = 0;
+      wk   = NULL;
+      work = NULL;
+    }
+
+    void RealFFTPlan::FreeMemory()  {
+      plan.FreeMemory();
+      FreeVectorMemory ( wk  ,0 );
+      FreeVectorMemory ( work,0 );
+      N = 0;
+    }
+
+    bool RealFFTPlan::SetSize ( int n )  {
+    realtype a;
+    int      k,h;
+
+      FreeMemory();
+      if (!FFTSizeOk(n))  return false;
+
+      N = n;
+      if (n % 2)  {
+        plan.SetSize    ( n );
+        GetVectorMemory ( work,2*n,0 );
+      } else  {
+        //  n real points are transformed as n/2 complex ones
+        h = n/2;
+        plan.SetSize    ( h );
+        GetVectorMemory ( wk,2*(h+1),0 );
+        for (k=0;k<=h;k++)  {
+          a = -2.0*Pi*k/n;
+          wk[2*k]   = cos(a);
+          wk[2*k+1] = sin(a);
+        }
+      }
+
+      return true;
+
+    }
+
+    void RealFFTPlan::Forward ( rvector r, rvector c )  {
+    realtype zr,zi, zkr,zki,zjr,zji, er,ei,or_,oi, wr,wi;
+    int      i,j,k,h;
+
+      if (N<=0)  return;
+
+      h = N/2;
+
+      if (N % 2)  {
+        for (i=0;i<N;i++)  {
+          work[2*i]   = r[i];
+          work[2*i+1] = 0.0;
+        }
+        plan.Transform ( work,true );
+        for (i=0;i<=2*h+1;i++)
+          c[i] = work[i];
+        return;
+      }
+
+      //  Z = FFT(z), z[k] = r[2k] + i*r[2k+1], gives transforms of
+      //  even and odd points as E[k] = (Z[k]+conj(Z[h-k]))/2 and
+      //  O[k] = (Z[k]-conj(Z[h-k]))/(2i), and X[k] = E[k] + W^k*O[k]
+      for (i=0;i<N;i++)
+        c[i] = r[i];
+      plan.Transform ( c,true );
+
+      zr = c[0];
+      zi = c[1];
+      for (k=1;2*k<=h;k++)  {
+        j   = h-k;
+        zkr = c[2*k];  zki = c[2*k+1];
+        zjr = c[2*j];  zji = c[2*j+1];
+        er  = 0.5*(zkr + zjr);
+        ei  = 0.5*(zki - zji);
+        or_ =  0.5*(zki + zji);
+        oi  = -0.5*(zkr - zjr);
+        wr  = wk[2*k];
+        wi  = wk[2*k+1];
+        c[2*k]   = er + wr*or_ - wi*oi;
+        c[2*k+1] = ei + wr*oi  + wi*or_;
+        if (j!=k)  {
+          //  X[h-k] = conj(E[k]) + W^(h-k)*conj(O[k])
+          wr = wk[2*j];
+          wi = wk[2*j+1];
+          c[2*j]   =  er + wr*or_ + wi*oi;
+          c[2*j+1] = -ei + wi*or_ - wr*oi;
+        }
+      }
+      c[0]     = zr + zi;
+      c[1]     = 0.0;
+      c[2*h]   = zr - zi;
+      c[2*h+1] = 0.0;
+
+    }
+
+    void RealFFTPlan::Backward ( rvector c, rvector r )  {
+    realtype xkr,xki,xjr,xji, er,ei,dr,di, wr,wi;
+    int      i,j,k,h;
+
+      if (N<=0)  return;
+
+      h = N/2;
+
+      if (N % 2)  {
+        work[0] = c[0];
+        work[1] = 0.0;
+        for (k=1;k<=h;k++)  {
+          work[2*k]       =  c[2*k];
+          work[2*k+1]     =  c[2*k+1];
+          work[2*(N-k)]   =  c[2*k];
+          work[2*(N-k)+1] = -c[2*k+1];
+        }
+        plan.Transform ( work,false );
+        for (i=0;i<N;i++)
+          r[i] = work[2*i];
+        return;
+      }
+
+      //  Z[k] = E[k] + i*O[k], E[k] = X[k]+conj(X[h-k]) and
+      //  O[k] = (X[k]-conj(X[h-k]))/W^k, which gives 2*h*z after
+      //  the backward transform
+      for (k=0;k<h;k++)  {
+        j   = h-k;
+        xkr = c[2*k];
+        xjr = c[2*j];
+        if (k>0)  {
+          xki = c[2*k+1];
+          xji = c[2*j+1];
+        } else  {
+          xki = 0.0;
+          xji = 0.0;
+        }
+        er = xkr + xjr;
+        ei = xki - xji;
+        dr = xkr - xjr;
+        di = xki + xji;
+        wr =  wk[2*k];
+        wi = -wk[2*k+1];
+        xkr = dr*wr - di*wi;
+        xki = dr*wi + di*wr;
+        r[2*k]   = er - xki;
+        r[2*k+1] = ei + xkr;
+      }
+      plan.Transform ( r,false );
+
+    }
+
+
+    //  ---------------------  RealFFT3D  --------------------------
+
+    RealFFT3D::RealFFT3D()  {
+      InitRealFFT3D();
+    }
+
+    RealFFT3D::~RealFFT3D()  {
+      FreeMemory();
+    }
+
+    void RealFFT3D::InitRealFFT3D()  {
+      NX    = 0;
+      NY    = 0;
+      NZ    = 0;
+      NZC   = 0;
+      block = NULL;
+    }
+
+    void RealFFT3D::FreeMemory()  {
+      planZ.FreeMemory();
+      planY.FreeMemory();
+      planX.FreeMemory();
+      FreeVectorMemory ( block,0 );
+      NX  = 0;
+      NY  = 0;
+      NZ  = 0;
+      NZC = 0;
+    }
+
+    bool RealFFT3D::SetGrid ( int nx, int ny, int nz )  {
+
+      FreeMemory();
+      if ((!FFTSizeOk(nx)) || (!FFTSizeOk(ny)) || (!FFTSizeOk(nz)))
+        return false;
+
+      NX  = nx;
+      NY  = ny;
+      NZ  = nz;
+      NZC = nz/2 + 1;
+      planX.SetSize ( nx );
+      planY.SetSize ( ny );
+      planZ.SetSize ( nz );
+      GetVectorMemory ( block,2*FFT_ColBlock*IMax(nx,ny),0 );
+
+      return true;
+
+    }
+
+    void RealFFT3D::GetGrid ( int & nx, int & ny, int & nz )  {
+      nx = NX;
+      ny = NY;
+      nz = NZ;
+    }
+
+    int RealFFT3D::GetComplexLength()  {
+      return 2*NX*NY*NZC;
+    }
+
+    void RealFFT3D::ColumnFFT ( rvector c, PFFTPlan plan, int stride,
+                                int nCols, bool Forward )  {
+    //   Transforms columns j=0..nCols-1 of complex vector c, of which
+    // element i is c[j+i*stride], in blocks of FFT_ColBlock columns
+    int n,i,j0,b,nb,k,l;
+
+      n = plan->GetSize();
+      if (n<=1)  return;
+
+      for (j0=0;j0<nCols;j0+=FFT_ColBlock)  {
+        nb = IMin ( FFT_ColBlock,nCols-j0 );
+        for (i=0;i<n;i++)  {
+          k = 2*(j0+i*stride);
+          l = 2*i;
+          for (b=0;b<nb;b++)  {
+            block[l]   = c[k++];
+            block[l+1] = c[k++];
+            l += 2*n;
+          }
+        }
+        for (b=0;b<nb;b++)
+          plan->Transform ( &(block[2*b*n]),Forward );
+        for (i=0;i<n;i++)  {
+          k = 2*(j0+i*stride);
+          l = 2*i;
+          for (b=0;b<nb;b++)  {
+            c[k++] = block[l];
+            c[k++] = block[l+1];
+            l += 2*n;
+          }
+        }
+      }
+
+    }
+
+    void RealFFT3D::Forward ( rvector r, rvector c )  {
+    int i;
+
+      for (i=0;i<NX*NY;i++)
+        planZ.Forward ( &(r[i*NZ]),&(c[2*i*NZC]) );
+
+      for (i=0;i<NX;i++)
+        ColumnFFT ( &(c[2*i*NY*NZC]),&planY,NZC,NZC,true );
+
+      ColumnFFT ( c,&planX,NY*NZC,NY*NZC,true );
+
+    }
+
+    void RealFFT3D::Backward ( rvector c, rvector r )  {
+    int i;
+
+      ColumnFFT ( c,&planX,NY*NZC,NY*NZC,false );
+
+      for (i=0;i<NX;i++)
+        ColumnFFT ( &(c[2*i*NY*NZC]),&planY,NZC,NZC,false );
+
+      for (i=0;i<NX*NY;i++)
+        planZ.Backward ( &(c[2*i*NZC]),&(r[i*NZ]) );
+
+    }
+
   }  // namespace math
 
 }  // namespace mmdb
@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -33,6 +33,11 @@
 //                   mmdb::math::TwoFFT
 //                   mmdb::math::Convolve
 //                   mmdb::math::mConvolve
+//                   mmdb::math::FFTSizeOk
+//                   mmdb::math::GetFFTGridSample
+//  **** Classes :   mmdb::math::FFTPlan     ( planned complex 1-D FFT )
+//       ~~~~~~~~~   mmdb::math::RealFFTPlan ( planned real 1-D FFT    )
+//                   mmdb::math::RealFFT3D   ( planned real 3-D FFT    )
 //
 //  (C) E.Krissinel  2005-2013
 //
@@ -86,6 +91,150 @@ namespace mmdb  {
     //
     extern void mConvolve ( rvector data, int n, int m );
 
+
+    //  =======================  Planned FFT  ==========================
+    //
+    //   Functions above are limited to 1-D transforms of powers of two
+    // and recalculate trigonometric functions on every call. Classes
+    // below make 'plans' for given sizes: the size is factorized into
+    // radices 4,2,3,5,7,11,13,17 and 19, and all twiddle factors are
+    // calculated once in SetSize(..)/SetGrid(..). The transforms are
+    // self-sorting (Stockham) and work on 0-based vectors of complex
+    // numbers stored as re,im,re,im,... . Transforms are not
+    // normalized: a forward transform followed by the backward one
+    // multiplies the data by the total number of points.
+    //   Plans keep their own scratch space, therefore one plan must
+    // not be used in concurrent calls, but different plans may.
+
+    //   FFTSizeOk(..) returns true if n>0 has no prime factors
+    // greater than 19. For n>1, this is the same rule as in
+    // all_factors_le_19(..) of CCP4 csymlib, so that grids chosen by
+    // set_fft_grid(..) may be used with the plans.
+    extern bool FFTSizeOk ( int n );
+
+    //   GetFFTGridSample(..) returns the number of grid points, which
+    // is a multiple of nmul, satisfies FFTSizeOk(..) and gives the
+    // sampling rate of about 'sample' (up to 1.6 if sample<1.0) of
+    // minimal sampling minsmp, or -1 if it is not found. It follows
+    // get_grid_sample(..) of CCP4 csymlib, which is used by
+    // set_fft_grid(..) with nmul taken from the Laue group.
+    extern int GetFFTGridSample ( int minsmp, int nmul,
+                                  realtype sample );
+
+
+    DefineClass(FFTPlan);
+
+    class FFTPlan  {
+
+      public :
+
+        FFTPlan ();
+        ~FFTPlan();
+
+        //   SetSize(..) makes the plan for n complex points. Returns
+        // false and clears the plan if FFTSizeOk(n) is false.
+        bool  SetSize   ( int n );
+        int   GetSize   ()  { return N; }
+
+        //   Transform(..) replaces c[0..2*n-1] with its discrete Fourier
+        // transform, c[k] = Sum_j c[j]*exp(-+2*Pi*i*j*k/n), the minus
+        // sign being used in forward transforms.
+        void  Transform ( rvector c, bool Forward=true );
+
+        void  FreeMemory();
+
+      protected :
+        int      N;        // number of complex points
+        int      nStages;  // number of radices
+        ivector  radix;    // radices [0..nStages-1]
+        ivector  twStart;  // stage starts in twiddle[]
+        rvector  twiddle;  // twiddle factors and radix roots
+        rvector  work;     // scratch [0..2*N-1]
+
+        void  InitFFTPlan();
+
+    };
+
+
+    DefineClass(RealFFTPlan);
+
+    class RealFFTPlan  {
+
+      public :
+
+        RealFFTPlan ();
+        ~RealFFTPlan();
+
+        bool  SetSize  ( int n );
+        int   GetSize  ()  { return N; }
+
+        //   Forward(..) calculates the first n/2+1 complex Fourier
+        // coefficients c[0..2*(n/2)+1] of real data r[0..n-1]; the
+        // rest are complex conjugates of these.
+        void  Forward  ( rvector r, rvector c );
+
+        //   Backward(..) calculates real data r[0..n-1], multiplied by
+        // n, from its n/2+1 Fourier coefficients c[0..2*(n/2)+1]. The
+        // imaginary parts of c[0] and, for even n, c[n/2] are ignored.
+        void  Backward ( rvector c, rvector r );
+
+        void  FreeMemory();
+
+      protected :
+        int      N;      // number of real points
+        FFTPlan  plan;   // plan for n/2 (even n) or n (odd n) points
+        rvector  wk;     // exp(-2*Pi*i*k/n), k=0..n/2, for even n
+        rvector  work;   // scratch [0..2*N-1] for odd n
+
+        void  InitRealFFTPlan();
+
+    };
+
+
+    //   RealFFT3D makes 3-D Fourier transforms of real grids
+    // r[(ix*ny+iy)*nz+iz], with iz running fastest, into complex
+    // half-grids c[(ix*ny+iy)*nzc+kz], kz=0..nzc-1, nzc = nz/2+1,
+    // of which each element takes two reals. The transforms along z
+    // are made on contiguous rows and those along y and x on blocks
+    // of neighbouring columns, gathered into contiguous scratch.
+
+    DefineClass(RealFFT3D);
+
+    class RealFFT3D  {
+
+      public :
+
+        RealFFT3D ();
+        ~RealFFT3D();
+
+        //   SetGrid(..) makes the plan for nx*ny*nz grid. Returns false
+        // and clears the plan if any of the sizes fails FFTSizeOk(..).
+        bool  SetGrid  ( int nx, int ny, int nz );
+        void  GetGrid  ( int & nx, int & ny, int & nz );
+
+        //   Length of vector c, in reals: 2*nx*ny*(nz/2+1)
+        int   GetComplexLength();
+
+        void  Forward  ( rvector r, rvector c );
+
+        //   Backward(..) calculates r multiplied by nx*ny*nz. Vector c
+        // is overwritten.
+        void  Backward ( rvector c, rvector r );
+
+        void  FreeMemory();
+
+      protected :
+        int          NX,NY,NZ,NZC;
+        RealFFTPlan  planZ;
+        FFTPlan      planY,planX;
+        rvector      block;   // scratch for blocks of columns
+
+        void  InitRealFFT3D();
+        void  ColumnFFT ( rvector c, PFFTPlan plan, int stride,
+                          int nCols, bool Forward );
+
+    };
+
   }  // namespace math
 
 }  // namespace mmdb
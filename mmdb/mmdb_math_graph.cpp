@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -32,7 +32,9 @@
 //       ~~~~~~~~~~
 //  **** Classes :  Vertex     ( graph vertex                        )
 //       ~~~~~~~~~  Edge       ( graph edge                          )
+//                  GraphTemplates ( cache of residue bond patterns  )
 //                  Graph      ( structural graph                    )
+//                  GraphFingerprint ( graph screening and hashing   )
 //                  GMatch      ( GMatch of structural graphs          )
 //                  GraphMatch ( CSIA algorithms for graphs GMatching )
 //
@@ -52,6 +54,7 @@
 
 #include "mmdb_math_graph.h"
 #include "mmdb_tables.h"
+#include "mmdb_sort.h"
 
 
 namespace mmdb  {
@@ -404,6 +407,157 @@ namespace mmdb  {
     MakeStreamFunctions(Edge)
 
 
+    //  =====================  GraphTemplates  ======================
+
+    GraphTemplates::GraphTemplates()  {
+      tmpl       = NULL;
+      nTemplates = 0;
+      nTAlloc    = 0;
+      hash       = NULL;
+      hashSize   = 0;
+      frozen     = false;
+    }
+
+    GraphTemplates::~GraphTemplates()  {
+      FreeMemory();
+    }
+
+    void  GraphTemplates::FreeMemory()  {
+    int i;
+      if (tmpl)  {
+        for (i=0;i<nTemplates;i++)
+          if (tmpl[i])  {
+            if (tmpl[i]->aname)  delete[] tmpl[i]->aname;
+            FreeVectorMemory ( tmpl[i]->b1,0 );
+            FreeVectorMemory ( tmpl[i]->b2,0 );
+            delete tmpl[i];
+          }
+        delete[] tmpl;
+      }
+      FreeVectorMemory ( hash,0 );
+      tmpl       = NULL;
+      nTemplates = 0;
+      nTAlloc    = 0;
+      hashSize   = 0;
+    }
+
+    static word templateKey ( PResidue R, PPVertex V, int nV )  {
+    //  FNV-1a hash of the residue name and atom names, each name
+    //  including its terminating zero
+    word key;
+    cpstr p;
+    int   i;
+      key = 2166136261U;
+      p   = R->name;
+      do  key = (key ^ word((unsigned char)(*p))) * 16777619U;
+        while (*(p++));
+      for (i=0;i<nV;i++)  {
+        p = R->atom[V[i]->GetUserID()]->name;
+        do  key = (key ^ word((unsigned char)(*p))) * 16777619U;
+          while (*(p++));
+      }
+      return key;
+    }
+
+    PGraphTemplate GraphTemplates::FindTemplate ( PResidue R,
+                                                  PPVertex V, int nV )  {
+    PGraphTemplate T;
+    word           key;
+    int            i,k;
+      if (!hash)  return NULL;
+      key = templateKey ( R,V,nV );
+      i   = int(key & word(hashSize-1));
+      while (hash[i])  {
+        T = tmpl[hash[i]-1];
+        if ((T->key==key) && (T->nAtoms==nV) &&
+            (!strcmp(T->resName,R->name)))  {
+          for (k=0;k<nV;k++)
+            if (strcmp(T->aname[k],R->atom[V[k]->GetUserID()]->name))
+              break;
+          if (k>=nV)  return T;
+        }
+        i = (i+1) & (hashSize-1);
+      }
+      return NULL;
+    }
+
+    void  GraphTemplates::HashTemplate ( int tNo )  {
+    //  Puts template tNo into the hash table, which is kept at most
+    //  half full, open addressing with linear probing
+    int i,k;
+      if (2*(nTemplates+1)>hashSize)  {
+        FreeVectorMemory ( hash,0 );
+        hashSize = IMax(64,2*hashSize);
+        GetVectorMemory  ( hash,hashSize,0 );
+        for (i=0;i<hashSize;i++)
+          hash[i] = 0;
+        for (k=0;k<tNo;k++)  {
+          i = int(tmpl[k]->key & word(hashSize-1));
+          while (hash[i])  i = (i+1) & (hashSize-1);
+          hash[i] = k+1;
+        }
+      }
+      i = int(tmpl[tNo]->key & word(hashSize-1));
+      while (hash[i])  i = (i+1) & (hashSize-1);
+      hash[i] = tNo+1;
+    }
+
+    void  GraphTemplates::AddTemplate ( PResidue R, PPVertex V, int nV,
+                                        PPEdge E, int nE )  {
+    PPGraphTemplate T1;
+    PGraphTemplate  T;
+    ivector         nb;
+    int             i;
+
+      //  a residue with unbonded atoms is likely to be distorted
+      //  and is not used as a template
+      if (nV>1)  {
+        nb = NULL;
+        GetVectorMemory ( nb,nV,0 );
+        for (i=0;i<nV;i++)
+          nb[i] = 0;
+        for (i=0;i<nE;i++)  {
+          nb[E[i]->GetVertex1()-1]++;
+          nb[E[i]->GetVertex2()-1]++;
+        }
+        for (i=0;(i<nV) && nb[i];i++);
+        FreeVectorMemory ( nb,0 );
+        if (i<nV)  return;
+      }
+
+      if (nTemplates>=nTAlloc)  {
+        nTAlloc = 2*nTAlloc + 16;
+        T1 = new PGraphTemplate[nTAlloc];
+        for (i=0;i<nTemplates;i++)
+          T1[i] = tmpl[i];
+        if (tmpl)  delete[] tmpl;
+        tmpl = T1;
+      }
+
+      T = new GraphTemplate();
+      strcpy ( T->resName,R->name );
+      T->nAtoms = nV;
+      T->aname  = new AtomName[nV];
+      T->b1     = NULL;
+      T->b2     = NULL;
+      T->nBonds = nE;
+      T->key    = templateKey ( R,V,nV );
+      GetVectorMemory ( T->b1,IMax(nE,1),0 );
+      GetVectorMemory ( T->b2,IMax(nE,1),0 );
+      for (i=0;i<nV;i++)
+        strcpy ( T->aname[i],R->atom[V[i]->GetUserID()]->name );
+      for (i=0;i<nE;i++)  {
+        T->b1[i] = E[i]->GetVertex1() - 1;
+        T->b2[i] = E[i]->GetVertex2() - 1;
+      }
+
+      tmpl[nTemplates] = T;
+      HashTemplate ( nTemplates );
+      nTemplates++;
+
+    }
+
+
     //  ==========================  Graph  ============================
 
     Graph::Graph() : io::Stream()  {
@@ -623,7 +777,8 @@ namespace mmdb  {
     }
 
 
-    int  Graph::MakeGraph ( PResidue R, cpstr altLoc )  {
+    int  Graph::MakeGraph ( PResidue R, cpstr altLoc,
+                            PGraphTemplates T )  {
     int      i,j, a1,a2,e1,e2, nAltLocs,alflag, rc;
     bool     B;
     rvector  occupancy;
@@ -631,6 +786,7 @@ namespace mmdb  {
     PAltLoc  aL;
     realtype dx,dy,dz, sr;
     PEdge    G;
+    PGraphTemplate tmpl;
 
       rc = MKGRAPH_Ok;
       //  reset graph
@@ -723,29 +879,41 @@ namespace mmdb  {
       for (i=0;i<nEAlloc;i++)
         edge[i] = NULL;
 
-      for (i=0;i<nVertices;i++)  {
-        a1 = vertex[i]->user_id;
-        e1 = vertex[i]->type;
-        if (e1>nElementNames)  e1 = 6;
-        e1--;
-        for (j=i+1;j<nVertices;j++)  {
-          a2 = vertex[j]->user_id;
-          e2 = vertex[j]->type;
-          if (e2>nElementNames)  e2 = 6;
-          e2--;
-          dx = R->atom[a2]->x - R->atom[a1]->x;
-          dy = R->atom[a2]->y - R->atom[a1]->y;
-          dz = R->atom[a2]->z - R->atom[a1]->z;
-    //      sr = CovalentRadius[e1] + CovalentRadius[e2] + 0.15;
-          sr = CovalentRadius[e1] + CovalentRadius[e2] + 0.25;
-          if (dx*dx+dy*dy+dz*dz<sr*sr)  {  // it's a bond
-            G = new Edge(i+1,j+1,1);
-            AddEdge ( G );
+      //  look up template of the residue
+      tmpl = NULL;
+      if (T)  tmpl = T->FindTemplate ( R,vertex,nVertices );
+
+      if ((!tmpl) || (!MakeTemplateEdges(R,tmpl)))  {
+        for (i=0;i<nVertices;i++)  {
+          a1 = vertex[i]->user_id;
+          e1 = vertex[i]->type;
+          if (e1>nElementNames)  e1 = 6;
+          e1--;
+          for (j=i+1;j<nVertices;j++)  {
+            a2 = vertex[j]->user_id;
+            e2 = vertex[j]->type;
+            if (e2>nElementNames)  e2 = 6;
+            e2--;
+            dx = R->atom[a2]->x - R->atom[a1]->x;
+            dy = R->atom[a2]->y - R->atom[a1]->y;
+            dz = R->atom[a2]->z - R->atom[a1]->z;
+      //      sr = CovalentRadius[e1] + CovalentRadius[e2] + 0.15;
+            sr = CovalentRadius[e1] + CovalentRadius[e2] + 0.25;
+            if (dx*dx+dy*dy+dz*dz<sr*sr)  {  // it's a bond
+              G = new Edge(i+1,j+1,1);
+              AddEdge ( G );
+            }
           }
         }
-        vertex[i]->id = i+1;
+        //  learn the residue only if it is new; a residue failing
+        //  its template check does not replace the template
+        if (T && (!tmpl) && (!T->frozen))
+          T->AddTemplate ( R,vertex,nVertices,edge,nEdges );
       }
 
+      for (i=0;i<nVertices;i++)
+        vertex[i]->id = i+1;
+
       if (aL)  delete[] aL;
       FreeVectorMemory ( occupancy,0 );
 
@@ -756,6 +924,42 @@ namespace mmdb  {
 
     }
 
+    bool  Graph::MakeTemplateEdges ( PResidue R, PGraphTemplate T )  {
+    //   Makes edges of residue R from template T. Only template bonds
+    // are checked: they must be within the bond cut-off distances
+    // used in full calculation. Returns false and makes no edges if
+    // this is not so, e.g. in distorted residues. Non-bonded pairs
+    // are not checked (see GraphTemplates).
+    PAtom    A1,A2;
+    realtype dx,dy,dz, sr;
+    int      i,j,k, e1,e2;
+
+      for (k=0;k<T->nBonds;k++)  {
+        i  = T->b1[k];
+        j  = T->b2[k];
+        A1 = R->atom[vertex[i]->user_id];
+        A2 = R->atom[vertex[j]->user_id];
+        e1 = vertex[i]->type;
+        if (e1>nElementNames)  e1 = 6;
+        e1--;
+        e2 = vertex[j]->type;
+        if (e2>nElementNames)  e2 = 6;
+        e2--;
+        dx = A2->x - A1->x;
+        dy = A2->y - A1->y;
+        dz = A2->z - A1->z;
+        sr = CovalentRadius[e1] + CovalentRadius[e2] + 0.25;
+        if (dx*dx+dy*dy+dz*dz>=sr*sr)  return false;
+      }
+
+      //  template bonds are kept in the order of full calculation
+      for (i=0;i<T->nBonds;i++)
+        AddEdge ( new Edge(T->b1[i]+1,T->b2[i]+1,1) );
+
+      return true;
+
+    }
+
     int  Graph::MakeGraph ( PPAtom atom, int nAtoms )  {
     PEdge    G;
     char     atomID[100];
@@ -1104,7 +1308,7 @@ namespace mmdb  {
       0x00000080
     };
 
-    void Graph::IdentifyRings()  {
+    void Graph::IdentifyRings ( ivector nRings )  {
     GraphMatch GM;
     Graph      ring;
     ivector    F1,F2;
@@ -1119,7 +1323,13 @@ namespace mmdb  {
 
       GM.SetFlag ( GMF_UniqueMatch );
 
-      for (n=3;n<=10;n++)  {
+      if (nRings)
+        for (n=0;n<=10;n++)
+          nRings[n] = 0;
+
+      //  rings larger than the graph are not looked for, because
+      //  MatchGraphs(..) would then match the graph into the ring
+      for (n=3;(n<=10) && (n<=nVertices);n++)  {
 
         ring.Reset();
 
@@ -1141,6 +1351,7 @@ namespace mmdb  {
         GM.MatchGraphs ( this,&ring,n,false,EXTTYPE_Ignore );
 
         nrings = GM.GetNofMatches();
+        if (nRings)  nRings[n] = nrings;
         for (i=0;i<nrings;i++)  {
           GM.GetMatch ( i,F1,F2,nv,p1,p2 );
           for (j=1;j<nv;j++)
@@ -1401,6 +1612,488 @@ namespace mmdb  {
     MakeStreamFunctions(Graph)
 
 
+    //  ====================  GraphFingerprint  ======================
+
+    static word MixWord ( word h )  {
+    //  32-bit finalizer of MurmurHash3
+      h ^= h >> 16;
+      h *= 0x85EBCA6B;
+      h ^= h >> 13;
+      h *= 0xC2B2AE35;
+      h ^= h >> 16;
+      return h;
+    }
+
+    static word HashCombine ( word h, word x )  {
+      return MixWord ( h ^ (x + 0x9E3779B9 + (h << 6) + (h >> 2)) );
+    }
+
+    static int CountDistinct ( wvector L, wvector srt, int n )  {
+    int i,nc;
+      for (i=0;i<n;i++)
+        srt[i] = L[i];
+      SortArray ( srt,n );
+      nc = 0;
+      for (i=0;i<n;i++)
+        if ((i==0) || (srt[i]!=srt[i-1]))  nc++;
+      return nc;
+    }
+
+
+    GraphFingerprint::GraphFingerprint() : io::Stream()  {
+      InitFingerprint();
+    }
+
+    GraphFingerprint::GraphFingerprint ( PGraph G ) : io::Stream()  {
+      InitFingerprint();
+      MakeFingerprint ( G );
+    }
+
+    GraphFingerprint::GraphFingerprint ( io::RPStream Object )
+                    : io::Stream(Object)  {
+      InitFingerprint();
+    }
+
+    GraphFingerprint::~GraphFingerprint()  {
+      FreeMemory();
+    }
+
+    void  GraphFingerprint::InitFingerprint()  {
+      vType  = NULL;
+      vCount = NULL;
+      eType  = NULL;
+      eCount = NULL;
+      FreeMemory();
+    }
+
+    void  GraphFingerprint::FreeMemory()  {
+    int i;
+      FreeVectorMemory ( vType ,0 );
+      FreeVectorMemory ( vCount,0 );
+      FreeVectorMemory ( eType ,0 );
+      FreeVectorMemory ( eCount,0 );
+      nVertices = 0;
+      nEdges    = 0;
+      nVTypes   = 0;
+      nETypes   = 0;
+      for (i=0;i<=GFP_MaxRing;i++)
+        nRings[i] = 0;
+      for (i=0;i<GFP_PathWords;i++)
+        pathBits[i] = 0;
+      hash1 = 0;
+      hash2 = 0;
+    }
+
+    void  GraphFingerprint::MakeFingerprint ( PGraph G )  {
+    Graph   R;
+    ivector vt,nb,bt,first,seq;
+    bvector onPath;
+    int     i,j,k,n;
+
+      FreeMemory();
+
+      n = G->nVertices;
+      if (n<=0)  return;
+
+      if (G->nGAlloc<n)  G->Build ( true );
+
+      nVertices = n;
+
+      //  vertex types as compared in GraphMatch, and adjacency
+      //  lists made of the connectivity matrix
+
+      GetVectorMemory ( vt   ,n  ,0 );
+      GetVectorMemory ( first,n+1,0 );
+      for (i=0;i<n;i++)
+        vt[i] = G->vertex[i]->GetType() & (~ATOM_LEAVING);
+
+      k = 0;
+      for (i=1;i<=n;i++)  {
+        first[i-1] = k;
+        for (j=1;j<=n;j++)
+          if ((i!=j) && G->graph[i][j])  k++;
+      }
+      first[n] = k;
+      nEdges   = k/2;
+
+      GetVectorMemory ( nb,k+1,0 );
+      GetVectorMemory ( bt,k+1,0 );
+      k = 0;
+      for (i=1;i<=n;i++)
+        for (j=1;j<=n;j++)
+          if ((i!=j) && G->graph[i][j])  {
+            nb[k] = j-1;
+            bt[k] = G->graph[i][j];
+            k++;
+          }
+
+      MakeHistograms ( G );
+
+      //  rings are found on a copy so that G is left intact
+      R.Copy ( G );
+      R.IdentifyRings ( nRings );
+
+      GetVectorMemory ( seq   ,2*GFP_PathLen+1,0 );
+      GetVectorMemory ( onPath,n              ,0 );
+      for (i=0;i<n;i++)
+        onPath[i] = 0;
+      for (i=0;i<n;i++)  {
+        seq[0] = vt[i];
+        AddPaths ( vt,nb,bt,first,seq,onPath,i,0 );
+      }
+
+      hash1 = CalcHash ( vt,nb,bt,first,0x243F6A88 );
+      hash2 = CalcHash ( vt,nb,bt,first,0x85A308D3 );
+
+      FreeVectorMemory ( onPath,0 );
+      FreeVectorMemory ( seq   ,0 );
+      FreeVectorMemory ( bt    ,0 );
+      FreeVectorMemory ( nb    ,0 );
+      FreeVectorMemory ( first ,0 );
+      FreeVectorMemory ( vt    ,0 );
+
+    }
+
+    void  GraphFingerprint::MakeHistograms ( PGraph G )  {
+    ivector v;
+    int     i,j,k,n;
+
+      n = G->nVertices;
+      GetVectorMemory ( v,IMax(n,nEdges)+1,0 );
+
+      for (i=0;i<n;i++)
+        v[i] = G->vertex[i]->GetType() & (~ATOM_LEAVING);
+      SortArray ( v,n );
+      nVTypes = 0;
+      for (i=0;i<n;i++)
+        if ((i==0) || (v[i]!=v[i-1]))  nVTypes++;
+      GetVectorMemory ( vType ,nVTypes,0 );
+      GetVectorMemory ( vCount,nVTypes,0 );
+      k = -1;
+      for (i=0;i<n;i++)
+        if ((i==0) || (v[i]!=v[i-1]))  {
+          k++;
+          vType [k] = v[i];
+          vCount[k] = 1;
+        } else
+          vCount[k]++;
+
+      k = 0;
+      for (i=1;i<=n;i++)
+        for (j=i+1;j<=n;j++)
+          if (G->graph[i][j])
+            v[k++] = G->graph[i][j];
+      SortArray ( v,k );
+      nETypes = 0;
+      for (i=0;i<k;i++)
+        if ((i==0) || (v[i]!=v[i-1]))  nETypes++;
+      if (nETypes>0)  {
+        GetVectorMemory ( eType ,nETypes,0 );
+        GetVectorMemory ( eCount,nETypes,0 );
+      }
+      j = -1;
+      for (i=0;i<k;i++)
+        if ((i==0) || (v[i]!=v[i-1]))  {
+          j++;
+          eType [j] = v[i];
+          eCount[j] = 1;
+        } else
+          eCount[j]++;
+
+      FreeVectorMemory ( v,0 );
+
+    }
+
+    void  GraphFingerprint::AddPaths ( ivector vt, ivector nb,
+                                       ivector bt, ivector first,
+                                       ivector seq, bvector onPath,
+                                       int v, int len )  {
+    //   Sets bits for all simple paths of len+1..GFP_PathLen edges,
+    // which start with path seq[0..2*len] (vertex and edge types
+    // alternate) ending in vertex v. Each path is hashed in the
+    // direction giving the smaller code, so that both directions
+    // set the same bit.
+    word hf,hb;
+    int  i,k,u,L;
+
+      if (len>0)  {
+        L  = 2*len;
+        hf = 0;
+        hb = 0;
+        for (k=0;k<=L;k++)  {
+          hf = HashCombine ( hf,word(seq[k])   );
+          hb = HashCombine ( hb,word(seq[L-k]) );
+        }
+        if (hb<hf)  hf = hb;
+        k = int(hf & (GFP_PathBits-1));
+        pathBits[k >> 5] |= word(1) << (k & 31);
+      }
+
+      if (len<GFP_PathLen)  {
+        onPath[v] = 1;
+        for (i=first[v];i<first[v+1];i++)  {
+          u = nb[i];
+          if (!onPath[u])  {
+            seq[2*len+1] = bt[i];
+            seq[2*len+2] = vt[u];
+            AddPaths ( vt,nb,bt,first,seq,onPath,u,len+1 );
+          }
+        }
+        onPath[v] = 0;
+      }
+
+    }
+
+    word  GraphFingerprint::CalcHash ( ivector vt, ivector nb,
+                                       ivector bt, ivector first,
+                                       word seed )  {
+    //   Vertex labels are refined by hashing them together with the
+    // sorted labels of their neighbours, until the number of
+    // different labels stops growing; the hash code is then made
+    // of the sorted final labels.
+    wvector L,L1,buf,srt,t;
+    word    h;
+    int     i,k,m,n,nc,nc1,iter,maxDeg;
+
+      n = nVertices;
+      maxDeg = 0;
+      for (i=0;i<n;i++)
+        maxDeg = IMax ( maxDeg,first[i+1]-first[i] );
+
+      GetVectorMemory ( L  ,n       ,0 );
+      GetVectorMemory ( L1 ,n       ,0 );
+      GetVectorMemory ( srt,n       ,0 );
+      GetVectorMemory ( buf,maxDeg+1,0 );
+
+      for (i=0;i<n;i++)
+        L[i] = HashCombine ( seed,word(vt[i]) );
+      nc = CountDistinct ( L,srt,n );
+
+      for (iter=0;iter<n;iter++)  {
+        for (i=0;i<n;i++)  {
+          m = 0;
+          for (k=first[i];k<first[i+1];k++)
+            buf[m++] = HashCombine ( word(bt[k]),L[nb[k]] );
+          SortArray ( buf,m );
+          h = HashCombine ( seed,L[i] );
+          for (k=0;k<m;k++)
+            h = HashCombine ( h,buf[k] );
+          L1[i] = h;
+        }
+        t  = L;
+        L  = L1;
+        L1 = t;
+        nc1 = CountDistinct ( L,srt,n );
+        if (nc1<=nc)  break;
+        nc = nc1;
+      }
+
+      for (i=0;i<n;i++)
+        srt[i] = L[i];
+      SortArray ( srt,n );
+      h = HashCombine ( seed,word(n) );
+      h = HashCombine ( h,word(nEdges) );
+      for (i=0;i<n;i++)
+        h = HashCombine ( h,srt[i] );
+
+      FreeVectorMemory ( buf,0 );
+      FreeVectorMemory ( srt,0 );
+      FreeVectorMemory ( L1 ,0 );
+      FreeVectorMemory ( L  ,0 );
+
+      return h;
+
+    }
+
+    bool  GraphFingerprint::CanMatch ( PGraphFingerprint FP )  {
+    int i,j;
+
+      if ((nVertices>FP->nVertices) || (nEdges>FP->nEdges))
+        return false;
+
+      for (i=0;i<GFP_PathWords;i++)
+        if (pathBits[i] & (~FP->pathBits[i]))
+          return false;
+
+      for (i=3;i<=GFP_MaxRing;i++)
+        if (nRings[i]>FP->nRings[i])
+          return false;
+
+      j = 0;
+      for (i=0;i<nVTypes;i++)  {
+        while ((j<FP->nVTypes) && (FP->vType[j]<vType[i]))  j++;
+        if ((j>=FP->nVTypes) || (FP->vType[j]!=vType[i]) ||
+            (FP->vCount[j]<vCount[i]))
+          return false;
+      }
+
+      j = 0;
+      for (i=0;i<nETypes;i++)  {
+        while ((j<FP->nETypes) && (FP->eType[j]<eType[i]))  j++;
+        if ((j>=FP->nETypes) || (FP->eType[j]!=eType[i]) ||
+            (FP->eCount[j]<eCount[i]))
+          return false;
+      }
+
+      return true;
+
+    }
+
+    bool  GraphFingerprint::isSameHash ( PGraphFingerprint FP )  {
+      return (hash1==FP->hash1) && (hash2==FP->hash2) &&
+             (nVertices==FP->nVertices) && (nEdges==FP->nEdges);
+    }
+
+    void  GraphFingerprint::Copy ( PGraphFingerprint FP )  {
+    int i;
+
+      FreeMemory();
+
+      nVertices = FP->nVertices;
+      nEdges    = FP->nEdges;
+      nVTypes   = FP->nVTypes;
+      nETypes   = FP->nETypes;
+      if (nVTypes>0)  {
+        GetVectorMemory ( vType ,nVTypes,0 );
+        GetVectorMemory ( vCount,nVTypes,0 );
+        for (i=0;i<nVTypes;i++)  {
+          vType [i] = FP->vType [i];
+          vCount[i] = FP->vCount[i];
+        }
+      }
+      if (nETypes>0)  {
+        GetVectorMemory ( eType ,nETypes,0 );
+        GetVectorMemory ( eCount,nETypes,0 );
+        for (i=0;i<nETypes;i++)  {
+          eType [i] = FP->eType [i];
+          eCount[i] = FP->eCount[i];
+        }
+      }
+      for (i=0;i<=GFP_MaxRing;i++)
+        nRings[i] = FP->nRings[i];
+      for (i=0;i<GFP_PathWords;i++)
+        pathBits[i] = FP->pathBits[i];
+      hash1 = FP->hash1;
+      hash2 = FP->hash2;
+
+    }
+
+    void  GraphFingerprint::write ( io::RFile f )  {
+    int i;
+    int Version=1;
+      f.WriteInt ( &Version   );
+      f.WriteInt ( &nVertices );
+      f.WriteInt ( &nEdges    );
+      f.WriteInt ( &nVTypes   );
+      for (i=0;i<nVTypes;i++)  {
+        f.WriteInt ( &(vType [i]) );
+        f.WriteInt ( &(vCount[i]) );
+      }
+      f.WriteInt ( &nETypes   );
+      for (i=0;i<nETypes;i++)  {
+        f.WriteInt ( &(eType [i]) );
+        f.WriteInt ( &(eCount[i]) );
+      }
+      for (i=3;i<=GFP_MaxRing;i++)
+        f.WriteInt  ( &(nRings[i])   );
+      for (i=0;i<GFP_PathWords;i++)
+        f.WriteWord ( &(pathBits[i]) );
+      f.WriteWord ( &hash1 );
+      f.WriteWord ( &hash2 );
+    }
+
+    void  GraphFingerprint::read ( io::RFile f )  {
+    int i,Version;
+      FreeMemory();
+      f.ReadInt ( &Version   );
+      f.ReadInt ( &nVertices );
+      f.ReadInt ( &nEdges    );
+      f.ReadInt ( &nVTypes   );
+      if (nVTypes>0)  {
+        GetVectorMemory ( vType ,nVTypes,0 );
+        GetVectorMemory ( vCount,nVTypes,0 );
+        for (i=0;i<nVTypes;i++)  {
+          f.ReadInt ( &(vType [i]) );
+          f.ReadInt ( &(vCount[i]) );
+        }
+      }
+      f.ReadInt ( &nETypes   );
+      if (nETypes>0)  {
+        GetVectorMemory ( eType ,nETypes,0 );
+        GetVectorMemory ( eCount,nETypes,0 );
+        for (i=0;i<nETypes;i++)  {
+          f.ReadInt ( &(eType [i]) );
+          f.ReadInt ( &(eCount[i]) );
+        }
+      }
+      for (i=3;i<=GFP_MaxRing;i++)
+        f.ReadInt  ( &(nRings[i])   );
+      for (i=0;i<GFP_PathWords;i++)
+        f.ReadWord ( &(pathBits[i]) );
+      f.ReadWord ( &hash1 );
+      f.ReadWord ( &hash2 );
+    }
+
+    void  GraphFingerprint::mem_write ( pstr S, int & l )  {
+    int  i;
+    byte Version=1;
+      mmdb::mem_write_byte ( Version,S,l );
+      mmdb::mem_write ( nVertices,S,l );
+      mmdb::mem_write ( nEdges   ,S,l );
+      mmdb::mem_write ( nVTypes  ,S,l );
+      for (i=0;i<nVTypes;i++)  {
+        mmdb::mem_write ( vType [i],S,l );
+        mmdb::mem_write ( vCount[i],S,l );
+      }
+      mmdb::mem_write ( nETypes  ,S,l );
+      for (i=0;i<nETypes;i++)  {
+        mmdb::mem_write ( eType [i],S,l );
+        mmdb::mem_write ( eCount[i],S,l );
+      }
+      for (i=3;i<=GFP_MaxRing;i++)
+        mmdb::mem_write ( nRings[i]  ,S,l );
+      for (i=0;i<GFP_PathWords;i++)
+        mmdb::mem_write ( pathBits[i],S,l );
+      mmdb::mem_write ( hash1,S,l );
+      mmdb::mem_write ( hash2,S,l );
+    }
+
+    void  GraphFingerprint::mem_read ( cpstr S, int & l )  {
+    int  i;
+    byte Version;
+      FreeMemory();
+      mmdb::mem_read_byte ( Version,S,l );
+      mmdb::mem_read ( nVertices,S,l );
+      mmdb::mem_read ( nEdges   ,S,l );
+      mmdb::mem_read ( nVTypes  ,S,l );
+      if (nVTypes>0)  {
+        GetVectorMemory ( vType ,nVTypes,0 );
+        GetVectorMemory ( vCount,nVTypes,0 );
+        for (i=0;i<nVTypes;i++)  {
+          mmdb::mem_read ( vType [i],S,l );
+          mmdb::mem_read ( vCount[i],S,l );
+        }
+      }
+      mmdb::mem_read ( nETypes  ,S,l );
+      if (nETypes>0)  {
+        GetVectorMemory ( eType ,nETypes,0 );
+        GetVectorMemory ( eCount,nETypes,0 );
+        for (i=0;i<nETypes;i++)  {
+          mmdb::mem_read ( eType [i],S,l );
+          mmdb::mem_read ( eCount[i],S,l );
+        }
+      }
+      for (i=3;i<=GFP_MaxRing;i++)
+        mmdb::mem_read ( nRings[i]  ,S,l );
+      for (i=0;i<GFP_PathWords;i++)
+        mmdb::mem_read ( pathBits[i],S,l );
+      mmdb::mem_read ( hash1,S,l );
+      mmdb::mem_read ( hash2,S,l );
+    }
+
+    MakeStreamFunctions(GraphFingerprint)
+
+
     //  ==========================  GMatch  ============================
 
     GMatch::GMatch() : io::Stream()  {
@@ -1771,26 +2464,23 @@ namespace mmdb  {
       n1 = Initialize ( vertexType,vertexExt );
       if (n1<=0)  return;
 
-      GetRecHeap();
-
       maxMatch  = IMax(1,IMin(n,minMatch));
       Stop      = false;
       startTime = time(NULL);
 
-      //    Use of Backtrack(..) and Ullman() is completely
-      //  equivalent. One of them should be commented.
+      //    Use of Backtrack(..), Ullman() and BitUllman() is
+      //  completely equivalent: they find the same matches in the
+      //  same order. BitUllman() is the fastest and does not need
+      //  the recursion heap.
 
       if (minMatch<n)  {
 
+        GetRecHeap();
         if (n1>=minMatch)  Backtrack1 ( 1,n1 );
 
       } else if (n1>=n)  {
 
-       #ifdef _UseRecursion
-        Backtrack ( 1 );
-       #else
-        Ullman();
-       #endif
+        BitUllman();
 
       }
 
@@ -2054,6 +2744,153 @@ namespace mmdb  {
 
     #endif
 
+    //  Bit index of the lowest set bit of 32-bit word x&(-x)
+    static const int BitIndex32[32] = {
+       0, 1,28, 2,29,14,24, 3,30,22,20,15,25,17, 4, 8,
+      31,27,13,23,21,19,16, 7,26,12,18, 6,11, 5,10, 9
+    };
+
+    #define  LowBitIndex(x)  BitIndex32[(((x) & (~(x)+1))*0x077CB531U) >> 27]
+
+    void  GraphMatch::BitUllman()  {
+    //   Iterative version of Ullman's algorithm for exact matching,
+    // equivalent to Backtrack(1). Domains of G1 vertices (sets of G2
+    // vertices they may be mapped on) are kept as bitsets of nw
+    // 32-bit words, and forward checking intersects them with sets
+    // of G2 vertices, which have bonds of the required type with the
+    // just mapped vertex, a whole word at a time. Domains of level i
+    // are in D[((i-1)*n+k-1)*nw], k=i..n, and the search position on
+    // level i is in cur[i].
+    wvector  D,A2,d1,d2,a;
+    ivector  cval,cv,cur;
+    imatrix  K1;
+    word     x;
+    int      nw,nc,ncAlloc,i,i1,j,k,l,t,w,b;
+    bool     ok;
+
+      if (Stop)  return;
+
+      nw = (m+31)/32;
+
+      //  1. Find bond types of G2 and sets of G2 vertices with bonds
+      //     of each type to each G2 vertex: A2[((j-1)*nc+t)*nw]
+      ncAlloc = 8;
+      GetVectorMemory ( cval,ncAlloc,0 );
+      nc = 0;
+      cval[nc++] = 0;
+      for (j=1;j<=m;j++)
+        for (l=1;l<=m;l++)  {
+          for (t=0;(t<nc) && (cval[t]!=c2[j][l]);t++);
+          if (t>=nc)  {
+            if (nc>=ncAlloc)  {
+              GetVectorMemory ( cv,2*ncAlloc,0 );
+              for (t=0;t<nc;t++)
+                cv[t] = cval[t];
+              FreeVectorMemory ( cval,0 );
+              cval     = cv;
+              ncAlloc *= 2;
+            }
+            cval[nc++] = c2[j][l];
+          }
+        }
+
+      GetVectorMemory ( A2,m*nc*nw,0 );
+      for (k=0;k<m*nc*nw;k++)
+        A2[k] = 0;
+      for (j=1;j<=m;j++)
+        for (l=1;l<=m;l++)
+          if (l!=j)  {
+            for (t=0;cval[t]!=c2[j][l];t++);
+            A2[((j-1)*nc+t)*nw + ((l-1) >> 5)] |= word(1) << ((l-1) & 31);
+          }
+
+      //  2. Bond types of G1 as indices of the G2 types, -1 for
+      //     types not found in G2
+      GetMatrixMemory ( K1,n,n,1,1 );
+      for (i=1;i<=n;i++)
+        for (k=1;k<=n;k++)  {
+          for (t=0;(t<nc) && (cval[t]!=c1[i][k]);t++);
+          if (t<nc)  K1[i][k] = t;
+               else  K1[i][k] = -1;
+        }
+
+      //  3. Initial domains from P[1]
+      GetVectorMemory ( D,n*n*nw,0 );
+      GetVectorMemory ( cur,n,1 );
+      for (k=0;k<n*nw;k++)
+        D[k] = 0;
+      for (k=1;k<=n;k++)  {
+        d1 = &(D[(k-1)*nw]);
+        for (l=1;l<=P[1][k][0];l++)  {
+          j = P[1][k][l]-1;
+          d1[j >> 5] |= word(1) << (j & 31);
+        }
+      }
+
+      //  4. Search
+      i      = 1;
+      cur[1] = 0;
+      while ((i>=1) && (!Stop))  {
+
+        //  next candidate j for ith vertex of G1
+        d1 = &(D[((i-1)*n+i-1)*nw]);
+        j  = -1;
+        w  = cur[i] >> 5;
+        if (w<nw)  {
+          x = d1[w] & (~word(0) << (cur[i] & 31));
+          while ((!x) && (++w<nw))
+            x = d1[w];
+          if (x)  j = (w << 5) + LowBitIndex(x);
+        }
+        if (j<0)  {
+          i--;  // domain exhausted, step back
+          continue;
+        }
+        cur[i] = j+1;
+        F1[i]  = i;
+        F2[i]  = j+1;
+
+        if (i>=n)  {
+          CollectMatch ( n );
+          continue;
+        }
+
+        // Forward checking
+        i1 = i+1;
+        ok = true;
+        for (k=i1;(k<=n) && ok;k++)  {
+          d1 = &(D[((i-1)*n+k-1)*nw]);
+          d2 = &(D[(i*n+k-1)*nw]);
+          t  = K1[i][k];
+          x  = 0;
+          if (t>=0)  {
+            a = &(A2[(j*nc+t)*nw]);
+            for (b=0;b<nw;b++)  {
+              d2[b] = d1[b] & a[b];
+              x    |= d2[b];
+            }
+          }
+          ok = (x!=0);
+        }
+
+        if (ok)  {
+          i      = i1;
+          cur[i] = 0;
+          if (timeLimit>0)
+            Stop = (difftime(time(NULL),startTime)>timeLimit);
+        }
+
+      }
+
+      FreeVectorMemory ( cur ,1 );
+      FreeVectorMemory ( D   ,0 );
+      FreeMatrixMemory ( K1  ,n,1,1 );
+      FreeVectorMemory ( A2  ,0 );
+      FreeVectorMemory ( cval,0 );
+
+    }
+
+
     void  GraphMatch::Backtrack1 ( int i, int k0 )  {
     //   Recursive version of CSIA algorithm for partial
     // (substructure-to-substructure) GMatching
@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -32,7 +32,9 @@
 //       ~~~~~~~~~~
 //  **** Classes :  Vertex     ( graph vertex                        )
 //       ~~~~~~~~~  Edge       ( graph edge                          )
+//                  GraphTemplates ( cache of residue bond patterns  )
 //                  Graph      ( structural graph                    )
+//                  GraphFingerprint ( graph screening and hashing   )
 //                  Match      ( match of structural graphs          )
 //                  GraphMatch ( CSIA algorithms for graphs matching )
 //
@@ -202,6 +204,69 @@ namespace mmdb  {
     DefineStreamFunctions(Edge);
 
 
+    //  =====================  GraphTemplates  ======================
+
+    //   GraphTemplates keeps bond patterns of residues, hashed by the
+    // residue name and the list of atom names, so that
+    // Graph::MakeGraph(..) can make graphs of recurring residues by
+    // checking only the lengths of the known bonds instead of
+    // checking all atom pairs. A template is learnt from the first
+    // residue of its kind given to MakeGraph(..) in which all atoms
+    // are bonded; residues with the same atoms listed in a different
+    // order make different templates. Residues where a template bond
+    // is too long are built in full.
+    //   The template topology is trusted otherwise: atoms that are
+    // not bonded in the template are not checked, so that clashing
+    // non-bonded atoms within a residue, which would be bonded in a
+    // full build, are not detected on the template path. Graphs of
+    // such residues then differ from those made without templates.
+    //   Learning templates modifies the object. After Freeze(),
+    // MakeGraph(..) only reads the templates, and a frozen object
+    // may be shared by concurrent MakeGraph(..) calls.
+
+    DefineStructure(GraphTemplate);
+
+    struct GraphTemplate  {
+      ResName    resName;  // residue name
+      AtomName * aname;    // [0..nAtoms-1] atom names
+      int        nAtoms;   // number of atoms
+      ivector    b1,b2;    // [0..nBonds-1] bonded atoms, b1<b2
+      int        nBonds;   // number of bonds
+      word       key;      // hash key of residue and atom names
+    };
+
+    DefineClass(GraphTemplates);
+
+    class GraphTemplates  {
+
+      friend class Graph;
+
+      public :
+
+        GraphTemplates ();
+        ~GraphTemplates();
+
+        void  FreeMemory();
+
+        void  Freeze   ( bool on=true )  { frozen = on;   }
+        bool  isFrozen ()  { return frozen;     }
+        int   GetNofTemplates()  { return nTemplates; }
+
+      protected :
+        PPGraphTemplate tmpl;
+        int             nTemplates,nTAlloc;
+        ivector         hash;     // template numbers+1 by key, 0 if empty
+        int             hashSize; // length of hash, a power of 2
+        bool            frozen;
+
+        PGraphTemplate FindTemplate ( PResidue R, PPVertex V, int nV );
+        void  HashTemplate ( int tNo );
+        void  AddTemplate ( PResidue R, PPVertex V, int nV,
+                            PPEdge E, int nE );
+
+    };
+
+
     //  ==========================  Graph  ============================
 
     enum GRAPH_RC  {
@@ -216,6 +281,7 @@ namespace mmdb  {
     class Graph : public io::Stream  {
 
       friend class GraphMatch;
+      friend class GraphFingerprint;
       friend class CSBase0;
 
       public :
@@ -256,6 +322,11 @@ namespace mmdb  {
         // is specified.
         //   After making the graph, Build(..) should be called as usual
         // before graph matching.
+        //   If templates T are given, bonds of residues found in T are
+        // taken from the templates after checking their lengths (see
+        // GraphTemplates for what is not checked), and
+        // templates of new residues are added to T unless T is frozen
+        // (see GraphTemplates).
         //   Non-negative return means that graph has been made.
         // MakeGraph(..) may return:
         //   MKGRAPH_Ok             everything is Ok
@@ -268,7 +339,8 @@ namespace mmdb  {
         //                          been chosen because of default
         //                          ""-altcode supplied or incorrect
         //                          altcode information in the residue
-        int   MakeGraph   ( PResidue R, cpstr altLoc=NULL );
+        int   MakeGraph   ( PResidue R, cpstr altLoc=NULL,
+                            PGraphTemplates T=NULL );
 
         int   MakeGraph   ( PPAtom atom, int nAtoms );
 
@@ -276,7 +348,12 @@ namespace mmdb  {
         void  ExcludeType ( int type );
 
         void  MakeSymmetryRelief ( bool noCO2 );
-        void  IdentifyRings      ();
+
+        //   IdentifyRings() marks vertices in 3- to 10-membered rings
+        // by bits in Vertex::type_ext. If nRings is given, nRings[k]
+        // returns the number of k-membered rings, k=3..10 (nRings
+        // should have at least 11 elements, starting from 0).
+        void  IdentifyRings      ( ivector nRings=NULL );
         int   IdentifyConnectedComponents();  // returns their number >= 1
 
         int   Build       ( bool bondOrder );  // returns 0 if Ok
@@ -321,6 +398,8 @@ namespace mmdb  {
 
         void  markConnected ( int vno, int cno );
 
+        bool  MakeTemplateEdges ( PResidue R, PGraphTemplate T );
+
       private :
         int  nVAlloc,nEAlloc,nGAlloc;
 
@@ -329,6 +408,102 @@ namespace mmdb  {
     DefineStreamFunctions(Graph);
 
 
+    //  ====================  GraphFingerprint  =====================
+
+    enum GRAPH_FINGERPRINT  {
+      GFP_MaxRing   = 10,   // rings of 3..GFP_MaxRing vertices
+      GFP_PathLen   = 4,    // max number of edges in hashed paths
+      GFP_PathBits  = 1024, // length of path bitset, power of 2
+      GFP_PathWords = 32    // GFP_PathBits/32
+    };
+
+    DefineClass(GraphFingerprint);
+    DefineStreamFunctions(GraphFingerprint);
+
+    //   GraphFingerprint keeps a summary of a graph: the number of
+    // vertices and edges, histograms of vertex and edge types, the
+    // numbers of rings found by Graph::IdentifyRings(..), a bitset
+    // of hashed typed paths, and a hash code invariant with respect
+    // to vertex numbering. Fingerprints are made once per graph and
+    // may be stored in files or memory buffers together with the
+    // graphs.
+    //
+    //   CanMatch(..) is a fast necessary condition for a complete
+    // match, found by GraphMatch::MatchGraphs(G1,G2,n1,true,..),
+    // of graph G1 (this fingerprint, n1 vertices) into graph G2
+    // (fingerprint FP): if it returns false, there is no such match
+    // and the search may be skipped. Vertex types are compared as in
+    // GraphMatch, so fingerprints should not be used for matching
+    // with vertexType=false.
+    //
+    //   isSameHash(..) returns true if the hash codes of the two
+    // fingerprints are equal. Isomorphic graphs always have equal
+    // hash codes; graphs with equal codes are identical with a very
+    // high probability, but a collision is possible (e.g. for some
+    // highly symmetric graphs), so that identity may need to be
+    // confirmed by graph matching.
+    //
+    //   Graphs must be built by Graph::Build(..) before making their
+    // fingerprints, with the same bondOrder as for matching: edge
+    // types are taken from the connectivity matrix. If G was not
+    // built, MakeFingerprint(..) calls G->Build(true); otherwise G
+    // is not changed.
+
+    class GraphFingerprint : public io::Stream  {
+
+      public :
+
+        GraphFingerprint ();
+        GraphFingerprint ( PGraph G );
+        GraphFingerprint ( io::RPStream Object );
+        ~GraphFingerprint();
+
+        void  MakeFingerprint ( PGraph G );
+
+        bool  CanMatch   ( PGraphFingerprint FP );
+        bool  isSameHash ( PGraphFingerprint FP );
+
+        inline int  GetNofVertices() { return nVertices; }
+        inline int  GetNofEdges   () { return nEdges;    }
+        inline word GetHash1      () { return hash1;     }
+        inline word GetHash2      () { return hash2;     }
+        inline int  GetNofRings   ( int ringSize )
+          { return ((ringSize>=3) && (ringSize<=GFP_MaxRing)) ?
+                     nRings[ringSize] : 0; }
+
+        void  Copy  ( PGraphFingerprint FP );
+
+        void  read  ( io::RFile f );
+        void  write ( io::RFile f );
+
+        void  mem_read  ( cpstr S, int & l );
+        void  mem_write ( pstr  S, int & l );
+
+      protected :
+        int     nVertices,nEdges;
+        int     nVTypes;   // number of different vertex types
+        ivector vType;     // [0..nVTypes-1] vertex types, ascending
+        ivector vCount;    // [0..nVTypes-1] number of vertices
+        int     nETypes;   // number of different edge types
+        ivector eType;     // [0..nETypes-1] edge types, ascending
+        ivector eCount;    // [0..nETypes-1] number of edges
+        int     nRings  [GFP_MaxRing+1]; // [3..GFP_MaxRing]
+        word    pathBits[GFP_PathWords];
+        word    hash1,hash2;
+
+        void  InitFingerprint();
+        void  FreeMemory     ();
+
+        void  MakeHistograms ( PGraph G );
+        void  AddPaths       ( ivector vt, ivector nb, ivector bt,
+                               ivector first, ivector seq,
+                               bvector onPath, int v, int len );
+        word  CalcHash       ( ivector vt, ivector nb, ivector bt,
+                               ivector first, word seed );
+
+    };
+
+
     //  =========================  GMatch  ==========================
 
     DefineClass(GMatch);
@@ -470,6 +645,7 @@ namespace mmdb  {
     #else
         void  Ullman        ();
     #endif
+        void  BitUllman     ();                 // exact matching
         void  Backtrack1    ( int i, int k0 );  // exact/partial matching
         void  CollectMatch  ( int nm );
 
@@ -22,14 +22,14 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
 //  **** Module  :  Rand  <implementation>
 //       ~~~~~~~~~
 //  **** Classes :  RandomNumber ( random number generator )
-//       ~~~~~~~~~
+//       ~~~~~~~~~  RandomStream ( counter-based random numbers )
 //
 //   (C) E. Krissinel  1997-2013
 //
@@ -178,6 +178,199 @@ namespace mmdb  {
     }
 
 
+    //  ===================  RandomStream  ==========================
+
+    //  Philox4x32 multipliers and Weyl constants for key schedule
+    #define  PHILOX_M0  0xD2511F53U
+    #define  PHILOX_M1  0xCD9E8D57U
+    #define  PHILOX_W0  0x9E3779B9U
+    #define  PHILOX_W1  0xBB67AE85U
+
+    //  1/2^26 and 1/2^53 for making 53-bit real numbers of 2 words
+    #define  RS_2p26    67108864.0
+    #define  RS_2m53    (1.0/9007199254740992.0)
+
+    inline void MulHiLo ( word a, word b, word & hi, word & lo )  {
+    //  hi:lo = a*b in 16-bit pieces, which does not need 64-bit
+    //  integers
+    word al,ah,bl,bh,m1,m2,t;
+      al = a & 0xFFFF;   ah = a >> 16;
+      bl = b & 0xFFFF;   bh = b >> 16;
+      m1 = ah*bl;
+      m2 = al*bh;
+      t  = ((al*bl) >> 16) + (m1 & 0xFFFF) + (m2 & 0xFFFF);
+      hi = ah*bh + (m1 >> 16) + (m2 >> 16) + (t >> 16);
+      lo = a*b;
+    }
+
+    inline void Philox ( word * c, word * k, word * r )  {
+    //  r = Philox4x32-10 (c,k). Known-answer vectors of Random123,
+    //  as r[0] r[1] r[2] r[3], which random32() returns in this order:
+    //    c=0,0,0,0  k=0,0  ->  6627e8d5 e169c58d bc57ac4c 9b00dbd8
+    //    c=ffffffff (all)  k=ffffffff,ffffffff
+    //                      ->  408f276d 41c83b0e a20bc7c6 6d5451fd
+    //    c=243f6a88 85a308d3 13198a2e 03707344  k=a4093822 299f31d0
+    //                      ->  d16cfe09 94fdcceb 5001e420 24126ea1
+    word x0,x1,x2,x3, k0,k1, h0,l0,h1,l1;
+    int  i;
+      x0 = c[0];  x1 = c[1];  x2 = c[2];  x3 = c[3];
+      k0 = k[0];  k1 = k[1];
+      for (i=0;i<10;i++)  {
+        MulHiLo ( PHILOX_M0,x0,h0,l0 );
+        MulHiLo ( PHILOX_M1,x2,h1,l1 );
+        x0 = h1 ^ x1 ^ k0;
+        x1 = l1;
+        x2 = h0 ^ x3 ^ k1;
+        x3 = l0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+      }
+      r[0] = x0;  r[1] = x1;  r[2] = x2;  r[3] = x3;
+    }
+
+    inline void NextCounter ( word * c )  {
+      c[0]++;
+      if (!c[0])  {
+        c[1]++;
+        if (!c[1])  {
+          c[2]++;
+          if (!c[2])  c[3]++;
+        }
+      }
+    }
+
+    RandomStream::RandomStream ( word Seed, word Stream )  {
+      Init ( Seed,Stream );
+    }
+
+    void  RandomStream::Init ( word Seed, word Stream )  {
+      key[0] = Seed;
+      key[1] = Stream;
+      Seek ( 0,0 );
+    }
+
+    void  RandomStream::Seek ( word BlockLo, word BlockHi )  {
+      ctr[0] = BlockLo;
+      ctr[1] = BlockHi;
+      ctr[2] = 0;
+      ctr[3] = 0;
+      blk[0] = 0;
+      blk[1] = 0;
+      blk[2] = 0;
+      blk[3] = 0;
+      nblk   = 4;
+      gset   = 0.0;
+      iset   = 0;
+    }
+
+    void  RandomStream::NextBlock()  {
+      Philox      ( ctr,key,blk );
+      NextCounter ( ctr );
+      nblk = 0;
+    }
+
+    word  RandomStream::random32()  {
+      if (nblk>=4)  NextBlock();
+      return blk[nblk++];
+    }
+
+    // uniform [0..1) random number generator
+    realtype RandomStream::random()  {
+    word a,b;
+      a = random32() >> 5;
+      b = random32() >> 6;
+      return (a*RS_2p26 + b)*RS_2m53;
+    }
+
+    // uniform [-1..1) random number generator
+    realtype RandomStream::srandom()  {
+      return 2.0*random() - 1.0;
+    }
+
+    // gaussian random numbers
+    realtype RandomStream::gauss_rnd()  {
+    realtype r,phi;
+      if (iset==0)  {
+        r    = sqrt ( -2.0*log(1.0-random()) );
+        phi  = 2.0*Pi*random();
+        gset = r*sin(phi);
+        iset = 1;
+        return r*cos(phi);
+      } else  {
+        iset = 0;
+        return gset;
+      }
+    }
+
+    void  RandomStream::Fill ( rvector v, int n )  {
+    int i;
+
+      //  Finish the current block, then take whole blocks directly
+      //  while the stream is at block boundary
+      i = 0;
+      while ((i<n) && (nblk<4))
+        v[i++] = random();
+
+      if (nblk==4)
+        while (i<n-1)  {
+          Philox      ( ctr,key,blk );
+          NextCounter ( ctr );
+          v[i++] = ((blk[0] >> 5)*RS_2p26 + (blk[1] >> 6))*RS_2m53;
+          v[i++] = ((blk[2] >> 5)*RS_2p26 + (blk[3] >> 6))*RS_2m53;
+        }
+
+      while (i<n)
+        v[i++] = random();
+
+    }
+
+    void  RandomStream::FillGauss ( rvector v, int n )  {
+    realtype r,phi;
+    int      i;
+
+      i = 0;
+      while ((i<n) && ((nblk<4) || iset))
+        v[i++] = gauss_rnd();
+
+      if ((nblk==4) && (!iset))
+        while (i<n-1)  {
+          Philox      ( ctr,key,blk );
+          NextCounter ( ctr );
+          r   = sqrt ( -2.0*log(1.0 -
+                   ((blk[0] >> 5)*RS_2p26 + (blk[1] >> 6))*RS_2m53) );
+          phi = 2.0*Pi*((blk[2] >> 5)*RS_2p26 + (blk[3] >> 6))*RS_2m53;
+          v[i++] = r*cos(phi);
+          v[i++] = r*sin(phi);
+        }
+
+      while (i<n)
+        v[i++] = gauss_rnd();
+
+    }
+
+    void  RandomStream::write ( io::RFile f )  {
+    int Version=1;
+      f.WriteFile ( &Version,sizeof(Version) );
+      f.WriteFile ( key     ,sizeof(key)     );
+      f.WriteFile ( ctr     ,sizeof(ctr)     );
+      f.WriteFile ( blk     ,sizeof(blk)     );
+      f.WriteFile ( &nblk   ,sizeof(nblk)    );
+      f.WriteFile ( &gset   ,sizeof(gset)    );
+      f.WriteFile ( &iset   ,sizeof(iset)    );
+    }
+
+    void  RandomStream::read ( io::RFile f )  {
+    int Version;
+      f.ReadFile ( &Version,sizeof(Version) );
+      f.ReadFile ( key     ,sizeof(key)     );
+      f.ReadFile ( ctr     ,sizeof(ctr)     );
+      f.ReadFile ( blk     ,sizeof(blk)     );
+      f.ReadFile ( &nblk   ,sizeof(nblk)    );
+      f.ReadFile ( &gset   ,sizeof(gset)    );
+      f.ReadFile ( &iset   ,sizeof(iset)    );
+    }
+
+
   }  // namespace math
 
 }  // namespace mmdb
@@ -22,14 +22,14 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
 //  **** Module  :  Rand  <interface>
 //       ~~~~~~~~~
 //  **** Classes :  RandomNumber ( random number generator )
-//       ~~~~~~~~~
+//       ~~~~~~~~~  RandomStream ( counter-based random numbers )
 //
 //   (C) E. Krissinel  1997-2013
 //
@@ -73,6 +73,63 @@ namespace mmdb  {
 
     };
 
+
+    //  -------------------------------------------------------------
+
+    //   RandomStream is a counter-based generator Philox4x32-10
+    // (J.K.Salmon et al., Proc. SC'11, 16:1-16:12 (2011)). Its n-th
+    // block of 4 random 32-bit words is a fixed function of n and of
+    // the key made of Seed and Stream numbers, therefore
+    //
+    //  - streams with the same Seed and different Stream numbers are
+    //    statistically independent, so that each thread of a
+    //    parallel calculation may use its own object with its own
+    //    Stream number, and the results do not depend on how the work
+    //    is distributed between the threads if the Stream numbers are
+    //    bound to the work items rather than to threads;
+    //  - Seek(..) moves to any position in the stream at no cost.
+    //
+    // Uniform numbers have 53 random bits and are made of 2 words,
+    // Gaussian numbers are made in pairs by the Box-Muller method
+    // from 4 words. Fill(..) and FillGauss(..) give the same numbers
+    // as the same number of calls to random() and gauss_rnd(),
+    // respectively. An object should not be shared between threads
+    // without locking.
+
+    DefineClass(RandomStream);
+
+    class RandomStream  {
+      public :
+        RandomStream ( word Seed=0, word Stream=0 );
+        void  Init   ( word Seed=0, word Stream=0 );
+        //! Moves to block BlockLo+2^32*BlockHi (4 words per block)
+        void  Seek   ( word BlockLo, word BlockHi=0 );
+
+        word     random32 (); //!< Uniform 32-bit random word
+        realtype random   (); //!< Uniform [0..1) random number
+        realtype srandom  (); //!< Uniform [-1..1) random number
+        realtype gauss_rnd(); //!< Gaussian random numbers
+
+        //! Fills v[0..n-1] with uniform [0..1) random numbers
+        void  Fill      ( rvector v, int n );
+        //! Fills v[0..n-1] with Gaussian random numbers
+        void  FillGauss ( rvector v, int n );
+
+        void  read  ( io::RFile f );
+        void  write ( io::RFile f );
+
+      protected :
+        word     key[2];  // Seed and Stream
+        word     ctr[4];  // number of the next block
+        word     blk[4];  // current block
+        int      nblk;    // number of words used in current block
+        realtype gset;
+        int      iset;
+
+        void  NextBlock ();
+
+    };
+
   }  // namespace math
 
 }  // namespace mmdb
@@ -0,0 +1,525 @@
+//  $Id: mmdb_math_superpose.cpp $
+//  =================================================================
+//
+//   CCP4 Coordinate Library: support of coordinate-related
+//   functionality in protein crystallography applications.
+//
+//   Copyright (C) The MMDB contributors 2026.
+//
+//    This library is free software: you can redistribute it and/or
+//    modify it under the terms of the GNU Lesser General Public
+//    License version 3, modified in accordance with the provisions
+//    of the license to address the requirements of UK law.
+//
+//    You should have received a copy of the modified GNU Lesser
+//    General Public License along with this library. If not, copies
+//    may be downloaded from http://www.ccp4.ac.uk/ccp4license.php
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//  =================================================================
+//
+//    18.10.26   <--  Date of Last Modification.
+//                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  -----------------------------------------------------------------
+//
+//  **** Module  :  Superpose  <implementation>
+//       ~~~~~~~~~
+//  **** Project :  MMDB  ( MacroMolecular Data Base )
+//       ~~~~~~~~~
+//  **** Functions:  mmdb::math::QCPEigenvalue  ( max. eigenvalue    )
+//       ~~~~~~~~~~  mmdb::math::QCPRotation    ( optimal rotation   )
+//                   mmdb::math::SuperposeCoor  ( fit of point sets  )
+//                   mmdb::math::SuperposeRMSD  ( RMSD of best fit   )
+//                   mmdb::math::SuperposeBatch ( many fits          )
+//
+//  (C) The MMDB contributors 2026
+//
+//  =================================================================
+//
+//
+
+#include <math.h>
+
+#include "mmdb_math_superpose.h"
+#include "mmdb_math_linalg.h"
+
+namespace mmdb  {
+
+  namespace math  {
+
+    //  Relative precision of the largest eigenvalue, and the relative
+    //  threshold on squared norms of quaternion candidates, below which
+    //  the eigenvalue is considered as degenerate
+    #define  QCP_EvalPrec  1.0e-11
+    #define  QCP_EvecPrec  1.0e-12
+
+    //  =======================  QCP kernel  ===========================
+
+    //   QCPPolynomial(..) calculates coefficients of the characteristic
+    // polynomial  lambda^4 + C2*lambda^2 + C1*lambda + C0  of the key
+    // matrix. Here Sab = Sum_k w_k*a1_k*b2_k, that is, S = A^T.
+
+    static void QCPPolynomial ( mat33 & A, realtype & C0,
+                                realtype & C1, realtype & C2 )  {
+    realtype Sxx,Sxy,Sxz, Syx,Syy,Syz, Szx,Szy,Szz;
+    realtype Sxx2,Syy2,Szz2, Sxy2,Syz2,Sxz2, Syx2,Szy2,Szx2;
+    realtype SyzSzymSyySzz2,Sxx2Syy2Szz2Syz2Szy2,Sxy2Sxz2Syx2Szx2;
+    realtype SxzpSzx,SyzpSzy,SxypSyx, SyzmSzy,SxzmSzx,SxymSyx;
+    realtype SxxpSyy,SxxmSyy;
+
+      Sxx = A[0][0];  Sxy = A[1][0];  Sxz = A[2][0];
+      Syx = A[0][1];  Syy = A[1][1];  Syz = A[2][1];
+      Szx = A[0][2];  Szy = A[1][2];  Szz = A[2][2];
+
+      Sxx2 = Sxx*Sxx;  Syy2 = Syy*Syy;  Szz2 = Szz*Szz;
+      Sxy2 = Sxy*Sxy;  Syz2 = Syz*Syz;  Sxz2 = Sxz*Sxz;
+      Syx2 = Syx*Syx;  Szy2 = Szy*Szy;  Szx2 = Szx*Szx;
+
+      SyzSzymSyySzz2       = 2.0*(Syz*Szy - Syy*Szz);
+      Sxx2Syy2Szz2Syz2Szy2 = Syy2 + Szz2 - Sxx2 + Syz2 + Szy2;
+
+      C2 = -2.0*(Sxx2 + Syy2 + Szz2 + Sxy2 + Syx2 +
+                 Sxz2 + Szx2 + Syz2 + Szy2);
+      C1 =  8.0*(Sxx*Syz*Szy + Syy*Szx*Sxz + Szz*Sxy*Syx -
+                 Sxx*Syy*Szz - Syz*Szx*Sxy - Szy*Syx*Sxz);
+
+      SxzpSzx = Sxz + Szx;
+      SyzpSzy = Syz + Szy;
+      SxypSyx = Sxy + Syx;
+      SyzmSzy = Syz - Szy;
+      SxzmSzx = Sxz - Szx;
+      SxymSyx = Sxy - Syx;
+      SxxpSyy = Sxx + Syy;
+      SxxmSyy = Sxx - Syy;
+      Sxy2Sxz2Syx2Szx2 = Sxy2 + Sxz2 - Syx2 - Szx2;
+
+      C0 = Sxy2Sxz2Syx2Szx2*Sxy2Sxz2Syx2Szx2
+         + (Sxx2Syy2Szz2Syz2Szy2+SyzSzymSyySzz2) *
+           (Sxx2Syy2Szz2Syz2Szy2-SyzSzymSyySzz2)
+         + (-SxzpSzx*SyzmSzy + SxymSyx*(SxxmSyy-Szz)) *
+           (-SxzmSzx*SyzpSzy + SxymSyx*(SxxmSyy+Szz))
+         + (-SxzpSzx*SyzpSzy - SxypSyx*(SxxpSyy-Szz)) *
+           (-SxzmSzx*SyzmSzy - SxypSyx*(SxxpSyy+Szz))
+         + ( SxypSyx*SyzpSzy + SxzpSzx*(SxxmSyy+Szz)) *
+           (-SxymSyx*SyzmSzy + SxzpSzx*(SxxpSyy+Szz))
+         + ( SxypSyx*SyzmSzy + SxzmSzx*(SxxmSyy-Szz)) *
+           (-SxymSyx*SyzpSzy + SxzmSzx*(SxxpSyy-Szz));
+
+    }
+
+    realtype QCPEigenvalue ( mat33 & A, realtype E0 )  {
+    realtype C0,C1,C2, lambda,lambda0, x2,a,b, p,d;
+    int      i,j;
+
+      if (E0<=0.0)  {
+        //  Sum of singular values of A, which is the largest
+        //  eigenvalue for proper rotations, does not exceed
+        //  sqrt(3)*|A|
+        E0 = 0.0;
+        for (i=0;i<3;i++)
+          for (j=0;j<3;j++)
+            E0 += A[i][j]*A[i][j];
+        E0 = sqrt(3.0*E0);
+        if (E0<=0.0)  return 0.0;
+      }
+
+      QCPPolynomial ( A,C0,C1,C2 );
+
+      //  Newton iterations from above converge monotonically to the
+      //  largest root
+      lambda = E0;
+      for (i=0;i<50;i++)  {
+        lambda0 = lambda;
+        x2      = lambda*lambda;
+        b       = (x2 + C2)*lambda;
+        a       = b + C1;
+        d       = 2.0*x2*lambda + b + a;
+        p       = a*lambda + C0;
+        //  stop at a (near) multiple root, where the polynomial and
+        //  its derivative are at the level of round-off errors
+        if ((p<=0.0) || (d<=QCP_EvalPrec*x2*lambda))  break;
+        lambda -= p/d;
+        if (fabs(lambda-lambda0)<fabs(QCP_EvalPrec*lambda))  break;
+      }
+
+      return lambda;
+
+    }
+
+
+    static int SVDRotation ( mat33 & A, mat33 & R,
+                             realtype & lambda )  {
+    //   Degenerate cases are resolved by singular value decomposition,
+    // as in the original SuperposeAtoms(..), but with the inversion
+    // check made on the rotation rather than on A, which may be
+    // singular here. Lambda is recalculated as trace(R^T*A).
+    rmatrix  A1,U,V;
+    rvector  W,RV1;
+    realtype det,B;
+    int      i,j,k,rc;
+
+      GetMatrixMemory ( A1 ,3,3,1,1 );
+      GetMatrixMemory ( U  ,3,3,1,1 );
+      GetMatrixMemory ( V  ,3,3,1,1 );
+      GetVectorMemory ( W  ,3,1 );
+      GetVectorMemory ( RV1,3,1 );
+
+      for (i=1;i<=3;i++)
+        for (j=1;j<=3;j++)
+          A1[i][j] = A[i-1][j-1];
+
+      SVD ( 3,3,3,A1,U,V,W,RV1,true,true,rc );
+
+      if (rc==0)  {
+        det = (U[1][1]*U[2][2]*U[3][3] + U[1][2]*U[2][3]*U[3][1] +
+               U[2][1]*U[3][2]*U[1][3] - U[1][3]*U[2][2]*U[3][1] -
+               U[1][1]*U[2][3]*U[3][2] - U[3][3]*U[1][2]*U[2][1]) *
+              (V[1][1]*V[2][2]*V[3][3] + V[1][2]*V[2][3]*V[3][1] +
+               V[2][1]*V[3][2]*V[1][3] - V[1][3]*V[2][2]*V[3][1] -
+               V[1][1]*V[2][3]*V[3][2] - V[3][3]*V[1][2]*V[2][1]);
+        if (det<0.0)  {
+          k = 0;
+          B = MaxReal;
+          for (j=1;j<=3;j++)
+            if (W[j]<B)  {
+              B = W[j];
+              k = j;
+            }
+          for (j=1;j<=3;j++)
+            V[j][k] = -V[j][k];
+        }
+        for (j=1;j<=3;j++)
+          for (k=1;k<=3;k++)  {
+            B = 0.0;
+            for (i=1;i<=3;i++)
+              B += U[j][i]*V[k][i];
+            R[j-1][k-1] = B;
+          }
+        lambda = 0.0;
+        for (i=0;i<3;i++)
+          for (j=0;j<3;j++)
+            lambda += R[i][j]*A[i][j];
+      } else  {
+        for (i=0;i<3;i++)  {
+          for (j=0;j<3;j++)
+            R[i][j] = 0.0;
+          R[i][i] = 1.0;
+        }
+      }
+
+      FreeVectorMemory ( RV1,1 );
+      FreeVectorMemory ( W  ,1 );
+      FreeMatrixMemory ( V  ,3,1,1 );
+      FreeMatrixMemory ( U  ,3,1,1 );
+      FreeMatrixMemory ( A1 ,3,1,1 );
+
+      if (rc)  return QCP_SVD_Fail;
+      return QCP_Ok;
+
+    }
+
+    int QCPRotation ( mat33 & A, realtype E0, mat33 & R,
+                      realtype & lambda )  {
+    realtype Sxx,Sxy,Sxz, Syx,Syy,Syz, Szx,Szy,Szz;
+    realtype a11,a12,a13,a14, a21,a22,a23,a24;
+    realtype a31,a32,a33,a34, a41,a42,a43,a44;
+    realtype a3344_4334,a3244_4234,a3243_4233;
+    realtype a3143_4133,a3144_4134,a3142_4132;
+    realtype a1324_1423,a1224_1422,a1223_1322;
+    realtype a1124_1421,a1123_1321,a1122_1221;
+    realtype q1,q2,q3,q4, qsqr,qmin, l3;
+    realtype a2,x2,y2,z2, xy,az,zx,ay,yz,ax;
+    int      i,j;
+
+      lambda = QCPEigenvalue ( A,E0 );
+
+      if (lambda<=0.0)  {
+        for (i=0;i<3;i++)  {
+          for (j=0;j<3;j++)
+            R[i][j] = 0.0;
+          R[i][i] = 1.0;
+        }
+        return QCP_Ok;
+      }
+
+      Sxx = A[0][0];  Sxy = A[1][0];  Sxz = A[2][0];
+      Syx = A[0][1];  Syy = A[1][1];  Syz = A[2][1];
+      Szx = A[0][2];  Szy = A[1][2];  Szz = A[2][2];
+
+      //  The eigenvector is found as a non-zero column of the
+      //  adjugate of (K - lambda*I), K being the key matrix
+
+      a11 = Sxx + Syy + Szz - lambda;
+      a12 = Syz - Szy;
+      a13 = Szx - Sxz;
+      a14 = Sxy - Syx;
+      a21 = a12;
+      a22 = Sxx - Syy - Szz - lambda;
+      a23 = Sxy + Syx;
+      a24 = Sxz + Szx;
+      a31 = a13;
+      a32 = a23;
+      a33 = Syy - Sxx - Szz - lambda;
+      a34 = Syz + Szy;
+      a41 = a14;
+      a42 = a24;
+      a43 = a34;
+      a44 = Szz - Sxx - Syy - lambda;
+
+      a3344_4334 = a33*a44 - a43*a34;
+      a3244_4234 = a32*a44 - a42*a34;
+      a3243_4233 = a32*a43 - a42*a33;
+      a3143_4133 = a31*a43 - a41*a33;
+      a3144_4134 = a31*a44 - a41*a34;
+      a3142_4132 = a31*a42 - a41*a32;
+
+      l3   = lambda*lambda*lambda;
+      qmin = QCP_EvecPrec*l3*l3;
+
+      q1 =  a22*a3344_4334 - a23*a3244_4234 + a24*a3243_4233;
+      q2 = -a21*a3344_4334 + a23*a3144_4134 - a24*a3143_4133;
+      q3 =  a21*a3244_4234 - a22*a3144_4134 + a24*a3142_4132;
+      q4 = -a21*a3243_4233 + a22*a3143_4133 - a23*a3142_4132;
+      qsqr = q1*q1 + q2*q2 + q3*q3 + q4*q4;
+
+      if (qsqr<qmin)  {
+        q1 =  a12*a3344_4334 - a13*a3244_4234 + a14*a3243_4233;
+        q2 = -a11*a3344_4334 + a13*a3144_4134 - a14*a3143_4133;
+        q3 =  a11*a3244_4234 - a12*a3144_4134 + a14*a3142_4132;
+        q4 = -a11*a3243_4233 + a12*a3143_4133 - a13*a3142_4132;
+        qsqr = q1*q1 + q2*q2 + q3*q3 + q4*q4;
+        if (qsqr<qmin)  {
+          a1324_1423 = a13*a24 - a14*a23;
+          a1224_1422 = a12*a24 - a14*a22;
+          a1223_1322 = a12*a23 - a13*a22;
+          a1124_1421 = a11*a24 - a14*a21;
+          a1123_1321 = a11*a23 - a13*a21;
+          a1122_1221 = a11*a22 - a12*a21;
+          q1 =  a42*a1324_1423 - a43*a1224_1422 + a44*a1223_1322;
+          q2 = -a41*a1324_1423 + a43*a1124_1421 - a44*a1123_1321;
+          q3 =  a41*a1224_1422 - a42*a1124_1421 + a44*a1122_1221;
+          q4 = -a41*a1223_1322 + a42*a1123_1321 - a43*a1122_1221;
+          qsqr = q1*q1 + q2*q2 + q3*q3 + q4*q4;
+          if (qsqr<qmin)  {
+            q1 =  a32*a1324_1423 - a33*a1224_1422 + a34*a1223_1322;
+            q2 = -a31*a1324_1423 + a33*a1124_1421 - a34*a1123_1321;
+            q3 =  a31*a1224_1422 - a32*a1124_1421 + a34*a1122_1221;
+            q4 = -a31*a1223_1322 + a32*a1123_1321 - a33*a1122_1221;
+            qsqr = q1*q1 + q2*q2 + q3*q3 + q4*q4;
+            if (qsqr<qmin)
+              //  the largest eigenvalue is degenerate
+              return SVDRotation ( A,R,lambda );
+          }
+        }
+      }
+
+      qsqr = sqrt(qsqr);
+      q1 /= qsqr;
+      q2 /= qsqr;
+      q3 /= qsqr;
+      q4 /= qsqr;
+
+      a2 = q1*q1;
+      x2 = q2*q2;
+      y2 = q3*q3;
+      z2 = q4*q4;
+      xy = q2*q3;
+      az = q1*q4;
+      zx = q4*q2;
+      ay = q1*q3;
+      yz = q3*q4;
+      ax = q1*q2;
+
+      R[0][0] = a2 + x2 - y2 - z2;
+      R[0][1] = 2.0*(xy - az);
+      R[0][2] = 2.0*(zx + ay);
+      R[1][0] = 2.0*(xy + az);
+      R[1][1] = a2 - x2 + y2 - z2;
+      R[1][2] = 2.0*(yz - ax);
+      R[2][0] = 2.0*(zx - ay);
+      R[2][1] = 2.0*(yz + ax);
+      R[2][2] = a2 - x2 - y2 + z2;
+
+      return QCP_Ok;
+
+    }
+
+
+    //  ====================  Coordinate fitting  ======================
+
+    //   SuperposeCorrelation(..) calculates centers of the point sets,
+    // correlation matrix A of the centered points, value E0 and sum
+    // of weights W. Returns false if there are no points or their
+    // weights are not positive.
+
+    static bool SuperposeCorrelation (
+                           rvector x1, rvector y1, rvector z1,
+                           rvector x2, rvector y2, rvector z2,
+                           int n, rvector w, vect3 & c1, vect3 & c2,
+                           mat33 & A, realtype & E0, realtype & W )  {
+    realtype wk, dx1,dy1,dz1, dx2,dy2,dz2, G;
+    realtype a00,a01,a02, a10,a11,a12, a20,a21,a22;
+    int      k;
+
+      if (n<=0)  return false;
+
+      c1[0] = 0.0;  c1[1] = 0.0;  c1[2] = 0.0;
+      c2[0] = 0.0;  c2[1] = 0.0;  c2[2] = 0.0;
+      if (w)  {
+        W = 0.0;
+        for (k=0;k<n;k++)  {
+          wk     = w[k];
+          c1[0] += wk*x1[k];
+          c1[1] += wk*y1[k];
+          c1[2] += wk*z1[k];
+          c2[0] += wk*x2[k];
+          c2[1] += wk*y2[k];
+          c2[2] += wk*z2[k];
+          W     += wk;
+        }
+        if (W<=0.0)  return false;
+      } else  {
+        for (k=0;k<n;k++)  {
+          c1[0] += x1[k];
+          c1[1] += y1[k];
+          c1[2] += z1[k];
+          c2[0] += x2[k];
+          c2[1] += y2[k];
+          c2[2] += z2[k];
+        }
+        W = n;
+      }
+      for (k=0;k<3;k++)  {
+        c1[k] /= W;
+        c2[k] /= W;
+      }
+
+      a00 = 0.0;  a01 = 0.0;  a02 = 0.0;
+      a10 = 0.0;  a11 = 0.0;  a12 = 0.0;
+      a20 = 0.0;  a21 = 0.0;  a22 = 0.0;
+      G   = 0.0;
+      wk  = 1.0;
+      for (k=0;k<n;k++)  {
+        if (w)  wk = w[k];
+        dx1  = x1[k] - c1[0];
+        dy1  = y1[k] - c1[1];
+        dz1  = z1[k] - c1[2];
+        dx2  = x2[k] - c2[0];
+        dy2  = y2[k] - c2[1];
+        dz2  = z2[k] - c2[2];
+        G   += wk*(dx1*dx1 + dy1*dy1 + dz1*dz1 +
+                   dx2*dx2 + dy2*dy2 + dz2*dz2);
+        dx1 *= wk;
+        dy1 *= wk;
+        dz1 *= wk;
+        a00 += dx2*dx1;  a01 += dx2*dy1;  a02 += dx2*dz1;
+        a10 += dy2*dx1;  a11 += dy2*dy1;  a12 += dy2*dz1;
+        a20 += dz2*dx1;  a21 += dz2*dy1;  a22 += dz2*dz1;
+      }
+
+      A[0][0] = a00;  A[0][1] = a01;  A[0][2] = a02;
+      A[1][0] = a10;  A[1][1] = a11;  A[1][2] = a12;
+      A[2][0] = a20;  A[2][1] = a21;  A[2][2] = a22;
+      E0 = G/2.0;
+
+      return true;
+
+    }
+
+    static realtype SuperposeDeviation ( realtype E0, realtype lambda,
+                                         realtype W )  {
+    realtype d;
+      d = 2.0*(E0-lambda)/W;
+      if (d>0.0)  return sqrt(d);
+      return 0.0;
+    }
+
+    int SuperposeCoor ( mat44 & T,
+                        rvector x1, rvector y1, rvector z1,
+                        rvector x2, rvector y2, rvector z2,
+                        int n, rvector w, realtype * rmsd )  {
+    mat33    A,R;
+    vect3    c1,c2;
+    realtype E0,W,lambda;
+    int      i,j,rc;
+
+      for (i=0;i<4;i++)  {
+        for (j=0;j<4;j++)
+          T[i][j] = 0.0;
+        T[i][i] = 1.0;
+      }
+
+      if (!SuperposeCorrelation(x1,y1,z1,x2,y2,z2,n,w,c1,c2,A,E0,W))  {
+        if (rmsd)  *rmsd = -1.0;
+        return QCP_NoPoints;
+      }
+
+      rc = QCPRotation ( A,E0,R,lambda );
+
+      for (i=0;i<3;i++)  {
+        for (j=0;j<3;j++)
+          T[i][j] = R[i][j];
+        T[i][3] = c2[i] - R[i][0]*c1[0] - R[i][1]*c1[1] - R[i][2]*c1[2];
+      }
+
+      if (rmsd)  *rmsd = SuperposeDeviation ( E0,lambda,W );
+
+      return rc;
+
+    }
+
+    realtype SuperposeRMSD ( rvector x1, rvector y1, rvector z1,
+                             rvector x2, rvector y2, rvector z2,
+                             int n, rvector w )  {
+    mat33    A;
+    vect3    c1,c2;
+    realtype E0,W;
+
+      if (!SuperposeCorrelation(x1,y1,z1,x2,y2,z2,n,w,c1,c2,A,E0,W))
+        return -1.0;
+
+      return SuperposeDeviation ( E0,QCPEigenvalue(A,E0),W );
+
+    }
+
+    int SuperposeBatch ( int nFits, ivector first, ivector len,
+                         rvector x1, rvector y1, rvector z1,
+                         rvector x2, rvector y2, rvector z2,
+                         rvector w, pmat44 T, rvector rmsd,
+                         ivector rc )  {
+    realtype r;
+    rvector  wi;
+    int      i,k,m,nOk;
+
+      nOk = 0;
+      wi  = NULL;
+      for (i=0;i<nFits;i++)  {
+        k = first[i];
+        if (w)  wi = &(w[k]);
+        if (T)
+          m = SuperposeCoor ( T[i],&(x1[k]),&(y1[k]),&(z1[k]),
+                              &(x2[k]),&(y2[k]),&(z2[k]),
+                              len[i],wi,&r );
+        else  {
+          r = SuperposeRMSD ( &(x1[k]),&(y1[k]),&(z1[k]),
+                              &(x2[k]),&(y2[k]),&(z2[k]),
+                              len[i],wi );
+          if (r<0.0)  m = QCP_NoPoints;
+                else  m = QCP_Ok;
+        }
+        if (rmsd)  rmsd[i] = r;
+        if (rc)    rc[i]   = m;
+        if (m==QCP_Ok)  nOk++;
+      }
+
+      return nOk;
+
+    }
+
+  }  // namespace math
+
+}  // namespace mmdb
@@ -0,0 +1,134 @@
+//  $Id: mmdb_math_superpose.h $
+//  =================================================================
+//
+//   CCP4 Coordinate Library: support of coordinate-related
+//   functionality in protein crystallography applications.
+//
+//   Copyright (C) The MMDB contributors 2026.
+//
+//    This library is free software: you can redistribute it and/or
+//    modify it under the terms of the GNU Lesser General Public
+//    License version 3, modified in accordance with the provisions
+//    of the license to address the requirements of UK law.
+//
+//    You should have received a copy of the modified GNU Lesser
+//    General Public License along with this library. If not, copies
+//    may be downloaded from http://www.ccp4.ac.uk/ccp4license.php
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//  =================================================================
+//
+//    18.10.26   <--  Date of Last Modification.
+//                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  -----------------------------------------------------------------
+//
+//  **** Module  :  Superpose  <interface>
+//       ~~~~~~~~~
+//  **** Project :  MMDB  ( MacroMolecular Data Base )
+//       ~~~~~~~~~
+//  **** Functions:  mmdb::math::QCPEigenvalue  ( max. eigenvalue    )
+//       ~~~~~~~~~~  mmdb::math::QCPRotation    ( optimal rotation   )
+//                   mmdb::math::SuperposeCoor  ( fit of point sets  )
+//                   mmdb::math::SuperposeRMSD  ( RMSD of best fit   )
+//                   mmdb::math::SuperposeBatch ( many fits          )
+//
+//  (C) The MMDB contributors 2026
+//
+//  =================================================================
+//
+//
+
+#ifndef __MMDB_MATH_Superpose__
+#define __MMDB_MATH_Superpose__
+
+#include "mmdb_defs.h"
+
+namespace mmdb  {
+
+  namespace math  {
+
+    //  =======================  QCP kernel  ===========================
+    //
+    //   Least-squares superposition by the quaternion eigenvalue
+    // method, in which the largest eigenvalue of the 4x4 key matrix
+    // is found by Newton iterations on its characteristic polynomial
+    // (QCP, D.L.Theobald, Acta Cryst. A61, 478-480 (2005)). Functions
+    // of this module do not allocate memory, except in the rare
+    // degenerate cases handled by singular value decomposition.
+    //
+    //   All functions use the correlation matrix of centered points
+    //
+    //     A[i][j] = Sum_k w_k*v2_k[i]*v1_k[j] ,   i,j = 0,1,2
+    //
+    // and find rotation R such that R*v1_k fit v2_k best. This is
+    // the same convention as in SuperposeAtoms(..) (mmdb_coormngr.h).
+    // Value E0 is half the sum of weighted squared norms of the
+    // centered points, (G1+G2)/2 with G = Sum_k w_k*|v_k|^2; the
+    // weighted RMSD of the best fit is then sqrt(2*(E0-lambda)/W),
+    // where lambda is the largest eigenvalue and W is the sum of
+    // weights.
+
+    enum QCP_RC  {
+      QCP_Ok       = 0,
+      QCP_NoPoints = 1,
+      QCP_SVD_Fail = 2
+    };
+
+    ///  QCPEigenvalue(..) returns the largest eigenvalue lambda of the
+    /// key matrix made of correlation matrix A. If E0 is not positive,
+    /// an upper bound of lambda is calculated from A instead.
+    extern realtype QCPEigenvalue ( mat33 & A, realtype E0 );
+
+    ///  QCPRotation(..) calculates the optimal rotation R for
+    /// correlation matrix A and returns the largest eigenvalue in
+    /// lambda. R is always a proper rotation. Returns QCP_Ok, or
+    /// QCP_SVD_Fail if a degenerate case could not be resolved, in
+    /// which case R is set to the unit matrix.
+    extern int QCPRotation ( mat33 & A, realtype E0, mat33 & R,
+                             realtype & lambda );
+
+    ///  SuperposeCoor(..) calculates the rotational-translational
+    /// matrix T such that |T*P1 - P2| is minimal in least squares,
+    /// where P1[k] = (x1[k],y1[k],z1[k]) and P2[k] = (x2[k],y2[k],
+    /// z2[k]), k=0..n-1. If weights w are given, the fit is weighted.
+    /// If rmsd is not NULL, it receives the (weighted) RMSD of the
+    /// fit. Returns QCP_XXXX codes; T is the unit matrix if there
+    /// are no points.
+    extern int SuperposeCoor ( mat44 & T,
+                               rvector x1, rvector y1, rvector z1,
+                               rvector x2, rvector y2, rvector z2,
+                               int n, rvector w=NULL,
+                               realtype * rmsd=NULL );
+
+    ///  SuperposeRMSD(..) returns the (weighted) RMSD of the best fit
+    /// of the two point sets without calculating the rotation, or
+    /// -1.0 if there are no points. For collinear or coplanar points,
+    /// where the largest eigenvalue is degenerate, the result is
+    /// accurate only to about 1.0e-4 of the points' spread.
+    extern realtype SuperposeRMSD ( rvector x1, rvector y1, rvector z1,
+                                    rvector x2, rvector y2, rvector z2,
+                                    int n, rvector w=NULL );
+
+    ///  SuperposeBatch(..) makes nFits superpositions of point sets
+    /// stored consecutively in vectors x1..z2 (and w, if given): fit
+    /// i uses points first[i]...first[i]+len[i]-1. Matrices are
+    /// returned in T[0..nFits-1] and RMSDs in rmsd[0..nFits-1];
+    /// either of them may be NULL, and if T is NULL, only the RMSDs
+    /// are calculated by the fast path. Return codes of individual
+    /// fits are put in rc[0..nFits-1] if rc is not NULL. Returns
+    /// the number of successful fits.
+    extern int SuperposeBatch ( int nFits, ivector first, ivector len,
+                                rvector x1, rvector y1, rvector z1,
+                                rvector x2, rvector y2, rvector z2,
+                                rvector w, pmat44 T, rvector rmsd,
+                                ivector rc=NULL );
+
+  }  // namespace math
+
+}  // namespace mmdb
+
+#endif
@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -46,6 +46,7 @@
 #include <time.h>
 
 #include "mmdb_mmcif_.h"
+#include "mmdb_sort.h"
 
 namespace mmdb  {
 
@@ -53,35 +54,26 @@ namespace mmdb  {
 
     //  ======================  SortTags  ===============================
 
-    void  SortTags ( psvector tag, int len, ivector index )  {
-    int  i,k,l,l1,l2;
-      if (len==1)  {
-        index[0] = 0;
-        return;
-      }
-      if (strcasecmp(tag[0],tag[1])<0)  {
-        index[0] = 0;
-        index[1] = 1;
-      } else  {
-        index[0] = 1;
-        index[1] = 0;
-      }
-      for (k=2;k<len;k++)  {
-        l2 = k-1;
-        if (strcasecmp(tag[k],tag[index[0]])<0)       l2 = 0;
-        else if (strcasecmp(tag[k],tag[index[l2]])>0) l2 = k;
-        else  {
-          l1 = 0;
-          while (l1<l2-1)  {
-            l = (l1+l2)/2;
-            if (strcasecmp(tag[k],tag[index[l]])<0)  l2 = l;
-                                               else  l1 = l;
-          }
-        }
-        for (i=k;i>l2;i--)
-          index[i] = index[i-1];
-        index[l2] = k;
+    //   Tags are compared case-insensitively; equal tags keep their
+    // original order.
+
+    struct TagLess  {
+      psvector tag;
+      bool operator() ( int i, int j ) const  {
+      int diff;
+        diff = strcasecmp ( tag[i],tag[j] );
+        if (diff)  return (diff<0);
+        return (i<j);
       }
+    };
+
+    void  SortTags ( psvector tag, int len, ivector index )  {
+    TagLess TL;
+    int     i;
+      for (i=0;i<len;i++)
+        index[i] = i;
+      TL.tag = tag;
+      SortArray ( index,len,TL );
     }
 
 
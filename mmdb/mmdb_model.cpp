@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -57,6 +57,7 @@
 #include "mmdb_model.h"
 #include "mmdb_manager.h"
 #include "mmdb_cifdefs.h"
+#include "mmdb_sort.h"
 
 namespace mmdb  {
 
@@ -3521,48 +3522,21 @@ namespace mmdb  {
 
   //  --------------------  Sort chains  ----------------------------
 
-  DefineClass(QSortChains)
-
-  class QSortChains : public QuickSort  {
-    public :
-      QSortChains() : QuickSort() { sKey = 0; }
-      int  Compare ( int i, int j );
-      void Swap    ( int i, int j );
-      void Sort    ( PPChain chain, int nChains, int sortKey );
-    private :
-      int sKey;
+  struct ChainLess  {
+    int sKey;
+    bool operator() ( PChain c1, PChain c2 ) const  {
+    int diff;
+      diff = strcmp ( c1->GetChainID(),c2->GetChainID() );
+      if (sKey==SORT_CHAIN_ChainID_Desc)  return (diff>0);
+      return (diff<0);
+    }
   };
 
-  int QSortChains::Compare ( int i, int j )  {
-  int diff;
-
-    diff = strcmp ( (PPChain(data))[i]->GetChainID(),
-                    (PPChain(data))[j]->GetChainID() );
-    if (diff>0)  diff =  1;
-    if (diff<0)  diff = -1;
-
-    if (sKey==SORT_CHAIN_ChainID_Desc) return -diff;
-
-    return diff;
-
-  }
-
-  void QSortChains::Swap ( int i, int j )  {
-  PChain chn;
-    chn = ((PPChain)data)[i];
-    ((PPChain)data)[i] = ((PPChain)data)[j];
-    ((PPChain)data)[j] = chn;
-  }
-
-  void QSortChains::Sort ( PPChain chain, int nChains, int sortKey )  {
-    sKey = sortKey;
-    QuickSort::Sort ( &(chain[0]),nChains );
-  }
-
   void Model::SortChains ( int sortKey )  {
-  QSortChains SC;
+  ChainLess CL;
     TrimChainTable();
-    SC.Sort ( chain,nChains,sortKey );
+    CL.sKey = sortKey;
+    SortArray ( chain,nChains,CL );
   }
 
 
@@ -4959,6 +4933,72 @@ namespace mmdb  {
   // -------  calculation of Secondary Structure
 
 
+  static bool isSeqNeighbour ( PResidue res1, PAtom ca1,
+                               PResidue res2, PAtom ca2 )  {
+  //  Reproduces the sequence neighbourhood (seqDist=2) of
+  //  CoorManager::SeekContacts(..) for two C-alphas: residues
+  //  adjacent in the same chain, unless there is a chain break
+  //  between them.
+  realtype dx,dy,dz;
+  int      d;
+    if ((!res1->chain) || (!res2->chain))  return false;
+    if (strcmp(res1->GetChainID(),res2->GetChainID()))  return false;
+    d = res2->index - res1->index;
+    if ((d<-1) || (d>1))  return false;
+    if (d==0)  return true;
+    dx = ca1->x - ca2->x;
+    dy = ca1->y - ca2->y;
+    dz = ca1->z - ca2->z;
+    return (dx*dx+dy*dy+dz*dz<=16.0);
+  }
+
+  static void GetCaBricks ( PPAtom Ca, int nres, ivector bkey )  {
+  //  Calculates numbers of bricks of C-alphas as bricked by
+  //  CoorManager::MakeBricks(Ca,nres,15.0), which was used for
+  //  the Ca contact search in CalcSecStructure(..) before.
+  realtype x1,x2, y1,y2, z1,z2, x0,y0,z0, bsize;
+  int      i, nbx,nby,nbz;
+    x1 = MaxReal;  x2 = -x1;
+    y1 = MaxReal;  y2 = -y1;
+    z1 = MaxReal;  z2 = -z1;
+    for (i=0;i<nres;i++)
+      if (Ca[i])  {
+        if (Ca[i]->x<x1)  x1 = Ca[i]->x;
+        if (Ca[i]->x>x2)  x2 = Ca[i]->x;
+        if (Ca[i]->y<y1)  y1 = Ca[i]->y;
+        if (Ca[i]->y>y2)  y2 = Ca[i]->y;
+        if (Ca[i]->z<z1)  z1 = Ca[i]->z;
+        if (Ca[i]->z>z2)  z2 = Ca[i]->z;
+      }
+    bsize = 6.0;
+    x1 -= 15.0;  x2 += 15.0;
+    y1 -= 15.0;  y2 += 15.0;
+    z1 -= 15.0;  z2 += 15.0;
+    nbx = mround((x2-x1)/bsize+0.0001)+1;
+    nby = mround((y2-y1)/bsize+0.0001)+1;
+    nbz = mround((z2-z1)/bsize+0.0001)+1;
+    x0  = x1 - (nbx*bsize-(x2-x1))/2.0;
+    y0  = y1 - (nby*bsize-(y2-y1))/2.0;
+    z0  = z1 - (nbz*bsize-(z2-z1))/2.0;
+    for (i=0;i<nres;i++)
+      if (Ca[i])
+        bkey[i] = ((int)floor((Ca[i]->x-x0)/bsize)*nby +
+                   (int)floor((Ca[i]->y-y0)/bsize))*nbz +
+                   (int)floor((Ca[i]->z-z0)/bsize);
+      else
+        bkey[i] = 0;
+  }
+
+  static bool acceptorBefore ( int ir1, int ir2, int donor,
+                               ivector bkey )  {
+  //  Returns true if acceptor ir1 of donor should be taken before
+  //  acceptor ir2 (see CalcSecStructure(..) below)
+    if (ir1<donor)  return (ir2>donor) || (ir1<ir2);
+    if (ir2<donor)  return false;
+    if (bkey[ir1]!=bkey[ir2])  return (bkey[ir1]<bkey[ir2]);
+    return (ir1<ir2);
+  }
+
   int Model::CalcSecStructure ( bool flagBulge, int aminoSelHnd )  {
   // This function is contributed by Liz Potterton, University of York
   //------------------------------------------------------------------
@@ -4966,20 +5006,26 @@ namespace mmdb  {
   // structure.
   // Procedure:
   // Find all amino acids
-  // Find all pairs of amino acids which have inter-Ca distance  < 10.0A
+  // Find all main chain N-O pairs closer than the H-bond cut-off,
+  // using a brick grid over carbonyl oxygens, for residues which have
+  // inter-Ca distance < 10.0A
   // Test for hydrogen bonds between the main chain N and O of the close
   // residues and store the information in the hbonds matrix
   // Analyse the info in hbonds matrix to assign secondary structure to
   // secstr vector
+  //   The function uses only local scratch space and may be run for
+  // different models concurrently.
   PPResidue Res;
-  PPAtom    Ca;
+  PPAtom    mcAtom, Ca,NAtom,OAtom,CAtom;
   PChain    chn;
-  PContact  contact;
+  BrickGrid grid;
   imatrix   hbonds;
-  PPAtom *  hbond_atoms;
-  int       nres, ncontacts;
+  ivector   hit,bkey;
+  realtype  dx,dy,dz, d2;
+  int       nres, nHits,nAlloc;
   int       ir1,ir2, irdif;
   int       i,j,k,l;
+  bool      found;
 
     // 1a. Get protein residues from selection handle
 
@@ -5019,39 +5065,64 @@ namespace mmdb  {
 
    }
 
-    //  2. Get C-alphas of all aminoacids
+    //  2. Get C-alphas of all aminoacids and their main chain
+    //     N, O and C atoms
 
-    Ca = new PAtom[nres];
+    mcAtom = new PAtom[4*nres];
+    Ca     = mcAtom;
+    NAtom  = &(mcAtom[nres]);
+    OAtom  = &(mcAtom[2*nres]);
+    CAtom  = &(mcAtom[3*nres]);
     k  = 0;
-    for (i=0;i<nres;i++)
+    for (i=0;i<nres;i++)  {
+      Ca[i]    = NULL;
+      NAtom[i] = NULL;
+      OAtom[i] = NULL;
+      CAtom[i] = NULL;
       if (Res[i])  {
         if (aminoSelHnd>=0 || Res[i]->isAminoacid())  {
           Ca[i] = Res[i]->GetAtom("CA", " C", "*");
           k++;
-        } else
-          Ca[i] = NULL;
+        }
         Res[i]->SSE = SSE_None;
-      } else
-        Ca[i] = NULL;
+      }
+      if (Ca[i])  {
+        if (Ca[i]->Ter)  Ca[i] = NULL;
+        else  {
+          NAtom[i] = Res[i]->GetAtom ( "N" );
+          OAtom[i] = Res[i]->GetAtom ( "O" );
+          CAtom[i] = Res[i]->GetAtom ( "C" );
+          if (!CAtom[i])  OAtom[i] = NULL;
+        }
+      }
+    }
 
     if (k<=0)  {
-      delete[] Res;
-      delete[] Ca;
+      if (aminoSelHnd<0)  delete[] Res;
+      delete[] mcAtom;
       return   SSERC_noAminoacids;
     }
 
 
-    //  3. Find all close Calphas - i.e. find the contacts between
-    //     the two equivalent sets of Ca atoms
+    //  3. Check that there are close Calphas at all
 
-    contact   = NULL;
-    ncontacts = 0;
-    manager->SeekContacts ( Ca,nres, Ca,nres, 2.0,10.0, 2,
-                            contact,ncontacts,0 );
-    if (ncontacts<=0)  {
-      delete[] Res;
-      delete[] Ca;
-      if (contact)  delete[] contact;
+    hit    = NULL;
+    nAlloc = 0;
+    grid.MakeGrid ( Ca,nres,0.0,10.0 );
+    found = false;
+    for (i=0;(i<nres) && (!found);i++)
+      if (Ca[i])  {
+        nHits = grid.GetShellAtoms ( Ca[i]->x,Ca[i]->y,Ca[i]->z,
+                                     2.0,10.0,hit,nAlloc );
+        for (l=0;(l<nHits) && (!found);l++)  {
+          j = hit[l];
+          found = (j!=i) && (!isSeqNeighbour(Res[i],Ca[i],Res[j],Ca[j]));
+        }
+      }
+    if (!found)  {
+      if (aminoSelHnd<0)  delete[] Res;
+      delete[] mcAtom;
+      FreeVectorMemory ( hit,0 );
       return  SSERC_noSSE;
     }
 
@@ -5059,40 +5130,58 @@ namespace mmdb  {
     //  4. Get and initialize memory for analysing the SSE
 
     GetMatrixMemory ( hbonds,nres,3,0,0 );
-    hbond_atoms = new PPAtom[nres];
-    for (i=0;i<nres;i++)  {
-      hbond_atoms[i] = new PAtom[6];
-      for (j=0;j<6;j++) hbond_atoms[i][j] = NULL;
-      for (j=0;j<3;j++) hbonds     [i][j] = 0;
-    }
-
-
-    //  5.  Loop over all close (in space) residues - excluding those
-    //      that are close in sequence
-
-    for (i=0;i<ncontacts;i++)  {
-      ir1   = contact[i].id2;
-      ir2   = contact[i].id1;
-      irdif = ir1 - ir2;
-      if (irdif>2)  {
-        //  test if there is donor Hbond from residue ir1
-        if (Res[ir1]->isMainchainHBond(Res[ir2]))  {
-          k = 0;
-          while ((hbonds[ir1][k]!=0) && (k<2))  k++;
-          hbonds     [ir1][k]   = -irdif;
-      hbond_atoms[ir1][k]   = Res[ir1]->GetAtom ( "N" );
-      hbond_atoms[ir1][k+3] = Res[ir2]->GetAtom ( "O" );
+    for (i=0;i<nres;i++)
+      for (j=0;j<3;j++) hbonds[i][j] = 0;
+
+
+    //  5.  Find H-bonds from main chain N of every residue to main
+    //      chain O of residues close in space but not in sequence.
+    //      Only 3 H-bonds per residue are kept, the last one found
+    //      replacing the 3rd; therefore, acceptors of each donor are
+    //      taken in the order of the former Ca contact search:
+    //      preceding residues in increasing order, followed by the
+    //      rest of residues in the order of their Ca bricks.
+
+    bkey = NULL;
+    GetVectorMemory ( bkey,nres,0 );
+    GetCaBricks ( Ca,nres,bkey );
+
+    grid.MakeGrid ( OAtom,nres,0.0,4.0 );
+    for (ir1=0;ir1<nres;ir1++)
+      if (NAtom[ir1])  {
+        nHits = grid.GetSphereAtoms ( NAtom[ir1]->x,NAtom[ir1]->y,
+                                      NAtom[ir1]->z,3.51,hit,nAlloc );
+        for (i=1;i<nHits;i++)  {
+          k = hit[i];
+          j = i;
+          while ((j>0) && acceptorBefore(k,hit[j-1],ir1,bkey))  {
+            hit[j] = hit[j-1];
+            j--;
+          }
+          hit[j] = k;
         }
-        //  test if there is donor Hbond from residue ir2
-        if (Res[ir2]->isMainchainHBond(Res[ir1]))  {
-      k = 0;
-          while ((hbonds[ir2][k]!=0) && (k<2))  k++;
-          hbonds     [ir2][k]   = irdif;
-      hbond_atoms[ir2][k]   = Res[ir2]->GetAtom ( "N" );
-      hbond_atoms[ir2][k+3] = Res[ir1]->GetAtom ( "O" );
+        for (l=0;l<nHits;l++)  {
+          ir2   = hit[l];
+          irdif = ir2 - ir1;
+          if ((irdif<-2) || (irdif>2))  {
+            dx = Ca[ir1]->x - Ca[ir2]->x;
+            dy = Ca[ir1]->y - Ca[ir2]->y;
+            dz = Ca[ir1]->z - Ca[ir2]->z;
+            d2 = dx*dx + dy*dy + dz*dz;
+            if ((4.0<=d2) && (d2<=100.0) &&
+                (!isSeqNeighbour(Res[ir1],Ca[ir1],Res[ir2],Ca[ir2])) &&
+                Residue::isMainchainHBond(NAtom[ir1],OAtom[ir2],
+                                          CAtom[ir2]))  {
+              k = 0;
+              while ((hbonds[ir1][k]!=0) && (k<2))  k++;
+              hbonds[ir1][k] = irdif;
+            }
+          }
         }
       }
-    }
+
+    FreeVectorMemory ( bkey,0 );
+    FreeVectorMemory ( hit ,0 );
 
     //  6. Assign the turns - if there is bifurcated bond then the 4-turn
     //     takes precedence - read the paper to make sense of this
@@ -5249,15 +5338,9 @@ namespace mmdb  {
 
     //  8. Free memory
 
-    if (hbond_atoms)  {
-      for (i=0;i<nres;i++)
-        if (hbond_atoms[i])  delete[] hbond_atoms[i];
-      delete[] hbond_atoms;
-    }
     FreeMatrixMemory ( hbonds,nres,0,0 );
-    if (contact) delete[] contact;
     if (Res && aminoSelHnd<0) delete[] Res;
-    if (Ca)      delete[] Ca;
+    delete[] mcAtom;
 
     return  SSERC_Ok;
 
@@ -1073,7 +1073,7 @@ namespace mmdb  {
     if (CleanKey & PDBCLEAN_ELEMENT)  {
       for (i=0;i<nAtoms;i++)
         if (atom[i] && (!atom[i]->Ter))  {
-          if (getElementNo(atom[i]->element)==ELEMENT_UNKNOWN)  {
+          if (atom[i]->GetElementNo()==ELEMENT_UNKNOWN)  {
             strcpy ( atom[i]->element,"  " );
             atom[i]->MakePDBAtomName();
           }
@@ -1241,32 +1241,77 @@ namespace mmdb  {
   }
 
 
+  static bool AtomsInPlace ( PPAtom A, int nA, int pos,
+                             PAtom A1, PAtom A2, int n )  {
+  //  checks whether n atoms starting with A1 and ending with A2
+  //  occupy positions pos..pos+n-1 of index A
+    if (n<=0)        return true;
+    if (pos+n>nA)    return false;
+    return (A[pos]==A1) && (A[pos+n-1]==A2);
+  }
+
   int  Root::FinishStructEdit()  {
   // Makes a new atom index after insertion or deletion of atoms.
   // This function may change atoms' positions in the index and
   // correspondingly the Atom::index field.
+  //   Only chains and residues edited since the last call are
+  // trimmed, and the index is patched starting from the first
+  // position that does not match the hierarchy. The index is
+  // reallocated only if it has to grow or to be compacted.
   PResidue res;
   PChain   chain;
   PModel   Model1;
-  PPAtom   Atom1;
-  int       i,j,k,l,n,index,nAtoms1;
+  PPAtom   Atom1,tail;
+  PAtom    A;
+  int      i,j,k,l,n,p,nc,nr,nTail,nAtoms1;
 
-    //  calculate new number of atoms
+    //  trim tables of edited chains and residues, calculate new
+    //  number of atoms and find the first position to patch
     nAtoms1 = 0;
+    p       = -1;
     for (i=0;i<nModels;i++)  {
       Model1 = model[i];
       if (Model1)  {
         for (j=0;j<Model1->nChains;j++)  {
           chain = Model1->chain[j];
           if (chain)  {
-            for (k=0;k<chain->nResidues;k++)  {
-              res = chain->residue[k];
-              if (res)  {
-                res->TrimAtomTable();
-                nAtoms1 += res->nAtoms;
+            if (chain->edited)  {
+              nc = 0;
+              for (k=0;k<chain->nResidues;k++)  {
+                res = chain->residue[k];
+                if (res)  {
+                  if (res->edited)  {
+                    res->TrimAtomTable();
+                    res->edited = false;
+                    if (p<0)  p = nAtoms1+nc;
+                  } else if ((p<0) && (res->nAtoms>0))  {
+                    if (!AtomsInPlace(atom,nAtoms,nAtoms1+nc,
+                                      res->atom[0],
+                                      res->atom[res->nAtoms-1],
+                                      res->nAtoms))
+                      p = nAtoms1+nc;
+                  }
+                  nc += res->nAtoms;
+                }
+              }
+              chain->TrimResidueTable();
+              chain->edited   = false;
+              chain->nIndexed = nc;
+            } else  {
+              nc = chain->nIndexed;
+              if ((p<0) && (nc>0))  {
+                nr = chain->nResidues;
+                if (nr<=0)  p = nAtoms1;
+                else  {
+                  res = chain->residue[nr-1];
+                  if (!AtomsInPlace(atom,nAtoms,nAtoms1,
+                                    chain->residue[0]->atom[0],
+                                    res->atom[res->nAtoms-1],nc))
+                    p = nAtoms1;
+                }
               }
             }
-            chain->TrimResidueTable();
+            nAtoms1 += nc;
           }
         }
         Model1->TrimChainTable();
@@ -1274,46 +1319,70 @@ namespace mmdb  {
     }
     TrimModelTable();
 
-    // compile a new index and null the old one
+    if (p<0)  p = nAtoms1;
+
+    //  keep the old index from position p on for finding dead atoms
+    nTail = nAtoms-p;
+    tail  = NULL;
+    if (nTail>0)  {
+      tail = new PAtom[nTail];
+      for (i=0;i<nTail;i++)
+        tail[i] = atom[p+i];
+    }
 
-    if (nAtoms1>0)  Atom1 = new PAtom[nAtoms1];
-              else  Atom1 = NULL;
+    if ((nAtoms1>atmLen) || (atmLen-nAtoms1>nAtoms1/2+1000))  {
+      // make a new index
+      if (nAtoms1>0)  Atom1 = new PAtom[nAtoms1];
+                else  Atom1 = NULL;
+      for (i=0;i<p;i++)
+        Atom1[i] = atom[i];
+      if (atom)  delete[] atom;
+      atom   = Atom1;
+      atmLen = nAtoms1;
+    } else
+      for (i=nAtoms1;i<nAtoms;i++)
+        atom[i] = NULL;
 
+    //  patch the index from position p on
     n = 0;
-    for (i=0;i<nModels;i++)  {
+    for (i=0;(i<nModels) && (n<nAtoms1);i++)  {
       Model1 = model[i];
-      for (j=0;j<Model1->nChains;j++)  {
+      for (j=0;(j<Model1->nChains) && (n<nAtoms1);j++)  {
         chain = Model1->chain[j];
-        for (k=0;k<chain->nResidues;k++)  {
-          res = chain->residue[k];
-          for (l=0;l<res->nAtoms;l++)  {
-            Atom1[n] = res->atom[l];
-            index    = Atom1[n]->index;
-            if ((index>0) && (index<=atmLen))
-              atom[index-1] = NULL;
-            Atom1[n]->index = n+1;
-            n++;
+        if (n+chain->nIndexed<=p)
+          n += chain->nIndexed;
+        else
+          for (k=0;k<chain->nResidues;k++)  {
+            res = chain->residue[k];
+            for (l=0;(l<res->nAtoms) && (n<nAtoms1);l++)  {
+              if (n>=p)  {
+                atom[n] = res->atom[l];
+                atom[n]->index = n+1;
+              }
+              n++;
+            }
           }
-        }
       }
     }
 
-  //  if (n!=nAtoms1)  {
-  //    printf ( " **** PROGRAM ERROR IN Root::FinishStructEdit\n" );
-  //    exit ( 1 );
-  //  }
-
-
-    // check if there are dead atoms in the old index
-    for (i=0;i<atmLen;i++)
-      if (atom[i])  delete atom[i];
+    //  dispose atoms which were in the index but are no longer
+    //  in the hierarchy
+    for (i=0;i<nTail;i++)  {
+      A = tail[i];
+      if (A)  {
+        k = A->index;
+        if ((k<1) || (k>nAtoms1) || (atom[k-1]!=A))  {
+          A->index   = -1;
+          A->residue = NULL;
+          delete A;
+        }
+      }
+    }
+    if (tail)  delete[] tail;
 
-    // dispose old index and replace it with the new one
-    if (atom)  delete[] atom;
+    nAtoms = nAtoms1;
 
-    atom   = Atom1;
-    atmLen = n;
-    nAtoms = n;
+    StructureEdited();
 
     if (n==nAtoms1)  return 0;  // Ok
                else  return 1;  // not Ok; should never happen
@@ -596,6 +596,11 @@ namespace mmdb  {
 
       virtual void ResetManager();
 
+      //   StructureEdited() is called by FinishStructEdit() after the
+      // atom index has been rebuilt, so that derived classes may
+      // drop data made for the old set of atoms.
+      virtual void StructureEdited() {}
+
       //  ---------------  Stream I/O  -----------------------------
       void  write ( io::RFile f );
       void  read  ( io::RFile f );
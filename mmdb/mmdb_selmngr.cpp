@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    15.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -44,12 +44,18 @@
 #include <math.h>
 
 #include "mmdb_selmngr.h"
+#include "mmdb_sort.h"
 
 
 namespace mmdb  {
 
   const int ANY_RES = MinInt4;
 
+  #define  hetIndicator '@'
+
+  //  maximal number of compiled CIDs kept by SelManager::Select(..)
+  const int maxSelQueries = 32;
+
   //  ====================   SelManager   =====================
 
   SelManager::SelManager() : CoorManager()  {
@@ -63,20 +69,85 @@ namespace mmdb  {
 
   SelManager::~SelManager()  {
     DeleteAllSelections();
+    RemoveSelBricks    ();
+    FreeSelQueries     ();
   }
 
   void  SelManager::ResetManager()  {
     CoorManager::ResetManager();
     DeleteAllSelections();
+    RemoveSelBricks    ();
+    FreeSelQueries     ();
     InitSelManager ();
   }
 
   void  SelManager::InitSelManager()  {
-    nSelections = 0;     // number of selections
-    mask        = NULL;  // vector of selections
-    selType     = NULL;  // vector of selection types
-    nSelItems   = NULL;  // numbers of selected items
-    selection   = NULL;  // vector of selected items
+    nSelections  = 0;     // number of selections
+    mask         = NULL;  // vector of selections
+    selType      = NULL;  // vector of selection types
+    nSelItems    = NULL;  // numbers of selected items
+    selection    = NULL;  // vector of selected items
+    selBricks    = NULL;  // brick grid for region selections
+    selHit       = NULL;  // work vector for region selections
+    nSelHitAlloc = 0;
+    selHitFlag   = NULL;
+    selQuery     = NULL;  // cache of compiled CIDs
+    nSelQueries  = 0;
+    selQueryPos  = 0;
+    frozen       = false; // read-only mode flag
+  }
+
+  void  SelManager::FreeSelQueries()  {
+  int i;
+    if (selQuery)  {
+      for (i=0;i<nSelQueries;i++)
+        if (selQuery[i])  delete selQuery[i];
+      delete[] selQuery;
+    }
+    selQuery    = NULL;
+    nSelQueries = 0;
+    selQueryPos = 0;
+    fieldQuery.FreeMemory();
+  }
+
+
+  // ------------------  Bricking for selections  ---------------------
+
+  void  SelManager::MakeSelBricks ( realtype BrickSize )  {
+  int i;
+    if (frozen)  return;  // the grid is shared
+    RemoveSelBricks();
+    if ((!atom) || (nAtoms<=0))  return;
+    selBricks = new BrickGrid();
+    selBricks->MakeGrid ( atom,nAtoms,0.0,BrickSize );
+    GetVectorMemory ( selHitFlag,nAtoms,0 );
+    for (i=0;i<nAtoms;i++)
+      selHitFlag[i] = 0;
+  }
+
+  void  SelManager::RemoveSelBricks()  {
+    if (selBricks)  delete selBricks;
+    selBricks = NULL;
+    FreeVectorMemory ( selHit    ,0 );
+    FreeVectorMemory ( selHitFlag,0 );
+    nSelHitAlloc = 0;
+  }
+
+  void  SelManager::CoordinatesMoved()  {
+    RemoveSelBricks();
+  }
+
+  void  SelManager::StructureEdited()  {
+    RemoveSelBricks();
+  }
+
+  bool  SelManager::areSelBricks()  {
+  // the grid is good only for the atom index it was made on
+    if (selBricks)  {
+      if ((selBricks->atom==atom) && (selBricks->nAtoms==nAtoms))
+        return selBricks->isReady();
+    }
+    return false;
   }
 
 
@@ -90,6 +161,8 @@ namespace mmdb  {
   SELECTION_TYPE * SelType1;
   int      i,l;
 
+    if (frozen)  return 0;  // no masks in read-only mode
+
     M = new Mask();
     M->NewMask ( mask,nSelections );
 
@@ -149,7 +222,7 @@ namespace mmdb  {
 
   void  SelManager::DeleteSelection ( int selHnd )  {
   int i,k;
-    if ((selHnd>0) && (selHnd<=nSelections))  {
+    if ((!frozen) && (selHnd>0) && (selHnd<=nSelections))  {
       k = selHnd-1;
       if (mask[k])  {
         for (i=0;i<nSelItems[k];i++)
@@ -235,7 +308,7 @@ namespace mmdb  {
   int           i,s1,s2,k,nsel;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections) || (nAtoms<=0))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections) || (nAtoms<=0))  return;
 
     k  = selHnd-1;
     sk = sKey;
@@ -299,12 +372,11 @@ namespace mmdb  {
                                   SELECTION_KEY selKey )  {
   //   SelectAtoms(..) selects atoms with serial numbers given in
   // vector asn[0..nsn-1].
-  QuickSort     QS;
   ivector       asn1;
   int           i,k,nsn1,j,j1,j2, sn,nsel;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections) || (nAtoms<=0))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections) || (nAtoms<=0))  return;
 
     k  = selHnd-1;
     sk = selKey;
@@ -334,7 +406,7 @@ namespace mmdb  {
     for (i=0;i<nsn;i++)
       asn1[i] = asn[i];
 
-    QS.Sort ( asn1,nsn );
+    RadixSort ( asn1,nsn );
     nsn1 = nsn-1;
 
     for (i=0;i<nAtoms;i++)
@@ -374,7 +446,7 @@ namespace mmdb  {
   // is set to 0, then the atoms are cleared of any mask.
   int i,s1,s2,k;
 
-    if ((selHnd<=nSelections) && (nAtoms>0))  {
+    if ((!frozen) && (selHnd<=nSelections) && (nAtoms>0))  {
 
       k = selHnd-1;
 
@@ -505,13 +577,266 @@ namespace mmdb  {
   }
 
 
+  //  =====================   SelNames   ======================
+
+  SelNames::SelNames()  {
+    InitSelNames();
+  }
+
+  SelNames::~SelNames()  {
+    FreeMemory();
+  }
+
+  void  SelNames::InitSelNames()  {
+    item    = NULL;
+    key     = NULL;
+    nItems  = 0;
+    any     = true;
+    negate  = false;
+    bracket = false;
+    keyed   = false;
+  }
+
+  void  SelNames::FreeMemory()  {
+  int i;
+    if (item)  {
+      for (i=0;i<nItems;i++)
+        if (item[i])  delete[] item[i];
+      delete[] item;
+    }
+    FreeVectorMemory ( key,0 );
+    InitSelNames();
+  }
+
+  bool  SelNames::NameKey ( cpstr N, word & key )  {
+  int i,n;
+    key = 0;
+    n   = 0;
+    for (i=0;N[i];i++)
+      if (N[i]!=' ')  {
+        if (n>=4)  return false;
+        key = (key << 8) | word((unsigned char)N[i]);
+        n++;
+      }
+    return true;
+  }
+
+  void  SelNames::Make ( cpstr S )  {
+  //   Splits the list made by MakeList(..) into items, so that
+  // matching gives the same result as MatchName(..).
+  pstr L;
+  int  i,j,n;
+    FreeMemory();
+    if (!S)  return;
+    L = MakeList ( S );
+    if (!L)  return;
+    any     = false;
+    negate  = (L[0]=='!');
+    bracket = (L[1]=='"');
+    n = 0;
+    for (i=3;L[i];i++)
+      if (L[i]==',')  n++;
+    item = new pstr[n+1];
+    i    = 3;
+    while (L[i])  {
+      j = i;
+      if (L[j]=='[')
+        while (L[j] && (L[j]!=']'))  j++;
+      while (L[j] && (L[j]!=','))  j++;
+      item[nItems] = new char[j-i+1];
+      strncpy ( item[nItems],&(L[i]),j-i );
+      item[nItems][j-i] = char(0);
+      nItems++;
+      if (L[j])  j++;
+      i = j;
+    }
+    delete[] L;
+    // items have no spaces, except for [..]-quoted ones
+    keyed = !bracket;
+    if (keyed)  {
+      GetVectorMemory ( key,nItems,0 );
+      for (i=0;(i<nItems) && keyed;i++)
+        keyed = NameKey ( item[i],key[i] );
+      if (!keyed)  FreeVectorMemory ( key,0 );
+    }
+  }
+
+  bool  SelNames::Match ( cpstr N )  {
+  word nkey;
+  int  i,j,k,l;
+    if (any)  return true;
+    if (keyed)  {
+      // a name longer than any item cannot match
+      if (!NameKey(N,nkey))  return negate;
+      for (k=0;k<nItems;k++)
+        if (key[k]==nkey)  return !negate;
+      return negate;
+    }
+    // compare items with the name with spaces removed
+    for (k=0;k<nItems;k++)  {
+      i = 0;
+      j = 0;
+      while (N[j])
+        if (N[j]==' ')  j++;
+        else if (item[k][i]==N[j])  {
+          i++;
+          j++;
+        } else
+          break;
+      if ((!N[j]) && (!item[k][i]))  return !negate;
+    }
+    if (bracket)  {
+      // compare items with "[N]"
+      l = strlen(N);
+      for (k=0;k<nItems;k++)
+        if ((item[k][0]=='[') && (!strncmp(&(item[k][1]),N,l)) &&
+            (item[k][l+1]==']') && (!item[k][l+2]))
+          return !negate;
+    }
+    return negate;
+  }
+
+
+  //  ==================   SelectionQuery   ===================
+
+  SelectionQuery::SelectionQuery()  {
+    InitSelectionQuery();
+  }
+
+  SelectionQuery::SelectionQuery ( cpstr CID )  {
+    InitSelectionQuery();
+    Compile ( CID );
+  }
+
+  SelectionQuery::~SelectionQuery()  {
+    FreeMemory();
+  }
+
+  void  SelectionQuery::InitSelectionQuery()  {
+    CID     = NULL;
+    RC      = 0;
+    model   = 0;
+    seqNum1 = ANY_RES;
+    seqNum2 = ANY_RES;
+    strcpy ( insCode1,"*" );
+    strcpy ( insCode2,"*" );
+    noRes   = true;
+    hetOnly = false;
+  }
+
+  void  SelectionQuery::FreeMemory()  {
+    if (CID)  delete[] CID;
+    CID = NULL;
+    chains   .FreeMemory();
+    resNames .FreeMemory();
+    atomNames.FreeMemory();
+    elements .FreeMemory();
+    altLocs  .FreeMemory();
+    InitSelectionQuery();
+  }
+
+  int  SelectionQuery::Compile ( cpstr selCID )  {
+  InsCode ic1,ic2;
+  pstr    RNames;
+  pstr    ANames;
+  pstr    Elements;
+  pstr    aLocs;
+  pstr    Chains;
+  int     sn1,sn2;
+  int     iModel,l,rc;
+
+    FreeMemory();
+    CreateCopy ( CID,selCID );
+
+    if (!strcmp(selCID,"-all"))  {
+      // all atoms in main conformation
+      Set ( 0,"*",ANY_RES,"*",ANY_RES,"*","*","*","*","" );
+      return 0;
+    }
+
+    l = IMax(10,strlen(selCID))+1;
+    Chains   = new char[l];
+    RNames   = new char[l];
+    ANames   = new char[l];
+    Elements = new char[l];
+    aLocs    = new char[l];
+
+    rc = ParseSelectionPath ( selCID,iModel,Chains,sn1,ic1,sn2,ic2,
+                              RNames,ANames,Elements,aLocs );
+    if (!rc)
+      Set ( iModel,Chains,sn1,ic1,sn2,ic2,RNames,ANames,Elements,aLocs );
+
+    delete[] Chains;
+    delete[] RNames;
+    delete[] ANames;
+    delete[] Elements;
+    delete[] aLocs;
+
+    RC = rc;
+    return RC;
+
+  }
+
+  void  SelectionQuery::Set ( int   iModel,
+                              cpstr Chains,
+                              int   ResNo1, cpstr Ins1,
+                              int   ResNo2, cpstr Ins2,
+                              cpstr RNames,
+                              cpstr ANames,
+                              cpstr Elements,
+                              cpstr aLocs )  {
+  pstr altLocs1;
+  pstr p;
+
+    model   = iModel;
+    seqNum1 = ResNo1;
+    seqNum2 = ResNo2;
+    strcpy_n0 ( insCode1,Ins1,sizeof(InsCode)-1 );
+    strcpy_n0 ( insCode2,Ins2,sizeof(InsCode)-1 );
+    RC      = 0;
+
+    //  noRes==true means no residue restrictions
+    noRes   = (ResNo1==ResNo2) && (ResNo1==ANY_RES) &&
+              (Ins1[0]=='*')   && (Ins2[0]=='*');
+
+    hetOnly = false;
+    if (aLocs)  {
+      if (strchr(aLocs,hetIndicator))  {
+        // take only HETATMs, remove the indicator from the list
+        hetOnly  = true;
+        altLocs1 = NULL;
+        CreateCopy ( altLocs1,aLocs );
+        DelSpaces  ( altLocs1 );
+        p = strchr ( altLocs1,hetIndicator );
+        p[0] = ' ';
+        if (p[1])  p[1] = ' ';  // instead of comma
+        else if (p!=altLocs1)  {
+          p--;
+          p[0] = ' ';
+        }
+        DelSpaces ( altLocs1 );
+        altLocs.Make ( altLocs1 );
+        delete[] altLocs1;
+      } else
+        altLocs.Make ( aLocs );
+    } else
+      altLocs.Make ( aLocs );
+
+    chains   .Make ( Chains   );
+    resNames .Make ( RNames   );
+    atomNames.Make ( ANames   );
+    elements .Make ( Elements );
+
+  }
+
+
   void SelManager::SelectAtom ( int selHnd, PAtom A,
                                 SELECTION_KEY selKey,
                                 bool makeIndex )  {
   int           i, k, nsel;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections))  return;
 
     k  = selHnd-1;
     sk = selKey;
@@ -556,7 +881,7 @@ namespace mmdb  {
   int           i, k, nsel, nat;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections))  return;
 
     k  = selHnd-1;
     sk = sKey;
@@ -614,7 +939,7 @@ namespace mmdb  {
   int       i,j, k, nsel, nat,nres;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections))  return;
 
     k  = selHnd-1;
     sk = sKey;
@@ -683,7 +1008,7 @@ namespace mmdb  {
   int       i,j,n, k, nsel, nat,nres,nch;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections))  return;
 
     k  = selHnd-1;
     sk = sKey;
@@ -755,7 +1080,7 @@ namespace mmdb  {
 
   int SelManager::MakeSelIndex ( int selHnd )  {
   int k;
-    if ((selHnd<=0) || (selHnd>nSelections))  return 0;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections))  return 0;
     k = selHnd-1;
     if (selType[k]==STYPE_UNDEFINED)  return 0;
     MakeSelIndex ( selHnd,selType[k],-1 );
@@ -764,6 +1089,7 @@ namespace mmdb  {
 
   void SelManager::MakeAllSelIndexes()  {
   int k;
+    if (frozen)  return;
     for (k=0;k<nSelections;k++)
       if (selType[k]!=STYPE_UNDEFINED)
         MakeSelIndex ( k+1,selType[k],-1 );
@@ -820,8 +1146,6 @@ namespace mmdb  {
   }
 
 
-  #define  hetIndicator '@'
-
   void  SelManager::Select (
                int   selHnd,   // must be obtained from NewSelection()
                SELECTION_TYPE sType,  // selection type STYPE_XXXXX
@@ -883,7 +1207,7 @@ namespace mmdb  {
   bool     modelSel,chainSel,resSel;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections) || (nAtoms<=0))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections) || (nAtoms<=0))  return;
 
     modelSel = false;
 
@@ -1131,53 +1455,37 @@ namespace mmdb  {
                cpstr          CID,   // coordinate ID
                SELECTION_KEY  sKey   // selection key
                       )  {
-  InsCode insCode1,insCode2;
-  pstr    RNames;
-  pstr    ANames;
-  pstr    Elements;
-  pstr    altLocs;
-  pstr    Chains;
-  int     seqNum1 ,seqNum2;
-  int     iModel,l,RC;
-
-    l = IMax(10,strlen(CID))+1;
-    Chains   = new char[l];
-    RNames   = new char[l];
-    ANames   = new char[l];
-    Elements = new char[l];
-    altLocs  = new char[l];
-
-    if (strcmp(CID,"-all"))  {
-      RC = ParseSelectionPath ( CID,iModel,Chains,seqNum1,insCode1,
-                                seqNum2,insCode2,RNames,ANames,
-                                Elements,altLocs );
-    } else  {
-      iModel = 0;
-      strcpy ( Chains,"*" );
-      seqNum1 = ANY_RES;
-      seqNum2 = ANY_RES;
-      strcpy ( insCode1,"*" );
-      strcpy ( insCode2,"*" );
-      strcpy ( RNames  ,"*" );
-      strcpy ( ANames  ,"*" );
-      strcpy ( Elements,"*" );
-      strcpy ( altLocs ,""  ); // only main conformation by default
-      RC = 0;
-    }
-
-    if (!RC)  {
-      Select ( selHnd,sType,iModel,Chains,seqNum1,insCode1,
-               seqNum2,insCode2,RNames,ANames,Elements,altLocs,sKey );
-      RC = 0;
+  PSelectionQuery query;
+  int             i;
+
+    // the cache must not be touched by concurrent readers of a frozen
+    // manager, and is not needed for an invalid handle
+    if (frozen || (selHnd<=0) || (selHnd>nSelections))  return 0;
+
+    // look up the CID among recently compiled ones
+    query = NULL;
+    for (i=0;(i<nSelQueries) && (!query);i++)
+      if (!strcmp(selQuery[i]->CID,CID))
+        query = selQuery[i];
+
+    if (!query)  {
+      if (!selQuery)  {
+        selQuery = new PSelectionQuery[maxSelQueries];
+        for (i=0;i<maxSelQueries;i++)
+          selQuery[i] = NULL;
+      }
+      if (nSelQueries<maxSelQueries)  {
+        selQuery[nSelQueries] = new SelectionQuery();
+        query = selQuery[nSelQueries++];
+      } else  {
+        // replace the oldest entry
+        query = selQuery[selQueryPos];
+        selQueryPos = (selQueryPos+1) % maxSelQueries;
+      }
+      query->Compile ( CID );
     }
 
-    delete[] Chains;
-    delete[] RNames;
-    delete[] ANames;
-    delete[] Elements;
-    delete[] altLocs;
-
-    return RC;
+    return Select ( selHnd,sType,*query,sKey );
 
   }
 
@@ -1208,21 +1516,32 @@ namespace mmdb  {
                                // alternative location'
                SELECTION_KEY sKey    // selection key
                       )  {
+    // fieldQuery is shared, so it must not be touched by concurrent
+    // readers of a frozen manager
+    if (frozen || (selHnd<=0) || (selHnd>nSelections))  return;
+    fieldQuery.Set ( iModel,Chains,ResNo1,Ins1,ResNo2,Ins2,
+                     RNames,ANames,Elements,altLocs );
+    Select ( selHnd,sType,fieldQuery,sKey );
+  }
+
+  int  SelManager::Select (
+               int           selHnd, // must be obtained from NewSelection()
+               SELECTION_TYPE sType, // selection type STYPE_XXXXX
+               RSelectionQuery query, // compiled coordinate ID
+               SELECTION_KEY  sKey   // selection key
+                      )  {
   PModel   mdl;
   PChain   chain;
   PResidue res;
   PAtom    atom;
-  pstr     chain_l;
-  pstr     res_l;
-  pstr     atom_l;
-  pstr     elem_l;
-  pstr     altLocs1;
-  pstr     aloc_l;
   int      i,j,k,n,m1,m2,c, nsel;
   bool     noRes,modelSel,chainSel,resSel,selAND;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections) || (nAtoms<=0))  return;
+    if (query.RC)  return query.RC;
+
+    if (frozen || (selHnd<=0) || (selHnd>nSelections) || (nAtoms<=0))
+      return 0;
 
     modelSel = false;
 
@@ -1231,7 +1550,7 @@ namespace mmdb  {
 
     if ((selType[k]==STYPE_UNDEFINED) || (sKey==SKEY_NEW))
              selType[k] = sType;
-    else if (selType[k]!=sType)  return;
+    else if (selType[k]!=sType)  return 0;
 
     // if something goes wrong, sk should be assigned SKEY_OR if
     // selKey is set to SKEY_NEW or SKEY_OR below
@@ -1248,42 +1567,16 @@ namespace mmdb  {
       case SKEY_AND : nsel = 0;             break;
       case SKEY_XOR : nsel = nSelItems[k];  break;
       case SKEY_CLR : nsel = nSelItems[k];
-                      if (nsel<=0)  return;
+                      if (nsel<=0)  return 0;
                     break;
-      default       : return;
+      default       : return 0;
     }
 
     selAND  = (sKey==SKEY_AND);
 
-    altLocs1 = NULL;
-    if (altLocs)  {
-      if (strchr(altLocs,hetIndicator))  {
-        CreateCopy ( altLocs1,altLocs );
-        DelSpaces  ( altLocs1 );
-        aloc_l = strchr ( altLocs1,hetIndicator );
-        aloc_l[0] = ' ';
-        if (aloc_l[1])  aloc_l[1] = ' ';  // instead of comma
-        else if (aloc_l!=altLocs1)  {
-          aloc_l--;
-          aloc_l[0] = ' ';
-        }
-        DelSpaces  ( altLocs1 );
-        aloc_l = MakeList ( altLocs1 );
-      } else
-        aloc_l = MakeList ( altLocs );
-    } else
-      aloc_l = MakeList ( altLocs );
-
-    chain_l = MakeList ( Chains   );
-    res_l   = MakeList ( RNames   );
-    atom_l  = MakeList ( ANames   );
-    elem_l  = MakeList ( Elements );
+    noRes = query.noRes;
 
-    //  noRes==true means no residue restrictions
-    noRes   = (ResNo1==ResNo2) && (ResNo1==ANY_RES) &&
-              (Ins1[0]=='*')   && (Ins2[0]=='*');
-
-    m1      = iModel-1;
+    m1    = query.model-1;
     if (m1>=0)
       m2 = m1+1;     // will take only this model
     else  {
@@ -1291,7 +1584,7 @@ namespace mmdb  {
       m2 = nModels;  //   all models
     }
 
-    if (m1>=nModels)  return;
+    if (m1>=nModels)  return 0;
 
     for (n=0;n<nModels;n++)  {
       mdl = model[n];
@@ -1302,17 +1595,17 @@ namespace mmdb  {
             chain = mdl->chain[c];
             if (chain)  {  // again check for safety
               chainSel = false; // will be true on 1st sel-n in the chain
-              if (MatchName(chain_l,chain->chainID))  {
+              if (query.chains.Match(chain->chainID))  {
                 // the chain is to be taken
                 i = 0;
                 if (!noRes)  // skip "leading" residues
                   while (i<chain->nResidues)  {
                     res = chain->residue[i];
                     if (res)  {
-                      if ((res->seqNum==ResNo1) &&
-                          MatchName(res_l,res->name) &&
-                          ((Ins1[0]=='*') ||
-                           (!strcmp(res->insCode,Ins1))))
+                      if ((res->seqNum==query.seqNum1) &&
+                          query.resNames.Match(res->name) &&
+                          ((query.insCode1[0]=='*') ||
+                           (!strcmp(res->insCode,query.insCode1))))
                         break;
                       else if (selAND)  {
                         if (sType==STYPE_ATOM)
@@ -1329,15 +1622,15 @@ namespace mmdb  {
                   if (res)  {
                     resSel = false; // will be true on 1st selection
                                     // in the residue
-                    if (MatchName(res_l,res->name))  {
+                    if (query.resNames.Match(res->name))  {
                       for (j=0;j<res->nAtoms;j++)  {
                         atom = res->atom[j];
                         if (atom)  {
-                          if ((!atom->Ter)                    &&
-                              MatchName(atom_l,atom->name   ) &&
-                              MatchName(elem_l,atom->element) &&
-                              MatchName(aloc_l,atom->altLoc ) &&
-                              ((!altLocs1) || atom->Het))  {
+                          if ((!atom->Ter)                          &&
+                              query.atomNames.Match(atom->name   ) &&
+                              query.elements .Match(atom->element) &&
+                              query.altLocs  .Match(atom->altLoc ) &&
+                              ((!query.hetOnly) || atom->Het))  {
                             SelectObject ( sType,atom,k,sk,nsel );
                             resSel   = true;
                             chainSel = true;
@@ -1353,8 +1646,9 @@ namespace mmdb  {
                       res->RemoveMask ( mask[k] );
                     if (chainSel && (sType>STYPE_RESIDUE))  break;
                     if (!noRes)  {
-                      if ((res->seqNum==ResNo2) &&
-                          ((Ins2[0]=='*') || (!strcmp(res->insCode,Ins2)))
+                      if ((res->seqNum==query.seqNum2) &&
+                          ((query.insCode2[0]=='*') ||
+                           (!strcmp(res->insCode,query.insCode2)))
                          ) break;
                     }
                   }
@@ -1396,16 +1690,131 @@ namespace mmdb  {
       }
     }
 
-    // release dynamic memory
-    if (chain_l)  delete[] chain_l;
-    if (res_l)    delete[] res_l;
-    if (atom_l)   delete[] atom_l;
-    if (elem_l)   delete[] elem_l;
-    if (altLocs1) delete[] altLocs1;
-    if (aloc_l)   delete[] aloc_l;
-
     MakeSelIndex ( selHnd,sType,nsel );
 
+    return 0;
+
+  }
+
+
+  int  SelManager::CollectQuery ( RSelectionQuery query,
+                                  SELECTION_TYPE  sType,
+                                  PPAtom A, PPResidue R )  {
+  //   Read-only counterpart of Select(..) for atoms and residues:
+  // counts matching items and, if A (R) is not NULL, stores them
+  // in A (R). Neither the structure nor selections are changed.
+  PModel   mdl;
+  PChain   chain;
+  PResidue res;
+  PAtom    atom;
+  int      i,j,n,m1,m2,c, nsel;
+  bool     resSel;
+
+    nsel = 0;
+    if (query.RC)  return 0;
+
+    m1 = query.model-1;
+    if (m1>=0)  m2 = m1+1;
+    else  {
+      m1 = 0;
+      m2 = nModels;
+    }
+
+    for (n=m1;(n<m2) && (n<nModels);n++)  {
+      mdl = model[n];
+      if (mdl)
+        for (c=0;c<mdl->nChains;c++)  {
+          chain = mdl->chain[c];
+          if (chain)  {
+            if (query.chains.Match(chain->chainID))  {
+              i = 0;
+              if (!query.noRes)  // skip "leading" residues
+                while (i<chain->nResidues)  {
+                  res = chain->residue[i];
+                  if (res)  {
+                    if ((res->seqNum==query.seqNum1) &&
+                        query.resNames.Match(res->name) &&
+                        ((query.insCode1[0]=='*') ||
+                         (!strcmp(res->insCode,query.insCode1))))
+                      break;
+                  }
+                  i++;
+                }
+              while (i<chain->nResidues)  {
+                res = chain->residue[i];
+                i++;
+                if (res)  {
+                  resSel = false;
+                  if (query.resNames.Match(res->name))
+                    for (j=0;(j<res->nAtoms) && (!resSel);j++)  {
+                      atom = res->atom[j];
+                      if (atom)  {
+                        if ((!atom->Ter)                          &&
+                            query.atomNames.Match(atom->name   ) &&
+                            query.elements .Match(atom->element) &&
+                            query.altLocs  .Match(atom->altLoc ) &&
+                            ((!query.hetOnly) || atom->Het))  {
+                          if (sType==STYPE_ATOM)  {
+                            if (A)  A[nsel] = atom;
+                            nsel++;
+                          } else  {
+                            if (R)  R[nsel] = res;
+                            nsel++;
+                            resSel = true;
+                          }
+                        }
+                      }
+                    }
+                  if (!query.noRes)  {
+                    if ((res->seqNum==query.seqNum2) &&
+                        ((query.insCode2[0]=='*') ||
+                         (!strcmp(res->insCode,query.insCode2)))
+                       ) break;
+                  }
+                }
+              }
+            }
+          }
+        }
+    }
+
+    return nsel;
+
+  }
+
+  int  SelManager::SelectAtoms ( RSelectionQuery query,
+                                 PPAtom & A, int & nA )  {
+    A  = NULL;
+    nA = CollectQuery ( query,STYPE_ATOM,NULL,NULL );
+    if (nA>0)  {
+      A = new PAtom[nA];
+      CollectQuery ( query,STYPE_ATOM,A,NULL );
+    }
+    return query.RC;
+  }
+
+  int  SelManager::SelectResidues ( RSelectionQuery query,
+                                    PPResidue & R, int & nR )  {
+    R  = NULL;
+    nR = CollectQuery ( query,STYPE_RESIDUE,NULL,NULL );
+    if (nR>0)  {
+      R = new PResidue[nR];
+      CollectQuery ( query,STYPE_RESIDUE,NULL,R );
+    }
+    return query.RC;
+  }
+
+  int  SelManager::GetAtomStatistics ( RSelectionQuery query,
+                                       RAtomStat AS )  {
+  PPAtom A;
+  int    i,nA;
+    SelectAtoms ( query,A,nA );
+    AS.Init();
+    for (i=0;i<nA;i++)
+      A[i]->CalAtomStatistics ( AS );
+    AS.Finish();
+    if (A)  delete[] A;
+    return query.RC;
   }
 
 
@@ -1426,7 +1835,8 @@ namespace mmdb  {
   int      k1,k2,i,j,l,n,nsel;
   SELECTION_KEY sk;
 
-    if ((selHnd1<=0) || (selHnd1>nSelections) ||
+    if (frozen ||
+        (selHnd1<=0) || (selHnd1>nSelections) ||
         (selHnd2<=0) || (selHnd2>nSelections) || (nAtoms<=0))  return;
 
     k1 = selHnd1-1;
@@ -1610,7 +2020,7 @@ namespace mmdb  {
   bool     doSelect;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections) || (nAtoms<=0))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections) || (nAtoms<=0))  return;
 
     k  = selHnd-1;
     if ((selType[k]==STYPE_UNDEFINED) || (sKey==SKEY_NEW))
@@ -1746,7 +2156,7 @@ namespace mmdb  {
     else if (selType[k]!=sType)  return;
 
 
-    if ((selHnd<=0) || (selHnd>nSelections))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections))  return;
 
     switch (sType)  {
       case STYPE_ATOM    : if ((UDDhandle & UDRF_ATOM)==0)    return;
@@ -1882,7 +2292,7 @@ namespace mmdb  {
     else if (selType[k]!=sType)  return;
 
 
-    if ((selHnd<=0) || (selHnd>nSelections))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections))  return;
 
     switch (sType)  {
       case STYPE_ATOM    : if ((UDDhandle & UDRF_ATOM)==0)    return;
@@ -2053,7 +2463,7 @@ namespace mmdb  {
     else if (selType[k]!=sType)  return;
 
 
-    if ((selHnd<=0) || (selHnd>nSelections))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections))  return;
 
     switch (sType)  {
       case STYPE_ATOM    : if ((UDDhandle & UDRF_ATOM)==0)    return;
@@ -2180,11 +2590,11 @@ namespace mmdb  {
   PChain    chain;
   PModel    mdl;
   realtype  dx,dy,dz, r2;
-  int       i,k, nat,nsel, im,ic,ir;
+  int       i,k, nat,nsel,nhit, im,ic,ir;
   bool      ASel, resSel,chainSel,modelSel,selAND;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections) || (r<=0.0))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections) || (r<=0.0))  return;
 
     k   = selHnd-1;
     sk  = sKey;
@@ -2226,7 +2636,12 @@ namespace mmdb  {
 
     r2 = r*r;
 
-    if (sType==STYPE_ATOM)  {
+    if ((A==atom) && areSelBricks())  {
+
+      nhit = selBricks->GetSphereAtoms ( x,y,z,r,selHit,nSelHitAlloc );
+      SelectHits ( sType,k,sk,nhit,nsel );
+
+    } else if (sType==STYPE_ATOM)  {
 
       for (i=0;i<nat;i++)
         if (A[i])  {
@@ -2349,11 +2764,11 @@ namespace mmdb  {
   PChain   chain;
   PModel   mdl;
   realtype dx,dy,dz, c,dc,c1,c2, a2,b2, r2;
-  int      i,k, nat,nsel, im,ic,ir;
+  int      i,k, nat,nsel,nhit, im,ic,ir;
   bool     resSel,chainSel,modelSel,selAND;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections) || (r<=0.0))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections) || (r<=0.0))  return;
 
     dx = x1-x2;
     dy = y1-y2;
@@ -2402,7 +2817,13 @@ namespace mmdb  {
 
     if ((nat<=0) || (!A))  return;
 
-    if (sType==STYPE_ATOM)  {
+    if ((A==atom) && areSelBricks())  {
+
+      nhit = selBricks->GetCylinderAtoms ( x1,y1,z1, x2,y2,z2, r,
+                                           selHit,nSelHitAlloc );
+      SelectHits ( sType,k,sk,nhit,nsel );
+
+    } else if (sType==STYPE_ATOM)  {
 
       for (i=0;i<nat;i++)
         if (A[i])  {
@@ -2513,11 +2934,11 @@ namespace mmdb  {
   PChain   chain;
   PModel   mdl;
   realtype v,h;
-  int      i,k, nat,nsel, im,ic,ir;
+  int      i,k, nat,nsel,nhit, im,ic,ir;
   bool     resSel,chainSel,modelSel,selAND;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections) || (r<=0.0))  return;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections) || (r<=0.0))  return;
 
     v   = sqrt(a*a + b*b + c*c);
     if (v<=0.0)  return;
@@ -2560,7 +2981,12 @@ namespace mmdb  {
 
     if ((nat<=0) || (!A))  return;
 
-    if (sType==STYPE_ATOM)  {
+    if ((A==atom) && areSelBricks())  {
+
+      nhit = selBricks->GetSlabAtoms ( a,b,c,d,r, selHit,nSelHitAlloc );
+      SelectHits ( sType,k,sk,nhit,nsel );
+
+    } else if (sType==STYPE_ATOM)  {
 
       for (i=0;i<nat;i++)
         if (A[i])  {
@@ -2592,7 +3018,7 @@ namespace mmdb  {
                     if (atm) {
                       if ((!atm->Ter) &&
                           (atm->WhatIsSet & ASET_Coordinates))  {
-                        h = fabs(d-a*A[i]->x-b*A[i]->y-c*A[i]->z)/v;
+                        h = fabs(d-a*atm->x-b*atm->y-c*atm->z)/v;
                         if (h<=r)  {
                           SelectObject ( sType,atm,k,sk,nsel );
                           resSel   = true;
@@ -2642,12 +3068,12 @@ namespace mmdb  {
   PChain   chain;
   PModel   mdl;
   realtype x,y,z, dx,dy,dz, dst, d12,d22;
-  int      i,j,k, dn, nx,ny,nz, nat,nsel, im,ic,ir;
+  int      i,j,k,n, dn, nx,ny,nz, nat,nsel,nhit,n0, im,ic,ir;
   int      ix1,ix2,ix, iy1,iy2,iy, iz1,iz2,iz;
   bool     ASel,resSel,chainSel,modelSel,selAND;
   SELECTION_KEY sk;
 
-    if ((selHnd<=0) || (selHnd>nSelections) ||
+    if (frozen || (selHnd<=0) || (selHnd>nSelections) ||
         (d2<=0.0)   || (d2<d1))  return;
 
     k   = selHnd-1;
@@ -2700,6 +3126,33 @@ namespace mmdb  {
 
     if ((nat<=0) || (!A))  return;
 
+    if ((A==atom) && areSelBricks())  {
+      //  look up the neighbours of each seed atom in the structure's
+      //  grid rather than checking all atoms against bricked seeds
+      nhit = 0;
+      for (j=0;j<alen;j++)
+        if (sA[j])  {
+          if ((!sA[j]->Ter) && (sA[j]->WhatIsSet & ASET_Coordinates))  {
+            n0   = nhit;
+            nhit = selBricks->GetShellAtoms ( sA[j]->x,sA[j]->y,sA[j]->z,
+                                          d1,d2,selHit,nSelHitAlloc,n0 );
+            //  leave only atoms not yet hit, excluding the seed itself
+            n = n0;
+            for (i=n0;i<nhit;i++)
+              if ((!selHitFlag[selHit[i]]) && (atom[selHit[i]]!=sA[j]))  {
+                selHitFlag[selHit[i]] = 1;
+                selHit[n++] = selHit[i];
+              }
+            nhit = n;
+          }
+        }
+      for (i=0;i<nhit;i++)
+        selHitFlag[selHit[i]] = 0;
+      SelectHits ( sType,k,sk,nhit,nsel );
+      MakeSelIndex ( selHnd,sType,nsel );
+      return;
+    }
+
     MakeBricks ( sA,alen,d2*1.5 );
     dn = mround(d2/brick_size)+1;
 
@@ -2950,7 +3403,7 @@ namespace mmdb  {
   int           seqNum1,seqNum2,rc;
   SELECTION_KEY selKey1;
 
-    if ((selHnd<=0) || (selHnd>nSelections))  return 1;
+    if (frozen || (selHnd<=0) || (selHnd>nSelections))  return 1;
 
     // leave only required residues
 
@@ -3196,6 +3649,43 @@ namespace mmdb  {
   }
 
 
+  void SelManager::SelectHits ( SELECTION_TYPE sType, int maskNo,
+                                SELECTION_KEY  sKey,  int nHits,
+                                int & nsel )  {
+  //   Selects objects of atoms atom[selHit[0..nHits-1]]; the indices
+  // must be unique. They are processed in ascending order, which
+  // follows the coordinate hierarchy, so that a residue, chain or
+  // model is selected only once however many of its atoms were hit.
+  PMask object,object0;
+  PAtom atm;
+  int   i;
+
+    if (nHits<=0)  return;
+
+    if (sType!=STYPE_ATOM)
+      SortArray ( selHit,nHits );
+
+    object0 = NULL;
+    for (i=0;i<nHits;i++)  {
+      atm = atom[selHit[i]];
+      if (atm)  {
+        switch (sType)  {
+          default              :
+          case STYPE_ATOM      : object = atm;                break;
+          case STYPE_RESIDUE   : object = atm->GetResidue();  break;
+          case STYPE_CHAIN     : object = atm->GetChain  ();  break;
+          case STYPE_MODEL     : object = atm->GetModel  ();  break;
+        }
+        if (object && (object!=object0))  {
+          SelectObject ( object,maskNo,sKey,nsel );
+          object0 = object;
+        }
+      }
+    }
+
+  }
+
+
   void  SelManager::DeleteSelObjects ( int selHnd )  {
   PPModel   model;
   PPChain   chain;
@@ -3203,7 +3693,7 @@ namespace mmdb  {
   PPAtom    atom;
   int        i,k,nSel;
 
-    if ((selHnd>0) && (selHnd<=nSelections))  {
+    if ((!frozen) && (selHnd>0) && (selHnd<=nSelections))  {
 
       k    = selHnd-1;
       nSel = nSelItems[k];
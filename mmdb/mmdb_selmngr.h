@@ -30,8 +30,9 @@
 //       ~~~~~~~~~
 //       Project :  MacroMolecular Data Base (MMDB)
 //       ~~~~~~~~~
-//  **** Classes :  mmdb::Manager ( MMDB atom selection manager )
-//       ~~~~~~~~~
+//  **** Classes :  mmdb::SelNames       ( compiled name list         )
+//       ~~~~~~~~~  mmdb::SelectionQuery ( compiled coordinate ID     )
+//                  mmdb::SelManager     ( MMDB atom selection manager )
 //
 //   (C) E. Krissinel 2000-2013
 //
@@ -125,6 +126,115 @@ namespace mmdb  {
     UDSCR_NoSubstr1 = 28
   };
 
+  // ======================  SelectionQuery  =========================
+
+  //    SelNames is a compiled list of names such as "CA,CB" or
+  //  "!HOH,WAT", as used in selection functions: the list is split
+  //  into items once, and Match(..) compares a space-stripped name
+  //  with the items. An empty or "*" list matches any name.
+  //    Lists of names of up to 4 characters without [..]-quoted
+  //  items, which cover chain IDs, residue, atom and element names
+  //  and alternative locations in practice, are also interned as
+  //  integer keys (see NameKey(..)). Match(..) then makes the key of
+  //  the name once and compares it with the item keys.
+
+  DefineClass(SelNames);
+
+  class SelNames  {
+
+    public :
+
+      SelNames ();
+      ~SelNames();
+
+      void  FreeMemory();
+      void  Make  ( cpstr S );
+      bool  Match ( cpstr N );
+      bool  isAny ()  { return any; }
+
+      //   NameKey(..) packs the non-space characters of name N into
+      // key and returns true, or returns false if there are more
+      // than 4 of them. Names equal with spaces removed have equal
+      // keys.
+      static bool NameKey ( cpstr N, word & key );
+
+    protected :
+      psvector item;     // list items
+      wvector  key;      // [0..nItems-1] keys of items if keyed
+      int      nItems;   // number of items
+      bool     any;      // true if any name matches
+      bool     negate;   // true for '!'-lists
+      bool     bracket;  // true if there are [..]-quoted items
+      bool     keyed;    // true if all items have keys
+
+      void  InitSelNames();
+
+  };
+
+
+  //    SelectionQuery is a coordinate ID (CID, see
+  //  SelManager::Select(..)) compiled for repeated use. The query
+  //  does not refer to any particular structure and may be applied
+  //  to any number of Managers with SelManager::Select(..) taking
+  //  RSelectionQuery as an argument. This saves parsing the CID and
+  //  making the name lists on each selection.
+
+  DefineClass(SelectionQuery);
+
+  class SelectionQuery  {
+
+    friend class SelManager;
+
+    public :
+
+      SelectionQuery ();
+      SelectionQuery ( cpstr CID );
+      ~SelectionQuery();
+
+      void  FreeMemory();
+
+      //   Compile(..) parses the coordinate ID; it returns the same
+      // codes as ParseSelectionPath(..), and the query selects
+      // nothing if the return is not 0. "-all" stands for all atoms
+      // in main conformation, as in SelManager::Select(..).
+      int   Compile ( cpstr CID );
+
+      //   Set(..) makes the query from separate selection fields, in
+      // the same way as SelManager::Select(..) taking them as
+      // arguments.
+      void  Set ( int   iModel,
+                  cpstr Chains,
+                  int   ResNo1, cpstr Ins1,
+                  int   ResNo2, cpstr Ins2,
+                  cpstr RNames,
+                  cpstr ANames,
+                  cpstr Elements,
+                  cpstr altLocs );
+
+      int   GetRC  ()  { return RC;  }
+      cpstr GetCID ()  { return CID; }
+
+    protected :
+      pstr     CID;        // source coordinate ID or NULL
+      int      RC;         // compilation return code
+      int      model;      // model number, 0 for any model
+      int      seqNum1;    // starting residue sequence number
+      int      seqNum2;    // ending residue sequence number
+      InsCode  insCode1;   // starting residue insertion code
+      InsCode  insCode2;   // ending residue insertion code
+      bool     noRes;      // no residue range restrictions
+      bool     hetOnly;    // only HETATMs are taken
+      SelNames chains;     // chain IDs
+      SelNames resNames;   // residue names
+      SelNames atomNames;  // atom names
+      SelNames elements;   // chemical elements
+      SelNames altLocs;    // alternative locations
+
+      void  InitSelectionQuery();
+
+  };
+
+
   DefineClass(SelManager);
   DefineStreamFunctions(SelManager);
 
@@ -334,6 +444,25 @@ namespace mmdb  {
              );
 
 
+      //  ---------------  Bricking for selections  -----------------
+
+      //   MakeSelBricks(..) puts all atoms of the structure into a
+      // persistent brick grid. While the grid is present and the
+      // structure is not edited, SelectSphere(), SelectCylinder(),
+      // SelectSlab() and SelectNeighbours() with keys SKEY_NEW, SKEY_OR
+      // and SKEY_XOR visit only atoms from bricks overlapping with the
+      // selection region rather than all atoms in the structure. This
+      // pays off when many such selections are made on the same
+      // structure. The grid is removed when the manager moves atoms
+      // itself (ApplyTransform(), BringToUnitCell() etc.) and when
+      // FinishStructEdit() rebuilds the atom index after atoms are
+      // added or deleted. Otherwise it is not updated: callers that
+      // edit atom coordinates directly must call MakeSelBricks(..)
+      // again, or remove the grid with RemoveSelBricks().
+      void  MakeSelBricks   ( realtype BrickSize=6.0 );
+      void  RemoveSelBricks ();
+      bool  areSelBricks    ();
+
       //  Selecting a sphere
       void  SelectSphere (
                int  selHnd, // must be obtained from NewSelection()
@@ -556,6 +685,14 @@ namespace mmdb  {
       //  numerical format for sequence number is wrong, and 0
       //  otherwise.
 
+      //   Select(..) with CID keeps a few recently used CIDs in
+      // compiled form, so that repeated selections with the same
+      // CID are not parsed again. The cache is shared, therefore the
+      // function does nothing and returns 0 if the manager is frozen
+      // or selHnd is not a valid selection handle. Note that the CID
+      // is not parsed then, so that a malformed CID is not reported
+      // either; use SelectionQuery::Compile(..) to validate a CID
+      // on its own.
       int   Select (
                int   selHnd,    // must be obtained from NewSelection()
                SELECTION_TYPE sType, // selection type STYPE_XXXXX
@@ -563,6 +700,54 @@ namespace mmdb  {
                SELECTION_KEY  sKey   // selection key
              );
 
+      //   Same as above for a precompiled query; returns the query's
+      // compilation code.
+      int   Select (
+               int   selHnd,    // must be obtained from NewSelection()
+               SELECTION_TYPE sType, // selection type STYPE_XXXXX
+               RSelectionQuery query, // compiled coordinate ID
+               SELECTION_KEY  sKey   // selection key
+             );
+
+
+      // ================  Read-only (frozen) queries  ================
+
+      //    Freeze(true) puts the manager into read-only mode, in which
+      // it may be shared between threads. NewSelection() then returns
+      // 0, and all functions that make, change or delete selections
+      // (Select..(), Unselect..(), MakeSelIndex(), DeleteSelection()
+      // etc.), as well as MakeSelBricks(), do nothing, so that atom
+      // masks, selection arrays and the selection grid are not
+      // changed; selections made before freezing may still be read
+      // with GetSelIndex(..). New selections should be made with the
+      // functions below, which return results owned by the caller
+      // and do not touch the structure. Contact searches with
+      // ContactCSR, distance matrices and Root::GetAtomStatistics(..)
+      // are read-only too.
+      //    Freezing does not cover CoorManager functions that keep
+      // their brick grids in the manager: SeekContacts(..) returning
+      // PContact vectors, MakeBricks(..), MakeMBricks(..) and the
+      // functions using them must not be called while other threads
+      // use the manager. The structure must not be edited while the
+      // manager is frozen.
+      void  Freeze   ( bool on=true )  { frozen = on;   }
+      bool  isFrozen ()                { return frozen; }
+
+      //    SelectAtoms(..) and SelectResidues(..) return atoms and
+      // residues matching the query, in the order of the coordinate
+      // hierarchy, in vectors A and R. The vectors are allocated by
+      // the functions and should be disposed by the application as
+      // 'delete[] A'; they are NULL if nothing is found. Return the
+      // query's compilation code.
+      int   SelectAtoms    ( RSelectionQuery query,
+                             PPAtom    & A, int & nA );
+      int   SelectResidues ( RSelectionQuery query,
+                             PPResidue & R, int & nR );
+
+      //    GetAtomStatistics(..) calculates statistics of atoms
+      // matching the query, returning the query's compilation code.
+      int   GetAtomStatistics ( RSelectionQuery query, RAtomStat AS );
+
       //  Propagating the selection up and down coordinate hierarchy
       void  Select (
                int  selHnd1,  // must be obtained from NewSelection()
@@ -597,6 +782,10 @@ namespace mmdb  {
 
       void  DeleteSelObjects ( int selHnd );
 
+      //   CoordinatesMoved() removes the selection brick grid, see
+      // CoorManager::CoordinatesMoved().
+      void  CoordinatesMoved();
+
 
     protected :
 
@@ -607,6 +796,17 @@ namespace mmdb  {
       ivector   nSelItems;     // numbers of selected items
       PPMask *  selection;     // vector of selected items
 
+      PBrickGrid selBricks;    // brick grid for region selections
+      ivector    selHit;       // work vector for region selections
+      int        nSelHitAlloc; // allocated length of selHit
+      bvector    selHitFlag;   // [0..nAtoms-1] marks of hit atoms
+
+      PPSelectionQuery selQuery; // cache of compiled CIDs
+      int        nSelQueries;  // number of cached CIDs
+      int        selQueryPos;  // next cache position to replace
+      SelectionQuery fieldQuery; // reused by field-based Select(..)
+      bool       frozen;       // read-only mode flag
+
       //  ---------------  Stream I/O  -----------------------------
       void  write ( io::RFile f );
       void  read  ( io::RFile f );
@@ -621,8 +821,15 @@ namespace mmdb  {
                             SELECTION_KEY sKey, int & nsel );
       void  MakeSelIndex  ( int selHnd,  SELECTION_TYPE sType,
                             int nsel );
+      void  SelectHits    ( SELECTION_TYPE sType, int maskNo,
+                            SELECTION_KEY sKey, int nHits, int & nsel );
 
       void  ResetManager();
+      void  StructureEdited ();
+      void  FreeSelQueries();
+      int   CollectQuery  ( RSelectionQuery query,
+                            SELECTION_TYPE sType,
+                            PPAtom A, PPResidue R );
 
       PMask GetSelMask ( int selHnd );
 
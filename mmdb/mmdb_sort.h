@@ -0,0 +1,272 @@
+//  $Id: mmdb_sort.h $
+//  =================================================================
+//
+//   CCP4 Coordinate Library: support of coordinate-related
+//   functionality in protein crystallography applications.
+//
+//   Copyright (C) The MMDB contributors 2026.
+//
+//    This library is free software: you can redistribute it and/or
+//    modify it under the terms of the GNU Lesser General Public
+//    License version 3, modified in accordance with the provisions
+//    of the license to address the requirements of UK law.
+//
+//    You should have received a copy of the modified GNU Lesser
+//    General Public License along with this library. If not, copies
+//    may be downloaded from http://www.ccp4.ac.uk/ccp4license.php
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//  =================================================================
+//
+//    18.10.26   <--  Date of Last Modification.
+//                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  -----------------------------------------------------------------
+//
+//  **** Module  :  MMDB_Sort  <interface>
+//       ~~~~~~~~~
+//  **** Project :  MMDB  ( MacroMolecular Data Base )
+//       ~~~~~~~~~
+//  **** Functions:  mmdb::SortArray  ( introspective sort      )
+//       ~~~~~~~~~~  mmdb::RadixSort  ( stable sort by 32-bit key )
+//
+//  (C) The MMDB contributors 2026
+//
+//  =================================================================
+//
+//
+//   Sorting templates, which are fully expanded by the compiler so
+// that comparisons are inlined. They replace virtual QuickSort
+// (mmdb_utils.h), which is kept for compatibility.
+//
+//   SortArray(a,n,less) sorts a[0..n-1] in ascending order, defined
+// by comparison functor less(x,y), which must return true if x goes
+// before y and must be a strict weak ordering. The sort is not
+// stable; it is quicksort with median-of-three pivots, which falls
+// back to heapsort when recursion gets too deep, so that the time
+// is O(n*log(n)) in all cases. Without less, operator< is used.
+//
+//   RadixSort(a,n,key) sorts a[0..n-1] in order of increasing
+// unsigned 32-bit keys, key(x) returning word. The sort is stable
+// and takes 4 linear passes at most. Overloads for ivector, wvector
+// and vectors of floats sort numbers directly. If work buffer buf
+// is not given, a temporary one of n elements is allocated.
+//
+
+#ifndef __MMDB_Sort__
+#define __MMDB_Sort__
+
+#include <string.h>
+
+#include "mmdb_mattype.h"
+
+namespace mmdb  {
+
+  //  ======================  SortArray  ==========================
+
+  template <class T>
+  struct SortLess  {
+    inline bool operator() ( const T & x, const T & y ) const
+      { return x<y; }
+  };
+
+  template <class T, class Less>
+  void InsertionSort ( T * a, int left, int right, Less & less )  {
+  T   x;
+  int i,j;
+    for (i=left+1;i<=right;i++)  {
+      x = a[i];
+      for (j=i;(j>left) && less(x,a[j-1]);j--)
+        a[j] = a[j-1];
+      a[j] = x;
+    }
+  }
+
+  template <class T, class Less>
+  void SiftDown ( T * h, int i, int n, Less & less )  {
+  T   x;
+  int j;
+    x = h[i];
+    while ((j=2*i+1)<n)  {
+      if ((j+1<n) && less(h[j],h[j+1]))  j++;
+      if (!less(x,h[j]))  break;
+      h[i] = h[j];
+      i    = j;
+    }
+    h[i] = x;
+  }
+
+  template <class T, class Less>
+  void HeapSort ( T * a, int left, int right, Less & less )  {
+  T   x;
+  T * h;
+  int k,n;
+    h = a + left;
+    n = right-left+1;
+    for (k=n/2-1;k>=0;k--)
+      SiftDown ( h,k,n,less );
+    for (k=n-1;k>0;k--)  {
+      x = h[0];  h[0] = h[k];  h[k] = x;
+      SiftDown ( h,0,k,less );
+    }
+  }
+
+  template <class T, class Less>
+  void IntroSort ( T * a, int left, int right, int depth,
+                   Less & less )  {
+  T   pivot,x;
+  int i,j,mid;
+
+    while (right-left>16)  {
+
+      if (depth<=0)  {
+        HeapSort ( a,left,right,less );
+        return;
+      }
+      depth--;
+
+      //  median of three, which also serve as sentinels
+      mid = left + (right-left)/2;
+      if (less(a[mid],a[left]))  {
+        x = a[mid];  a[mid] = a[left];  a[left] = x;
+      }
+      if (less(a[right],a[mid]))  {
+        x = a[mid];  a[mid] = a[right];  a[right] = x;
+        if (less(a[mid],a[left]))  {
+          x = a[mid];  a[mid] = a[left];  a[left] = x;
+        }
+      }
+      pivot = a[mid];
+
+      i = left;
+      j = right;
+      while (i<=j)  {
+        while (less(a[i],pivot))  i++;
+        while (less(pivot,a[j]))  j--;
+        if (i<=j)  {
+          x = a[i];  a[i] = a[j];  a[j] = x;
+          i++;
+          j--;
+        }
+      }
+
+      //  recursion goes into the smaller part
+      if (j-left<right-i)  {
+        IntroSort ( a,left,j,depth,less );
+        left = i;
+      } else  {
+        IntroSort ( a,i,right,depth,less );
+        right = j;
+      }
+
+    }
+
+    InsertionSort ( a,left,right,less );
+
+  }
+
+  template <class T, class Less>
+  void SortArray ( T * a, int n, Less less )  {
+  int depth,k;
+    if ((!a) || (n<2))  return;
+    depth = 0;
+    for (k=n;k>1;k>>=1)
+      depth += 2;
+    IntroSort ( a,0,n-1,depth,less );
+  }
+
+  template <class T>
+  void SortArray ( T * a, int n )  {
+    SortArray ( a,n,SortLess<T>() );
+  }
+
+
+  //  ======================  RadixSort  ==========================
+
+  //   RadixKey(..) map numbers on unsigned keys of the same order
+  inline word RadixKey ( int  I )  { return word(I) ^ 0x80000000; }
+  inline word RadixKey ( word W )  { return W; }
+  inline word RadixKey ( float F ) {
+  word W;
+    memcpy ( &W,&F,sizeof(W) );
+    if (W & 0x80000000)  return ~W;
+    return W | 0x80000000;
+  }
+
+  template <class T>
+  struct RadixNumKey  {
+    inline word operator() ( const T & x ) const
+      { return RadixKey(x); }
+  };
+
+  template <class T, class Key>
+  void RadixSort ( T * a, int n, Key key, T * buf=NULL )  {
+  word  cnt[4][256];
+  T   * src;
+  T   * dst;
+  T   * t;
+  word  k;
+  int   i,b,p,sum,c;
+  bool  own;
+
+    if ((!a) || (n<2))  return;
+
+    for (p=0;p<4;p++)
+      for (b=0;b<256;b++)
+        cnt[p][b] = 0;
+    for (i=0;i<n;i++)  {
+      k = key(a[i]);
+      cnt[0][ k        & 0xFF]++;
+      cnt[1][(k >>  8) & 0xFF]++;
+      cnt[2][(k >> 16) & 0xFF]++;
+      cnt[3][(k >> 24) & 0xFF]++;
+    }
+
+    own = (buf==NULL);
+    if (own)  buf = new T[n];
+
+    src = a;
+    dst = buf;
+    for (p=0;p<4;p++)  {
+      //  passes where all keys have the same byte are skipped
+      k = key(src[0]);
+      if (cnt[p][(k >> (8*p)) & 0xFF]==word(n))  continue;
+      sum = 0;
+      for (b=0;b<256;b++)  {
+        c = cnt[p][b];
+        cnt[p][b] = sum;
+        sum += c;
+      }
+      for (i=0;i<n;i++)
+        dst[cnt[p][(key(src[i]) >> (8*p)) & 0xFF]++] = src[i];
+      t   = src;
+      src = dst;
+      dst = t;
+    }
+
+    if (src!=a)
+      for (i=0;i<n;i++)
+        a[i] = src[i];
+
+    if (own)  delete[] buf;
+
+  }
+
+  inline void RadixSort ( ivector a, int n, ivector buf=NULL )  {
+    RadixSort ( a,n,RadixNumKey<int>(),buf );
+  }
+
+  inline void RadixSort ( wvector a, int n, wvector buf=NULL )  {
+    RadixSort ( a,n,RadixNumKey<word>(),buf );
+  }
+
+  inline void RadixSort ( float * a, int n, float * buf=NULL )  {
+    RadixSort ( a,n,RadixNumKey<float>(),buf );
+  }
+
+}  // namespace mmdb
+
+#endif
@@ -0,0 +1,2577 @@
+//  $Id: mmdb_syminfo.cpp $
+//  =================================================================
+//
+//   CCP4 Coordinate Library: support of coordinate-related
+//   functionality in protein crystallography applications.
+//
+//   Copyright (C) The MMDB contributors 2026.
+//
+//    This library is free software: you can redistribute it and/or
+//    modify it under the terms of the GNU Lesser General Public
+//    License version 3, modified in accordance with the provisions
+//    of the license to address the requirements of UK law.
+//
+//    You should have received a copy of the modified GNU Lesser
+//    General Public License along with this library. If not, copies
+//    may be downloaded from http://www.ccp4.ac.uk/ccp4license.php
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//  =================================================================
+//
+//    18.10.26   <--  Date of Last Modification.
+//                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  -----------------------------------------------------------------
+//
+//  **** Module  :  mmdb_syminfo <implementation>
+//       ~~~~~~~~~
+//       Project :  MacroMolecular Data Base (MMDB)
+//       ~~~~~~~~~
+//  **** Functions :  mmdb::findSymInfoGroup  ( space group lookup  )
+//       ~~~~~~~~~~~  mmdb::getSymInfoTMatrix ( operator matrix     )
+//
+//  **** Constants :  mmdb::SymInfoOps    ( symmetry operators      )
+//       ~~~~~~~~~~~  mmdb::SymInfoOpList ( operators of groups     )
+//                    mmdb::SymInfoGroups ( space group settings    )
+//
+//  (C) The MMDB contributors 2026
+//
+//  =================================================================
+//
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "mmdb_syminfo.h"
+
+namespace mmdb  {
+
+  //  ===============================================================
+  //
+  //   The tables below are made from CCP4's syminfo.lib, one entry
+  // per space group setting, in the order of the file. Operators of
+  // each setting are listed in the same form and order as produced
+  // by SymOps::SetGroup(..) from the file, that is, primitive
+  // operators followed by their products with centering operators.
+  //
+  //  ===============================================================
+
+  SymInfoOp const SymInfoOps[nSymInfoOps] = {
+    { "x,y,z",                     {  1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "-x,-y,-z",                  { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-x,y,-z",                   { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-x,-y,z",                   { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "x,-y,-z",                   {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-x,y+1/2,-z",               { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12, 0 } },
+    { "-x,-y,z+1/2",               { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "x+1/2,-y,-z",               {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12, 0, 0 } },
+    { "X+1/2,Y+1/2,Z",             {  1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "-X+1/2,Y+1/2,-Z",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "X,Y+1/2,Z+1/2",             {  1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "-X,Y+1/2,-Z+1/2",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "X+1/2,Y+1/2,Z+1/2",         {  1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "-X+1/2,Y+1/2,-Z+1/2",       { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "-X,-Y+1/2,Z+1/2",           { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "X+1/2,Y,Z+1/2",             {  1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "-X+1/2,-Y,Z+1/2",           { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "-X+1/2,-Y+1/2,Z+1/2",       { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "X+1/2,-Y,-Z+1/2",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "X+1/2,-Y+1/2,-Z",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "X+1/2,-Y+1/2,-Z+1/2",       {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "x,-y,z",                    {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "x,y,-z",                    {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-x,y,z",                    { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "x,-y,z+1/2",                {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "x+1/2,-y,z+1/2",            {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "x+1/2,-y,z",                {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12, 0, 0 } },
+    { "x+1/2,y,-z",                {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0, 0 } },
+    { "x+1/2,y+1/2,-z",            {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "x,y+1/2,-z",                {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12, 0 } },
+    { "-x,y+1/2,z",                { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  0,12, 0 } },
+    { "-x,y+1/2,z+1/2",            { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "-x,y,z+1/2",                { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "X+1/2,-Y+1/2,Z",            {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "X,-Y+1/2,Z+1/2",            {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "X+1/2,-Y+1/2,Z+1/2",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "X,Y+1/2,-Z+1/2",            {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "X+1/2,Y,-Z+1/2",            {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "X+1/2,Y+1/2,-Z+1/2",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "-X+1/2,Y,Z+1/2",            { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "-X+1/2,Y+1/2,Z",            { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "-X+1/2,Y+1/2,Z+1/2",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "x,-y+1/2,z+1/2",            {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "X+1/2,-Y,Z+1/2",            {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "x,-y+1/2,z",                {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0,12, 0 } },
+    { "x,y,-z+1/2",                {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-x+1/2,y,z",                { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12, 0, 0 } },
+    { "-X+1/2,-Y+1/2,-Z",          { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "-X,-Y+1/2,-Z+1/2",          { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "-X+1/2,-Y+1/2,-Z+1/2",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "-X+1/2,-Y,-Z+1/2",          { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-x,y,-z+1/2",               { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-x+1/2,y,-z+1/2",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-x+1/2,y,-z",               { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0, 0 } },
+    { "-x+1/2,-y,z",               { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12, 0, 0 } },
+    { "-x+1/2,-y+1/2,z",           { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "-x,-y+1/2,z",               { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0,12, 0 } },
+    { "x,-y+1/2,-z",               {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0,12, 0 } },
+    { "x,-y+1/2,-z+1/2",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "x,-y,-z+1/2",               {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-x,y+1/2,-z+1/2",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "-x+1/2,y+1/2,-z+1/2",       { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "x+1/2,-y+1/2,z+1/2",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "-x+1/2,y+1/2,-z",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "x+1/2,-y+1/2,z",            {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "-x+1/2,-y,z+1/2",           { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "x+1/2,y,-z+1/2",            {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-x+1/2,-y+1/2,z+1/2",       { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "x+1/2,y+1/2,-z+1/2",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "-x,-y+1/2,z+1/2",           { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "x,y+1/2,-z+1/2",            {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "x+1/2,-y+1/2,-z",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "-x+1/2,y+1/2,z",            { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "x+1/2,-y+1/2,-z+1/2",       {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "-x+1/2,y+1/2,z+1/2",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "x+1/2,-y,-z+1/2",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-x+1/2,y,z+1/2",            { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "-x+1/2,-y+1/2,-z",          { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "-X,-Y,-Z",                  { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-X+1/2,-Y+1/2,Z",           { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "X,-Y+1/2,-Z+1/2",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "-X+1/2,Y,-Z+1/2",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-X+1/2,Y,-Z",               { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0, 0 } },
+    { "-X,Y+1/2,Z+1/2",            { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "X+1/2,Y+1/2,-Z",            {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "-X,Y,Z+1/2",                { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "X,-Y,Z+1/2",                {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "X+1/2,-Y,Z",                {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12, 0, 0 } },
+    { "X+1/2,Y,-Z",                {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0, 0 } },
+    { "X,Y+1/2,-Z",                {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12, 0 } },
+    { "-X,Y+1/2,Z",                { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  0,12, 0 } },
+    { "-x+1/4,y+1/4,z+1/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  6, 6, 6 } },
+    { "x+3/4,-y+3/4,z+1/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18,18, 6 } },
+    { "-X+1/4,Y+3/4,Z+3/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  6,18,18 } },
+    { "X+3/4,-Y+1/4,Z+3/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18, 6,18 } },
+    { "-X+3/4,Y+1/4,Z+3/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 18, 6,18 } },
+    { "X+1/4,-Y+3/4,Z+3/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6,18,18 } },
+    { "-X+3/4,Y+3/4,Z+1/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 18,18, 6 } },
+    { "X+1/4,-Y+1/4,Z+1/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6, 6, 6 } },
+    { "x+1/4,-y+1/4,z+1/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6, 6, 6 } },
+    { "x+1/4,y+3/4,-z+3/4",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6,18,18 } },
+    { "X+3/4,Y+3/4,-Z+1/4",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18,18, 6 } },
+    { "X+3/4,-Y+3/4,Z+1/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18,18, 6 } },
+    { "X+3/4,Y+1/4,-Z+3/4",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18, 6,18 } },
+    { "X+1/4,Y+1/4,-Z+1/4",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6, 6, 6 } },
+    { "x+1/4,y+1/4,-z+1/4",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6, 6, 6 } },
+    { "-x+3/4,y+1/4,z+3/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 18, 6,18 } },
+    { "X+1/4,Y+3/4,-Z+3/4",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6,18,18 } },
+    { "-X+1/4,Y+1/4,Z+1/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  6, 6, 6 } },
+    { "-x+1/2,-y+1/2,-z+1/2",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "-x,-y+1/2,-z+1/2",          { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "-x+1/2,-y,-z+1/2",          { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-X,-Y+1/2,Z",               { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0,12, 0 } },
+    { "-X,Y+1/2,-Z",               { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12, 0 } },
+    { "X,-Y+1/2,Z",                {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0,12, 0 } },
+    { "-X+1/2,-Y,Z",               { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 12, 0, 0 } },
+    { "X+1/2,-Y,-Z",               {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12, 0, 0 } },
+    { "X,-Y,Z",                    {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "X,-Y,-Z+1/2",               {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-X,-Y,Z+1/2",               { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "X,Y,-Z+1/2",                {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "X,-Y+1/2,-Z",               {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0,12, 0 } },
+    { "-X+1/2,Y,Z",                { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12, 0, 0 } },
+    { "-X,Y,-Z+1/2",               { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-X,-Y,Z",                   { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "X,-Y,-Z",                   {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-X,Y,-Z",                   { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-x+1/4,-y+1/4,-z+1/4",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  6, 6, 6 } },
+    { "x+3/4,y+3/4,-z+1/4",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18,18, 6 } },
+    { "-x+1/4,y+3/4,z+3/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  6,18,18 } },
+    { "x+3/4,-y+1/4,z+3/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18, 6,18 } },
+    { "-X+1/4,-Y+3/4,-Z+3/4",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  6,18,18 } },
+    { "-X+3/4,-Y+1/4,-Z+3/4",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 18, 6,18 } },
+    { "-X+3/4,-Y+3/4,-Z+1/4",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 18,18, 6 } },
+    { "-x+1/4,-y+1/4,z",           { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6, 6, 0 } },
+    { "x,-y+1/4,-z+1/4",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0, 6, 6 } },
+    { "-x+1/4,y,-z+1/4",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6, 0, 6 } },
+    { "x+3/4,y+3/4,-z",            {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18,18, 0 } },
+    { "-x,y+3/4,z+3/4",            { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  0,18,18 } },
+    { "x+3/4,-y,z+3/4",            {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18, 0,18 } },
+    { "-X+1/4,-Y+3/4,Z+1/2",       { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6,18,12 } },
+    { "X,-Y+3/4,-Z+3/4",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0,18,18 } },
+    { "-X+1/4,Y+1/2,-Z+3/4",       { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6,12,18 } },
+    { "X+3/4,Y+1/4,-Z+1/2",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18, 6,12 } },
+    { "-X,Y+1/4,Z+1/4",            { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  0, 6, 6 } },
+    { "X+3/4,-Y+1/2,Z+1/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18,12, 6 } },
+    { "-X+3/4,-Y+1/4,Z+1/2",       { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18, 6,12 } },
+    { "X+1/2,-Y+1/4,-Z+3/4",       {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12, 6,18 } },
+    { "-X+3/4,Y,-Z+3/4",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18, 0,18 } },
+    { "X+1/4,Y+3/4,-Z+1/2",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6,18,12 } },
+    { "-X+1/2,Y+3/4,Z+1/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12,18, 6 } },
+    { "X+1/4,-Y,Z+1/4",            {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6, 0, 6 } },
+    { "-X+3/4,-Y+3/4,Z",           { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18,18, 0 } },
+    { "X+1/2,-Y+3/4,-Z+1/4",       {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12,18, 6 } },
+    { "-X+3/4,Y+1/2,-Z+1/4",       { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18,12, 6 } },
+    { "X+1/4,Y+1/4,-Z",            {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6, 6, 0 } },
+    { "-X+1/2,Y+1/4,Z+3/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 12, 6,18 } },
+    { "X+1/4,-Y+1/2,Z+3/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6,12,18 } },
+    { "-y,x,z",                    {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "y,-x,z",                    {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "-y,x,z+1/4",                {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0, 6 } },
+    { "y,-x,z+3/4",                {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0,18 } },
+    { "-y,x,z+1/2",                {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "y,-x,z+1/2",                {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "-y,x,z+3/4",                {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0,18 } },
+    { "y,-x,z+1/4",                {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0, 6 } },
+    { "-Y+1/2,X+1/2,Z+1/2",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "Y+1/2,-X+1/2,Z+1/2",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "-y,x+1/2,z+1/4",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0,12, 6 } },
+    { "y+1/2,-x,z+3/4",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0,18 } },
+    { "-Y+1/2,X,Z+3/4",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 0,18 } },
+    { "Y,-X+1/2,Z+1/4",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0,12, 6 } },
+    { "y,-x,-z",                   {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-y,x,-z",                   {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "Y+1/2,-X+1/2,-Z+1/2",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "-Y+1/2,X+1/2,-Z+1/2",       {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "y,-x,-z+1/2",               {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-y,x,-z+1/2",               {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-y+1/2,x+1/2,z",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "y+1/2,-x+1/2,z",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "-y+1/2,x,z",                {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 0, 0 } },
+    { "y,-x+1/2,z",                {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0,12, 0 } },
+    { "y+1/2,-x,-z",               {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12, 0, 0 } },
+    { "-y,x+1/2,-z",               {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  0,12, 0 } },
+    { "-y+1/2,x+1/2,z+1/2",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "y+1/2,-x+1/2,z+1/2",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "-y,x+1/2,z+1/2",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "y+1/2,-x,z+1/2",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "y,-x+1/2,-z+1/2",           {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "-y+1/2,x,-z+1/2",           {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-x,-y+1/2,-z+1/4",          { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0,12, 6 } },
+    { "x+1/2,y,-z+3/4",            {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0,18 } },
+    { "-y+1/2,x+1/2,-z+1/2",       {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "-X+1/2,-Y,-Z+3/4",          { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12, 0,18 } },
+    { "X,Y+1/2,-Z+1/4",            {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12, 6 } },
+    { "-Y,X,-Z",                   {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-y+3/4,x+1/4,z+1/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 18, 6, 6 } },
+    { "y+3/4,-x+3/4,z+3/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 18,18,18 } },
+    { "y+1/4,-x+3/4,-z+3/4",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  6,18,18 } },
+    { "-y+1/4,x+1/4,-z+1/4",       {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  6, 6, 6 } },
+    { "-Y+1/4,X+3/4,Z+3/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  6,18,18 } },
+    { "Y+1/4,-X+1/4,Z+1/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  6, 6, 6 } },
+    { "Y+3/4,-X+1/4,-Z+1/4",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 18, 6, 6 } },
+    { "-Y+3/4,X+3/4,-Z+3/4",       {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 18,18,18 } },
+    { "y,x,-z",                    {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-y,-x,-z",                  {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "y,x,-z+3/4",                {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0,18 } },
+    { "-y,-x,-z+1/4",              {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0, 6 } },
+    { "-y+1/2,x+1/2,z+1/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12,12, 6 } },
+    { "y+1/2,-x+1/2,z+3/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 12,12,18 } },
+    { "x+1/2,-y+1/2,-z+3/4",       {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12,12,18 } },
+    { "-x+1/2,y+1/2,-z+1/4",       { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12,12, 6 } },
+    { "-y,-x,-z+1/2",              {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "y,x,-z+1/2",                {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "y,x,-z+1/4",                {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0, 6 } },
+    { "-y,-x,-z+3/4",              {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0,18 } },
+    { "-y+1/2,x+1/2,z+3/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12,12,18 } },
+    { "y+1/2,-x+1/2,z+1/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 12,12, 6 } },
+    { "x+1/2,-y+1/2,-z+1/4",       {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12,12, 6 } },
+    { "-x+1/2,y+1/2,-z+3/4",       { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12,12,18 } },
+    { "Y+1/2,X+1/2,-Z+1/2",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "-Y+1/2,-X+1/2,-Z+1/2",      {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "x,-y+1/2,-z+1/4",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0,12, 6 } },
+    { "y+1/2,x+1/2,-z+1/2",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "-x+1/2,y,-z+3/4",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0,18 } },
+    { "X+1/2,-Y,-Z+3/4",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12, 0,18 } },
+    { "Y,X,-Z",                    {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-X,Y+1/2,-Z+1/4",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12, 6 } },
+    { "-y,-x,z",                   {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "y,x,z",                     {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "-y+1/2,-x+1/2,z",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "y+1/2,x+1/2,z",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "-y,-x,z+1/2",               {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "y,x,z+1/2",                 {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "-y+1/2,-x+1/2,z+1/2",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "y+1/2,x+1/2,z+1/2",         {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "-Y+1/2,-X+1/2,Z+1/2",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "Y+1/2,X+1/2,Z+1/2",         {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 12,12,12 } },
+    { "-Y+1/2,-X+1/2,Z",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "Y+1/2,X+1/2,Z",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "-y,-x+1/2,z+1/4",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  0,12, 6 } },
+    { "y+1/2,x,z+3/4",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 0,18 } },
+    { "-Y+1/2,-X,Z+3/4",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0,18 } },
+    { "Y,X+1/2,Z+1/4",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, {  0,12, 6 } },
+    { "-y,-x+1/2,z+3/4",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  0,12,18 } },
+    { "y+1/2,x,z+1/4",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 0, 6 } },
+    { "-Y+1/2,-X,Z+1/4",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0, 6 } },
+    { "Y,X+1/2,Z+3/4",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, {  0,12,18 } },
+    { "y+1/2,x+1/2,-z",            {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "-y+1/2,-x+1/2,-z",          {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "-y+1/2,-x+1/2,-z+1/2",      {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "Y+1/2,X+1/2,-Z",            {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "-Y+1/2,-X+1/2,-Z",          {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "-y+1/2,-x,z+3/4",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0,18 } },
+    { "-x,y+1/2,-z+1/4",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12, 6 } },
+    { "-Y,-X+1/2,Z+1/4",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  0,12, 6 } },
+    { "-X+1/2,Y,-Z+3/4",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0,18 } },
+    { "y+1/2,-x+1/2,-z",           {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "-y+1/2,x+1/2,-z",           {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "y+1/2,-x+1/2,-z+1/2",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12,12,12 } },
+    { "-y+1/2,x,z+1/2",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "y,-x+1/2,z+1/2",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "y+1/2,-x,-z+1/2",           {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-y,x+1/2,-z+1/2",           {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "y,x+1/2,z+1/4",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, {  0,12, 6 } },
+    { "Y+1/2,X,Z+3/4",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 0,18 } },
+    { "-y+1/4,x+3/4,z+1/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  6,18, 6 } },
+    { "y+1/4,-x+1/4,z+3/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  6, 6,18 } },
+    { "y+1/4,x+3/4,-z+1/4",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  6,18, 6 } },
+    { "-y+1/4,-x+1/4,-z+3/4",      {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  6, 6,18 } },
+    { "y+3/4,-x+1/4,-z+3/4",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 18, 6,18 } },
+    { "-y+3/4,x+3/4,-z+1/4",       {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 18,18, 6 } },
+    { "-y+3/4,-x+1/4,z+3/4",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 18, 6,18 } },
+    { "y+3/4,x+3/4,z+1/4",         {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 18,18, 6 } },
+    { "-Y+3/4,X+1/4,Z+3/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 18, 6,18 } },
+    { "Y+3/4,-X+3/4,Z+1/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 18,18, 6 } },
+    { "Y+3/4,X+1/4,-Z+3/4",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 18, 6,18 } },
+    { "-Y+3/4,-X+3/4,-Z+1/4",      {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, { 18,18, 6 } },
+    { "Y+1/4,-X+3/4,-Z+1/4",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  6,18, 6 } },
+    { "-Y+1/4,X+1/4,-Z+3/4",       {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  6, 6,18 } },
+    { "-Y+1/4,-X+3/4,Z+1/4",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  6,18, 6 } },
+    { "Y+1/4,X+1/4,Z+3/4",         {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, {  6, 6,18 } },
+    { "x,-y+1/2,-z+3/4",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  0,12,18 } },
+    { "-x+1/2,y,-z+1/4",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 12, 0, 6 } },
+    { "-y+1/2,-x,z+1/4",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0, 6 } },
+    { "y,x+1/2,z+3/4",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, {  0,12,18 } },
+    { "X+1/2,-Y,-Z+1/4",           {  1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 12, 0, 6 } },
+    { "Y,X,-Z+1/2",                {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-X,Y+1/2,-Z+3/4",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0,12,18 } },
+    { "-Y,-X+1/2,Z+3/4",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  0,12,18 } },
+    { "Y+1/2,X,Z+1/4",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 0, 6 } },
+    { "y+1/4,x+3/4,-z+3/4",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  6,18,18 } },
+    { "-y+1/4,-x+1/4,-z+1/4",      {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  6, 6, 6 } },
+    { "-y+3/4,-x+1/4,z+1/4",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 18, 6, 6 } },
+    { "y+3/4,x+3/4,z+3/4",         {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 18,18,18 } },
+    { "Y+3/4,X+1/4,-Z+1/4",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 18, 6, 6 } },
+    { "-Y+3/4,-X+3/4,-Z+3/4",      {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, { 18,18,18 } },
+    { "-Y+1/4,-X+3/4,Z+3/4",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  6,18,18 } },
+    { "Y+1/4,X+1/4,Z+1/4",         {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, {  6, 6, 6 } },
+    { "-y,x-y,z",                  {  0,-1, 0, 1,-1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "-x+y,-x,z",                 { -1, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "-y,x-y,z+1/3",              {  0,-1, 0, 1,-1, 0, 0, 0, 1 }, {  0, 0, 8 } },
+    { "-x+y,-x,z+2/3",             { -1, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0,16 } },
+    { "-y,x-y,z+2/3",              {  0,-1, 0, 1,-1, 0, 0, 0, 1 }, {  0, 0,16 } },
+    { "-x+y,-x,z+1/3",             { -1, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0, 8 } },
+    { "X+2/3,Y+1/3,Z+1/3",         {  1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 16, 8, 8 } },
+    { "-Y+2/3,X-Y+1/3,Z+1/3",      {  0,-1, 0, 1,-1, 0, 0, 0, 1 }, { 16, 8, 8 } },
+    { "-X+Y+2/3,-X+1/3,Z+1/3",     { -1, 1, 0,-1, 0, 0, 0, 0, 1 }, { 16, 8, 8 } },
+    { "X+1/3,Y+2/3,Z+2/3",         {  1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  8,16,16 } },
+    { "-Y+1/3,X-Y+2/3,Z+2/3",      {  0,-1, 0, 1,-1, 0, 0, 0, 1 }, {  8,16,16 } },
+    { "-X+Y+1/3,-X+2/3,Z+2/3",     { -1, 1, 0,-1, 0, 0, 0, 0, 1 }, {  8,16,16 } },
+    { "z,x,y",                     {  0, 0, 1, 1, 0, 0, 0, 1, 0 }, {  0, 0, 0 } },
+    { "y,z,x",                     {  0, 1, 0, 0, 0, 1, 1, 0, 0 }, {  0, 0, 0 } },
+    { "y,-x+y,-z",                 {  0, 1, 0,-1, 1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "x-y,x,-z",                  {  1,-1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-X+2/3,-Y+1/3,-Z+1/3",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 16, 8, 8 } },
+    { "Y+2/3,-X+Y+1/3,-Z+1/3",     {  0, 1, 0,-1, 1, 0, 0, 0,-1 }, { 16, 8, 8 } },
+    { "X-Y+2/3,X+1/3,-Z+1/3",      {  1,-1, 0, 1, 0, 0, 0, 0,-1 }, { 16, 8, 8 } },
+    { "-X+1/3,-Y+2/3,-Z+2/3",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  8,16,16 } },
+    { "Y+1/3,-X+Y+2/3,-Z+2/3",     {  0, 1, 0,-1, 1, 0, 0, 0,-1 }, {  8,16,16 } },
+    { "X-Y+1/3,X+2/3,-Z+2/3",      {  1,-1, 0, 1, 0, 0, 0, 0,-1 }, {  8,16,16 } },
+    { "-z,-x,-y",                  {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, {  0, 0, 0 } },
+    { "-y,-z,-x",                  {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, {  0, 0, 0 } },
+    { "x,x-y,-z",                  {  1, 0, 0, 1,-1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-x+y,y,-z",                 { -1, 1, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-x,-x+y,-z",                { -1, 0, 0,-1, 1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "x-y,-y,-z",                 {  1,-1, 0, 0,-1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-y,-x,-z+2/3",              {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0,16 } },
+    { "-x+y,y,-z+1/3",             { -1, 1, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0, 8 } },
+    { "-x,-x+y,-z+1/3",            { -1, 0, 0,-1, 1, 0, 0, 0,-1 }, {  0, 0, 8 } },
+    { "x-y,-y,-z+2/3",             {  1,-1, 0, 0,-1, 0, 0, 0,-1 }, {  0, 0,16 } },
+    { "-y,-x,-z+1/3",              {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0, 8 } },
+    { "-x+y,y,-z+2/3",             { -1, 1, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0,16 } },
+    { "-x,-x+y,-z+2/3",            { -1, 0, 0,-1, 1, 0, 0, 0,-1 }, {  0, 0,16 } },
+    { "x-y,-y,-z+1/3",             {  1,-1, 0, 0,-1, 0, 0, 0,-1 }, {  0, 0, 8 } },
+    { "Y+2/3,X+1/3,-Z+1/3",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 16, 8, 8 } },
+    { "-X+2/3,-X+Y+1/3,-Z+1/3",    { -1, 0, 0,-1, 1, 0, 0, 0,-1 }, { 16, 8, 8 } },
+    { "X-Y+2/3,-Y+1/3,-Z+1/3",     {  1,-1, 0, 0,-1, 0, 0, 0,-1 }, { 16, 8, 8 } },
+    { "Y+1/3,X+2/3,-Z+2/3",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  8,16,16 } },
+    { "-X+1/3,-X+Y+2/3,-Z+2/3",    { -1, 0, 0,-1, 1, 0, 0, 0,-1 }, {  8,16,16 } },
+    { "X-Y+1/3,-Y+2/3,-Z+2/3",     {  1,-1, 0, 0,-1, 0, 0, 0,-1 }, {  8,16,16 } },
+    { "-z,-y,-x",                  {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, {  0, 0, 0 } },
+    { "-x,-z,-y",                  { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0, 0, 0 } },
+    { "x,x-y,z",                   {  1, 0, 0, 1,-1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "-x+y,y,z",                  { -1, 1, 0, 0, 1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "-x,-x+y,z",                 { -1, 0, 0,-1, 1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "x-y,-y,z",                  {  1,-1, 0, 0,-1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "x,x-y,z+1/2",               {  1, 0, 0, 1,-1, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "-x+y,y,z+1/2",              { -1, 1, 0, 0, 1, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "-x,-x+y,z+1/2",             { -1, 0, 0,-1, 1, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "x-y,-y,z+1/2",              {  1,-1, 0, 0,-1, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "-Y+2/3,-X+1/3,Z+1/3",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 16, 8, 8 } },
+    { "X+2/3,X-Y+1/3,Z+1/3",       {  1, 0, 0, 1,-1, 0, 0, 0, 1 }, { 16, 8, 8 } },
+    { "-X+Y+2/3,Y+1/3,Z+1/3",      { -1, 1, 0, 0, 1, 0, 0, 0, 1 }, { 16, 8, 8 } },
+    { "-Y+1/3,-X+2/3,Z+2/3",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  8,16,16 } },
+    { "X+1/3,X-Y+2/3,Z+2/3",       {  1, 0, 0, 1,-1, 0, 0, 0, 1 }, {  8,16,16 } },
+    { "-X+Y+1/3,Y+2/3,Z+2/3",      { -1, 1, 0, 0, 1, 0, 0, 0, 1 }, {  8,16,16 } },
+    { "z,y,x",                     {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, {  0, 0, 0 } },
+    { "x,z,y",                     {  1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0, 0, 0 } },
+    { "-Y+2/3,-X+1/3,Z+5/6",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 16, 8,20 } },
+    { "X+2/3,X-Y+1/3,Z+5/6",       {  1, 0, 0, 1,-1, 0, 0, 0, 1 }, { 16, 8,20 } },
+    { "-X+Y+2/3,Y+1/3,Z+5/6",      { -1, 1, 0, 0, 1, 0, 0, 0, 1 }, { 16, 8,20 } },
+    { "-Y+1/3,-X+2/3,Z+1/6",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  8,16, 4 } },
+    { "X+1/3,X-Y+2/3,Z+1/6",       {  1, 0, 0, 1,-1, 0, 0, 0, 1 }, {  8,16, 4 } },
+    { "-X+Y+1/3,Y+2/3,Z+1/6",      { -1, 1, 0, 0, 1, 0, 0, 0, 1 }, {  8,16, 4 } },
+    { "z+1/2,y+1/2,x+1/2",         {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, { 12,12,12 } },
+    { "x+1/2,z+1/2,y+1/2",         {  1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12,12,12 } },
+    { "x,x-y,-z+1/2",              {  1, 0, 0, 1,-1, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-x+y,y,-z+1/2",             { -1, 1, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-x,-x+y,-z+1/2",            { -1, 0, 0,-1, 1, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "x-y,-y,-z+1/2",             {  1,-1, 0, 0,-1, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "Y+2/3,X+1/3,-Z+5/6",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 16, 8,20 } },
+    { "-X+2/3,-X+Y+1/3,-Z+5/6",    { -1, 0, 0,-1, 1, 0, 0, 0,-1 }, { 16, 8,20 } },
+    { "X-Y+2/3,-Y+1/3,-Z+5/6",     {  1,-1, 0, 0,-1, 0, 0, 0,-1 }, { 16, 8,20 } },
+    { "Y+1/3,X+2/3,-Z+1/6",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  8,16, 4 } },
+    { "-X+1/3,-X+Y+2/3,-Z+1/6",    { -1, 0, 0,-1, 1, 0, 0, 0,-1 }, {  8,16, 4 } },
+    { "X-Y+1/3,-Y+2/3,-Z+1/6",     {  1,-1, 0, 0,-1, 0, 0, 0,-1 }, {  8,16, 4 } },
+    { "-z+1/2,-y+1/2,-x+1/2",      {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, { 12,12,12 } },
+    { "-x+1/2,-z+1/2,-y+1/2",      { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12,12,12 } },
+    { "x-y,x,z",                   {  1,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "y,-x+y,z",                  {  0, 1, 0,-1, 1, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "x-y,x,z+1/6",               {  1,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0, 4 } },
+    { "y,-x+y,z+5/6",              {  0, 1, 0,-1, 1, 0, 0, 0, 1 }, {  0, 0,20 } },
+    { "x-y,x,z+5/6",               {  1,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0,20 } },
+    { "y,-x+y,z+1/6",              {  0, 1, 0,-1, 1, 0, 0, 0, 1 }, {  0, 0, 4 } },
+    { "x-y,x,z+1/3",               {  1,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0, 8 } },
+    { "y,-x+y,z+2/3",              {  0, 1, 0,-1, 1, 0, 0, 0, 1 }, {  0, 0,16 } },
+    { "x-y,x,z+2/3",               {  1,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0,16 } },
+    { "y,-x+y,z+1/3",              {  0, 1, 0,-1, 1, 0, 0, 0, 1 }, {  0, 0, 8 } },
+    { "x-y,x,z+1/2",               {  1,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "y,-x+y,z+1/2",              {  0, 1, 0,-1, 1, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "-x+y,-x,-z",                { -1, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-y,x-y,-z",                 {  0,-1, 0, 1,-1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "-x+y,-x,-z+1/2",            { -1, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-y,x-y,-z+1/2",             {  0,-1, 0, 1,-1, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-y,-x,-z+5/6",              {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0,20 } },
+    { "x,x-y,-z+1/6",              {  1, 0, 0, 1,-1, 0, 0, 0,-1 }, {  0, 0, 4 } },
+    { "y,x,-z+1/3",                {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0, 8 } },
+    { "-y,-x,-z+1/6",              {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0, 4 } },
+    { "x,x-y,-z+5/6",              {  1, 0, 0, 1,-1, 0, 0, 0,-1 }, {  0, 0,20 } },
+    { "y,x,-z+2/3",                {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0,16 } },
+    { "x,x-y,-z+1/3",              {  1, 0, 0, 1,-1, 0, 0, 0,-1 }, {  0, 0, 8 } },
+    { "x,x-y,-z+2/3",              {  1, 0, 0, 1,-1, 0, 0, 0,-1 }, {  0, 0,16 } },
+    { "-z,-x,y",                   {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, {  0, 0, 0 } },
+    { "z,-x,-y",                   {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, {  0, 0, 0 } },
+    { "-z,x,-y",                   {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, {  0, 0, 0 } },
+    { "y,-z,-x",                   {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, {  0, 0, 0 } },
+    { "-y,z,-x",                   {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, {  0, 0, 0 } },
+    { "-y,-z,x",                   {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, {  0, 0, 0 } },
+    { "Z,X+1/2,Y+1/2",             {  0, 0, 1, 1, 0, 0, 0, 1, 0 }, {  0,12,12 } },
+    { "-Z,-X+1/2,Y+1/2",           {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, {  0,12,12 } },
+    { "Z,-X+1/2,-Y+1/2",           {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, {  0,12,12 } },
+    { "-Z,X+1/2,-Y+1/2",           {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, {  0,12,12 } },
+    { "Y,Z+1/2,X+1/2",             {  0, 1, 0, 0, 0, 1, 1, 0, 0 }, {  0,12,12 } },
+    { "Y,-Z+1/2,-X+1/2",           {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, {  0,12,12 } },
+    { "-Y,Z+1/2,-X+1/2",           {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, {  0,12,12 } },
+    { "-Y,-Z+1/2,X+1/2",           {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, {  0,12,12 } },
+    { "Z+1/2,X,Y+1/2",             {  0, 0, 1, 1, 0, 0, 0, 1, 0 }, { 12, 0,12 } },
+    { "-Z+1/2,-X,Y+1/2",           {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, { 12, 0,12 } },
+    { "Z+1/2,-X,-Y+1/2",           {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, { 12, 0,12 } },
+    { "-Z+1/2,X,-Y+1/2",           {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, { 12, 0,12 } },
+    { "Y+1/2,Z,X+1/2",             {  0, 1, 0, 0, 0, 1, 1, 0, 0 }, { 12, 0,12 } },
+    { "Y+1/2,-Z,-X+1/2",           {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, { 12, 0,12 } },
+    { "-Y+1/2,Z,-X+1/2",           {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, { 12, 0,12 } },
+    { "-Y+1/2,-Z,X+1/2",           {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, { 12, 0,12 } },
+    { "Z+1/2,X+1/2,Y",             {  0, 0, 1, 1, 0, 0, 0, 1, 0 }, { 12,12, 0 } },
+    { "-Z+1/2,-X+1/2,Y",           {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, { 12,12, 0 } },
+    { "Z+1/2,-X+1/2,-Y",           {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, { 12,12, 0 } },
+    { "-Z+1/2,X+1/2,-Y",           {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, { 12,12, 0 } },
+    { "Y+1/2,Z+1/2,X",             {  0, 1, 0, 0, 0, 1, 1, 0, 0 }, { 12,12, 0 } },
+    { "Y+1/2,-Z+1/2,-X",           {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, { 12,12, 0 } },
+    { "-Y+1/2,Z+1/2,-X",           {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, { 12,12, 0 } },
+    { "-Y+1/2,-Z+1/2,X",           {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, { 12,12, 0 } },
+    { "Z+1/2,X+1/2,Y+1/2",         {  0, 0, 1, 1, 0, 0, 0, 1, 0 }, { 12,12,12 } },
+    { "-Z+1/2,-X+1/2,Y+1/2",       {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, { 12,12,12 } },
+    { "Z+1/2,-X+1/2,-Y+1/2",       {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, { 12,12,12 } },
+    { "-Z+1/2,X+1/2,-Y+1/2",       {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, { 12,12,12 } },
+    { "Y+1/2,Z+1/2,X+1/2",         {  0, 1, 0, 0, 0, 1, 1, 0, 0 }, { 12,12,12 } },
+    { "Y+1/2,-Z+1/2,-X+1/2",       {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, { 12,12,12 } },
+    { "-Y+1/2,Z+1/2,-X+1/2",       {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, { 12,12,12 } },
+    { "-Y+1/2,-Z+1/2,X+1/2",       {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, { 12,12,12 } },
+    { "-z+1/2,-x,y+1/2",           {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, { 12, 0,12 } },
+    { "z+1/2,-x+1/2,-y",           {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, { 12,12, 0 } },
+    { "-z,x+1/2,-y+1/2",           {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, {  0,12,12 } },
+    { "y+1/2,-z+1/2,-x",           {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, { 12,12, 0 } },
+    { "-y,z+1/2,-x+1/2",           {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, {  0,12,12 } },
+    { "-y+1/2,-z,x+1/2",           {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, { 12, 0,12 } },
+    { "-z,-x+1/2,y",               {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, {  0,12, 0 } },
+    { "z,-x,-y+1/2",               {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, {  0, 0,12 } },
+    { "y,-z,-x+1/2",               {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, {  0, 0,12 } },
+    { "-Z+1/2,X,-Y",               {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, { 12, 0, 0 } },
+    { "-Y+1/2,Z,-X",               {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, { 12, 0, 0 } },
+    { "-Y,-Z+1/2,X",               {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, {  0,12, 0 } },
+    { "z,x,-y",                    {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  0, 0, 0 } },
+    { "-z,x,y",                    {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, {  0, 0, 0 } },
+    { "z,-x,y",                    {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  0, 0, 0 } },
+    { "-y,z,x",                    {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  0, 0, 0 } },
+    { "y,-z,x",                    {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, {  0, 0, 0 } },
+    { "y,z,-x",                    {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, {  0, 0, 0 } },
+    { "-z+1/2,-x+1/2,-y+1/2",      {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, { 12,12,12 } },
+    { "z+1/2,x+1/2,-y+1/2",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 12,12,12 } },
+    { "-z+1/2,x+1/2,y+1/2",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, { 12,12,12 } },
+    { "z+1/2,-x+1/2,y+1/2",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 12,12,12 } },
+    { "-y+1/2,-z+1/2,-x+1/2",      {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, { 12,12,12 } },
+    { "-y+1/2,z+1/2,x+1/2",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 12,12,12 } },
+    { "y+1/2,-z+1/2,x+1/2",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 12,12,12 } },
+    { "y+1/2,z+1/2,-x+1/2",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 12,12,12 } },
+    { "-z+1/2,-x+1/2,y",           {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, { 12,12, 0 } },
+    { "z,-x+1/2,-y+1/2",           {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, {  0,12,12 } },
+    { "-z+1/2,x,-y+1/2",           {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, { 12, 0,12 } },
+    { "y,-z+1/2,-x+1/2",           {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, {  0,12,12 } },
+    { "-y+1/2,z,-x+1/2",           {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, { 12, 0,12 } },
+    { "-y+1/2,-z+1/2,x",           {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, { 12,12, 0 } },
+    { "z+1/2,x+1/2,-y",            {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 12,12, 0 } },
+    { "-z,x+1/2,y+1/2",            {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, {  0,12,12 } },
+    { "z+1/2,-x,y+1/2",            {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 12, 0,12 } },
+    { "-y,z+1/2,x+1/2",            {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  0,12,12 } },
+    { "y+1/2,-z,x+1/2",            {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 12, 0,12 } },
+    { "y+1/2,z+1/2,-x",            {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 12,12, 0 } },
+    { "-Z,-X+1/2,-Y+1/2",          {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, {  0,12,12 } },
+    { "Z,X+1/2,-Y+1/2",            {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  0,12,12 } },
+    { "-Z,X+1/2,Y+1/2",            {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, {  0,12,12 } },
+    { "Z,-X+1/2,Y+1/2",            {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  0,12,12 } },
+    { "-Y,-Z+1/2,-X+1/2",          {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, {  0,12,12 } },
+    { "-Y,Z+1/2,X+1/2",            {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  0,12,12 } },
+    { "Y,-Z+1/2,X+1/2",            {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, {  0,12,12 } },
+    { "Y,Z+1/2,-X+1/2",            {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, {  0,12,12 } },
+    { "-Z+1/2,-X,-Y+1/2",          {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, { 12, 0,12 } },
+    { "Z+1/2,X,-Y+1/2",            {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 12, 0,12 } },
+    { "-Z+1/2,X,Y+1/2",            {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, { 12, 0,12 } },
+    { "Z+1/2,-X,Y+1/2",            {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 12, 0,12 } },
+    { "-Y+1/2,-Z,-X+1/2",          {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, { 12, 0,12 } },
+    { "-Y+1/2,Z,X+1/2",            {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 12, 0,12 } },
+    { "Y+1/2,-Z,X+1/2",            {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 12, 0,12 } },
+    { "Y+1/2,Z,-X+1/2",            {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 12, 0,12 } },
+    { "-Z+1/2,-X+1/2,-Y",          {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, { 12,12, 0 } },
+    { "Z+1/2,X+1/2,-Y",            {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 12,12, 0 } },
+    { "-Z+1/2,X+1/2,Y",            {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, { 12,12, 0 } },
+    { "Z+1/2,-X+1/2,Y",            {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 12,12, 0 } },
+    { "-Y+1/2,-Z+1/2,-X",          {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, { 12,12, 0 } },
+    { "-Y+1/2,Z+1/2,X",            {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 12,12, 0 } },
+    { "Y+1/2,-Z+1/2,X",            {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 12,12, 0 } },
+    { "Y+1/2,Z+1/2,-X",            {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 12,12, 0 } },
+    { "-z+1/4,-x+1/4,-y+1/4",      {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, {  6, 6, 6 } },
+    { "z+3/4,x+3/4,-y+1/4",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 18,18, 6 } },
+    { "-z+1/4,x+3/4,y+3/4",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, {  6,18,18 } },
+    { "z+3/4,-x+1/4,y+3/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 18, 6,18 } },
+    { "-y+1/4,-z+1/4,-x+1/4",      {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, {  6, 6, 6 } },
+    { "-y+1/4,z+3/4,x+3/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  6,18,18 } },
+    { "y+3/4,-z+1/4,x+3/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 18, 6,18 } },
+    { "y+3/4,z+3/4,-x+1/4",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 18,18, 6 } },
+    { "Z,-X,-Y",                   {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, {  0, 0, 0 } },
+    { "Y,-Z,-X",                   {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, {  0, 0, 0 } },
+    { "-Z+1/4,-X+3/4,-Y+3/4",      {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, {  6,18,18 } },
+    { "Z+3/4,X+1/4,-Y+3/4",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 18, 6,18 } },
+    { "-Z+1/4,X+1/4,Y+1/4",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, {  6, 6, 6 } },
+    { "Z+3/4,-X+3/4,Y+1/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 18,18, 6 } },
+    { "-Y+1/4,-Z+3/4,-X+3/4",      {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, {  6,18,18 } },
+    { "-Y+1/4,Z+1/4,X+1/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  6, 6, 6 } },
+    { "Y+3/4,-Z+3/4,X+1/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 18,18, 6 } },
+    { "Y+3/4,Z+1/4,-X+3/4",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 18, 6,18 } },
+    { "-Z,X,-Y",                   {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, {  0, 0, 0 } },
+    { "-Y,Z,-X",                   {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, {  0, 0, 0 } },
+    { "-Z+3/4,-X+1/4,-Y+3/4",      {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, { 18, 6,18 } },
+    { "Z+1/4,X+3/4,-Y+3/4",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  6,18,18 } },
+    { "-Z+3/4,X+3/4,Y+1/4",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, { 18,18, 6 } },
+    { "Z+1/4,-X+1/4,Y+1/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  6, 6, 6 } },
+    { "-Y+3/4,-Z+1/4,-X+3/4",      {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, { 18, 6,18 } },
+    { "-Y+3/4,Z+3/4,X+1/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 18,18, 6 } },
+    { "Y+1/4,-Z+1/4,X+1/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, {  6, 6, 6 } },
+    { "Y+1/4,Z+3/4,-X+3/4",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, {  6,18,18 } },
+    { "-Z,-X,Y",                   {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, {  0, 0, 0 } },
+    { "-Y,-Z,X",                   {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, {  0, 0, 0 } },
+    { "-Z+3/4,-X+3/4,-Y+1/4",      {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, { 18,18, 6 } },
+    { "Z+1/4,X+1/4,-Y+1/4",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  6, 6, 6 } },
+    { "-Z+3/4,X+1/4,Y+3/4",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, { 18, 6,18 } },
+    { "Z+1/4,-X+3/4,Y+3/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  6,18,18 } },
+    { "-Y+3/4,-Z+3/4,-X+1/4",      {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, { 18,18, 6 } },
+    { "-Y+3/4,Z+1/4,X+3/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 18, 6,18 } },
+    { "Y+1/4,-Z+3/4,X+3/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, {  6,18,18 } },
+    { "Y+1/4,Z+1/4,-X+1/4",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, {  6, 6, 6 } },
+    { "-z+1/4,-x+1/4,y",           {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, {  6, 6, 0 } },
+    { "z,-x+1/4,-y+1/4",           {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, {  0, 6, 6 } },
+    { "-z+1/4,x,-y+1/4",           {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, {  6, 0, 6 } },
+    { "y,-z+1/4,-x+1/4",           {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, {  0, 6, 6 } },
+    { "-y+1/4,z,-x+1/4",           {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, {  6, 0, 6 } },
+    { "-y+1/4,-z+1/4,x",           {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, {  6, 6, 0 } },
+    { "z+3/4,x+3/4,-y",            {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 18,18, 0 } },
+    { "-z,x+3/4,y+3/4",            {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, {  0,18,18 } },
+    { "z+3/4,-x,y+3/4",            {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 18, 0,18 } },
+    { "-y,z+3/4,x+3/4",            {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  0,18,18 } },
+    { "y+3/4,-z,x+3/4",            {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 18, 0,18 } },
+    { "y+3/4,z+3/4,-x",            {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 18,18, 0 } },
+    { "-Z+1/4,-X+3/4,Y+1/2",       {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, {  6,18,12 } },
+    { "Z,-X+3/4,-Y+3/4",           {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, {  0,18,18 } },
+    { "-Z+1/4,X+1/2,-Y+3/4",       {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, {  6,12,18 } },
+    { "Y,-Z+3/4,-X+3/4",           {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, {  0,18,18 } },
+    { "-Y+1/4,Z+1/2,-X+3/4",       {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, {  6,12,18 } },
+    { "-Y+1/4,-Z+3/4,X+1/2",       {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, {  6,18,12 } },
+    { "Z+3/4,X+1/4,-Y+1/2",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 18, 6,12 } },
+    { "-Z,X+1/4,Y+1/4",            {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, {  0, 6, 6 } },
+    { "Z+3/4,-X+1/2,Y+1/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 18,12, 6 } },
+    { "-Y,Z+1/4,X+1/4",            {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  0, 6, 6 } },
+    { "Y+3/4,-Z+1/2,X+1/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 18,12, 6 } },
+    { "Y+3/4,Z+1/4,-X+1/2",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 18, 6,12 } },
+    { "-Z+3/4,-X+1/4,Y+1/2",       {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, { 18, 6,12 } },
+    { "Z+1/2,-X+1/4,-Y+3/4",       {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, { 12, 6,18 } },
+    { "-Z+3/4,X,-Y+3/4",           {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, { 18, 0,18 } },
+    { "Y+1/2,-Z+1/4,-X+3/4",       {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, { 12, 6,18 } },
+    { "-Y+3/4,Z,-X+3/4",           {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, { 18, 0,18 } },
+    { "-Y+3/4,-Z+1/4,X+1/2",       {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, { 18, 6,12 } },
+    { "Z+1/4,X+3/4,-Y+1/2",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  6,18,12 } },
+    { "-Z+1/2,X+3/4,Y+1/4",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, { 12,18, 6 } },
+    { "Z+1/4,-X,Y+1/4",            {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  6, 0, 6 } },
+    { "-Y+1/2,Z+3/4,X+1/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 12,18, 6 } },
+    { "Y+1/4,-Z,X+1/4",            {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, {  6, 0, 6 } },
+    { "Y+1/4,Z+3/4,-X+1/2",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, {  6,18,12 } },
+    { "-Z+3/4,-X+3/4,Y",           {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, { 18,18, 0 } },
+    { "Z+1/2,-X+3/4,-Y+1/4",       {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, { 12,18, 6 } },
+    { "-Z+3/4,X+1/2,-Y+1/4",       {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, { 18,12, 6 } },
+    { "Y+1/2,-Z+3/4,-X+1/4",       {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, { 12,18, 6 } },
+    { "-Y+3/4,Z+1/2,-X+1/4",       {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, { 18,12, 6 } },
+    { "-Y+3/4,-Z+3/4,X",           {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, { 18,18, 0 } },
+    { "Z+1/4,X+1/4,-Y",            {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  6, 6, 0 } },
+    { "-Z+1/2,X+1/4,Y+3/4",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, { 12, 6,18 } },
+    { "Z+1/4,-X+1/2,Y+3/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  6,12,18 } },
+    { "-Y+1/2,Z+1/4,X+3/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 12, 6,18 } },
+    { "Y+1/4,-Z+1/2,X+3/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, {  6,12,18 } },
+    { "Y+1/4,Z+1/4,-X",            {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, {  6, 6, 0 } },
+    { "-Z+1/2,-X+1/2,-Y+1/2",      {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, { 12,12,12 } },
+    { "Z+1/2,X+1/2,-Y+1/2",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 12,12,12 } },
+    { "-Z+1/2,X+1/2,Y+1/2",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, { 12,12,12 } },
+    { "Z+1/2,-X+1/2,Y+1/2",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 12,12,12 } },
+    { "-Y+1/2,-Z+1/2,-X+1/2",      {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, { 12,12,12 } },
+    { "-Y+1/2,Z+1/2,X+1/2",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 12,12,12 } },
+    { "Y+1/2,-Z+1/2,X+1/2",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 12,12,12 } },
+    { "Y+1/2,Z+1/2,-X+1/2",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 12,12,12 } },
+    { "z+1/2,x,-y+1/2",            {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 12, 0,12 } },
+    { "-z+1/2,x+1/2,y",            {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, { 12,12, 0 } },
+    { "z,-x+1/2,y+1/2",            {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  0,12,12 } },
+    { "-y+1/2,z+1/2,x",            {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 12,12, 0 } },
+    { "y,-z+1/2,x+1/2",            {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, {  0,12,12 } },
+    { "y+1/2,z,-x+1/2",            {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 12, 0,12 } },
+    { "z,x+1/2,-y",                {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  0,12, 0 } },
+    { "-z,x,y+1/2",                {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, {  0, 0,12 } },
+    { "-y,z,x+1/2",                {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  0, 0,12 } },
+    { "Z+1/2,-X,Y",                {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 12, 0, 0 } },
+    { "Y+1/2,-Z,X",                {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 12, 0, 0 } },
+    { "Y,Z+1/2,-X",                {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, {  0,12, 0 } },
+    { "-x,z,y",                    { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0, 0, 0 } },
+    { "x,-z,y",                    {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  0, 0, 0 } },
+    { "x,z,-y",                    {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  0, 0, 0 } },
+    { "z,y,-x",                    {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, {  0, 0, 0 } },
+    { "z,-y,x",                    {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  0, 0, 0 } },
+    { "-z,y,x",                    {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  0, 0, 0 } },
+    { "-x+1/2,z+1/2,y+1/2",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12,12,12 } },
+    { "x+1/2,-z+1/2,y+1/2",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12,12,12 } },
+    { "x+1/2,z+1/2,-y+1/2",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12,12,12 } },
+    { "z+1/2,y+1/2,-x+1/2",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 12,12,12 } },
+    { "z+1/2,-y+1/2,x+1/2",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 12,12,12 } },
+    { "-z+1/2,y+1/2,x+1/2",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 12,12,12 } },
+    { "-Y,X+1/2,Z+1/2",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "Y,-X+1/2,Z+1/2",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "Y,X+1/2,-Z+1/2",            {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "-Y,-X+1/2,-Z+1/2",          {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "-X,Z+1/2,Y+1/2",            { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0,12,12 } },
+    { "X,-Z+1/2,Y+1/2",            {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  0,12,12 } },
+    { "X,Z+1/2,-Y+1/2",            {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  0,12,12 } },
+    { "-X,-Z+1/2,-Y+1/2",          { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0,12,12 } },
+    { "Z,Y+1/2,-X+1/2",            {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, {  0,12,12 } },
+    { "-Z,-Y+1/2,-X+1/2",          {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, {  0,12,12 } },
+    { "Z,-Y+1/2,X+1/2",            {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  0,12,12 } },
+    { "-Z,Y+1/2,X+1/2",            {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  0,12,12 } },
+    { "-Y+1/2,X,Z+1/2",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "Y+1/2,-X,Z+1/2",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "Y+1/2,X,-Z+1/2",            {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-Y+1/2,-X,-Z+1/2",          {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-X+1/2,Z,Y+1/2",            { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12, 0,12 } },
+    { "X+1/2,-Z,Y+1/2",            {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12, 0,12 } },
+    { "X+1/2,Z,-Y+1/2",            {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12, 0,12 } },
+    { "-X+1/2,-Z,-Y+1/2",          { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12, 0,12 } },
+    { "Z+1/2,Y,-X+1/2",            {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 12, 0,12 } },
+    { "-Z+1/2,-Y,-X+1/2",          {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, { 12, 0,12 } },
+    { "Z+1/2,-Y,X+1/2",            {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 12, 0,12 } },
+    { "-Z+1/2,Y,X+1/2",            {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 12, 0,12 } },
+    { "-Y+1/2,X+1/2,Z",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "Y+1/2,-X+1/2,Z",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 12,12, 0 } },
+    { "-X+1/2,Z+1/2,Y",            { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12,12, 0 } },
+    { "X+1/2,-Z+1/2,Y",            {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12,12, 0 } },
+    { "X+1/2,Z+1/2,-Y",            {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12,12, 0 } },
+    { "-X+1/2,-Z+1/2,-Y",          { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12,12, 0 } },
+    { "Z+1/2,Y+1/2,-X",            {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 12,12, 0 } },
+    { "-Z+1/2,-Y+1/2,-X",          {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, { 12,12, 0 } },
+    { "Z+1/2,-Y+1/2,X",            {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 12,12, 0 } },
+    { "-Z+1/2,Y+1/2,X",            {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 12,12, 0 } },
+    { "-y+1/4,x+1/4,z+1/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  6, 6, 6 } },
+    { "y+3/4,-x+1/4,z+3/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 18, 6,18 } },
+    { "y+1/4,x+1/4,-z+1/4",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  6, 6, 6 } },
+    { "-y+3/4,-x+1/4,-z+3/4",      {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, { 18, 6,18 } },
+    { "-x+1/4,z+1/4,y+1/4",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  6, 6, 6 } },
+    { "-z,-x+1/2,y+1/2",           {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, {  0,12,12 } },
+    { "x+3/4,-z+1/4,y+3/4",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18, 6,18 } },
+    { "x+1/4,z+1/4,-y+1/4",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6, 6, 6 } },
+    { "-x+3/4,-z+1/4,-y+3/4",      { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 18, 6,18 } },
+    { "y+1/2,-z,-x+1/2",           {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, { 12, 0,12 } },
+    { "z+1/4,y+3/4,-x+3/4",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, {  6,18,18 } },
+    { "-y+1/2,z+1/2,-x",           {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, { 12,12, 0 } },
+    { "-z+1/4,-y+1/4,-x+1/4",      {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, {  6, 6, 6 } },
+    { "z+1/4,-y+3/4,x+3/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  6,18,18 } },
+    { "-z+3/4,y+3/4,x+1/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 18,18, 6 } },
+    { "Y+1/4,X+3/4,-Z+3/4",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  6,18,18 } },
+    { "-X+1/4,Z+3/4,Y+3/4",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  6,18,18 } },
+    { "X+3/4,-Z+3/4,Y+1/4",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18,18, 6 } },
+    { "X+1/4,Z+3/4,-Y+3/4",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6,18,18 } },
+    { "-X+3/4,-Z+3/4,-Y+1/4",      { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 18,18, 6 } },
+    { "Z+1/4,Y+1/4,-X+1/4",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, {  6, 6, 6 } },
+    { "-Z+1/4,-Y+3/4,-X+3/4",      {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, {  6,18,18 } },
+    { "Z+1/4,-Y+1/4,X+1/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  6, 6, 6 } },
+    { "-Z+3/4,Y+1/4,X+3/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 18, 6,18 } },
+    { "-Y+1/4,-X+1/4,-Z+1/4",      {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  6, 6, 6 } },
+    { "-X+3/4,Z+1/4,Y+3/4",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 18, 6,18 } },
+    { "X+1/4,-Z+1/4,Y+1/4",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6, 6, 6 } },
+    { "X+3/4,Z+1/4,-Y+3/4",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18, 6,18 } },
+    { "-X+1/4,-Z+1/4,-Y+1/4",      { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  6, 6, 6 } },
+    { "Z+3/4,Y+3/4,-X+1/4",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 18,18, 6 } },
+    { "-Z+3/4,-Y+1/4,-X+3/4",      {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, { 18, 6,18 } },
+    { "Z+3/4,-Y+3/4,X+1/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 18,18, 6 } },
+    { "-Z+1/4,Y+3/4,X+3/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  6,18,18 } },
+    { "-Y+3/4,X+3/4,Z+1/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 18,18, 6 } },
+    { "Y+1/4,-X+3/4,Z+3/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  6,18,18 } },
+    { "Y+3/4,X+3/4,-Z+1/4",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 18,18, 6 } },
+    { "-Y+1/4,-X+3/4,-Z+3/4",      {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  6,18,18 } },
+    { "-X+3/4,Z+3/4,Y+1/4",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 18,18, 6 } },
+    { "X+1/4,-Z+3/4,Y+3/4",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6,18,18 } },
+    { "X+3/4,Z+3/4,-Y+1/4",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18,18, 6 } },
+    { "-X+1/4,-Z+3/4,-Y+3/4",      { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  6,18,18 } },
+    { "Z+3/4,Y+1/4,-X+3/4",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 18, 6,18 } },
+    { "-Z+3/4,-Y+3/4,-X+1/4",      {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, { 18,18, 6 } },
+    { "Z+3/4,-Y+1/4,X+3/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 18, 6,18 } },
+    { "-Z+1/4,Y+1/4,X+1/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  6, 6, 6 } },
+    { "-X+1/2,Z+1/2,Y+1/2",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12,12,12 } },
+    { "X+1/2,-Z+1/2,Y+1/2",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12,12,12 } },
+    { "X+1/2,Z+1/2,-Y+1/2",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12,12,12 } },
+    { "-X+1/2,-Z+1/2,-Y+1/2",      { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12,12,12 } },
+    { "Z+1/2,Y+1/2,-X+1/2",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 12,12,12 } },
+    { "-Z+1/2,-Y+1/2,-X+1/2",      {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, { 12,12,12 } },
+    { "Z+1/2,-Y+1/2,X+1/2",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 12,12,12 } },
+    { "-Z+1/2,Y+1/2,X+1/2",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 12,12,12 } },
+    { "-y+3/4,x+1/4,z+3/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 18, 6,18 } },
+    { "y+3/4,-x+3/4,z+1/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 18,18, 6 } },
+    { "-x+3/4,z+1/4,y+3/4",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 18, 6,18 } },
+    { "x+3/4,-z+3/4,y+1/4",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18,18, 6 } },
+    { "x+1/4,z+3/4,-y+3/4",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6,18,18 } },
+    { "-x+1/4,-z+1/4,-y+1/4",      { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  6, 6, 6 } },
+    { "z+3/4,-y+3/4,x+1/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 18,18, 6 } },
+    { "-z+3/4,y+1/4,x+3/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 18, 6,18 } },
+    { "y+3/4,x+1/4,-z+1/4",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 18, 6, 6 } },
+    { "-y+3/4,-x+3/4,-z+3/4",      {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, { 18,18,18 } },
+    { "-x+1/4,z+3/4,y+1/4",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  6,18, 6 } },
+    { "x+1/4,-z+1/4,y+3/4",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6, 6,18 } },
+    { "x+3/4,z+1/4,-y+1/4",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18, 6, 6 } },
+    { "-x+3/4,-z+3/4,-y+3/4",      { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 18,18,18 } },
+    { "z+3/4,y+1/4,-x+1/4",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 18, 6, 6 } },
+    { "-z+3/4,-y+3/4,-x+3/4",      {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, { 18,18,18 } },
+    { "z+1/4,-y+1/4,x+3/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  6, 6,18 } },
+    { "-z+1/4,y+3/4,x+1/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  6,18, 6 } },
+    { "-z+1/2,x,-y",               {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, { 12, 0, 0 } },
+    { "-Z,-X+1/2,Y",               {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, {  0,12, 0 } },
+    { "X+3/4,Z+1/4,-Y+1/4",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18, 6, 6 } },
+    { "-X+3/4,-Z+3/4,-Y+3/4",      { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 18,18,18 } },
+    { "Y,-Z,-X+1/2",               {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, {  0, 0,12 } },
+    { "Z+1/4,Y+3/4,-X+3/4",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, {  6,18,18 } },
+    { "-Z+3/4,-Y+3/4,-X+3/4",      {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, { 18,18,18 } },
+    { "Z+1/4,-Y+1/4,X+3/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  6, 6,18 } },
+    { "-Z+1/4,Y+3/4,X+1/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  6,18, 6 } },
+    { "x,-z,-y",                   {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0, 0, 0 } },
+    { "-x,z,-y",                   { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  0, 0, 0 } },
+    { "-x,-z,y",                   { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  0, 0, 0 } },
+    { "-z,-y,x",                   {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  0, 0, 0 } },
+    { "-z,y,-x",                   {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, {  0, 0, 0 } },
+    { "z,-y,-x",                   {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  0, 0, 0 } },
+    { "Y,-X+1/2,-Z+1/2",           {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "-Y,X+1/2,-Z+1/2",           {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  0,12,12 } },
+    { "-Y,-X+1/2,Z+1/2",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "Y,X+1/2,Z+1/2",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, {  0,12,12 } },
+    { "X,-Z+1/2,-Y+1/2",           {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0,12,12 } },
+    { "-X,Z+1/2,-Y+1/2",           { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  0,12,12 } },
+    { "-X,-Z+1/2,Y+1/2",           { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  0,12,12 } },
+    { "X,Z+1/2,Y+1/2",             {  1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0,12,12 } },
+    { "-Z,-Y+1/2,X+1/2",           {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  0,12,12 } },
+    { "Z,Y+1/2,X+1/2",             {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, {  0,12,12 } },
+    { "-Z,Y+1/2,-X+1/2",           {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, {  0,12,12 } },
+    { "Z,-Y+1/2,-X+1/2",           {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  0,12,12 } },
+    { "Y+1/2,-X,-Z+1/2",           {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-Y+1/2,X,-Z+1/2",           {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 12, 0,12 } },
+    { "-Y+1/2,-X,Z+1/2",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "Y+1/2,X,Z+1/2",             {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "X+1/2,-Z,-Y+1/2",           {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12, 0,12 } },
+    { "-X+1/2,Z,-Y+1/2",           { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12, 0,12 } },
+    { "-X+1/2,-Z,Y+1/2",           { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12, 0,12 } },
+    { "X+1/2,Z,Y+1/2",             {  1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12, 0,12 } },
+    { "-Z+1/2,-Y,X+1/2",           {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 12, 0,12 } },
+    { "Z+1/2,Y,X+1/2",             {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, { 12, 0,12 } },
+    { "-Z+1/2,Y,-X+1/2",           {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 12, 0,12 } },
+    { "Z+1/2,-Y,-X+1/2",           {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 12, 0,12 } },
+    { "Y+1/2,-X+1/2,-Z",           {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "-Y+1/2,X+1/2,-Z",           {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 12,12, 0 } },
+    { "X+1/2,-Z+1/2,-Y",           {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12,12, 0 } },
+    { "-X+1/2,Z+1/2,-Y",           { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12,12, 0 } },
+    { "-X+1/2,-Z+1/2,Y",           { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12,12, 0 } },
+    { "X+1/2,Z+1/2,Y",             {  1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12,12, 0 } },
+    { "-Z+1/2,-Y+1/2,X",           {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 12,12, 0 } },
+    { "Z+1/2,Y+1/2,X",             {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, { 12,12, 0 } },
+    { "-Z+1/2,Y+1/2,-X",           {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 12,12, 0 } },
+    { "Z+1/2,-Y+1/2,-X",           {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 12,12, 0 } },
+    { "X+1/2,-Z+1/2,-Y+1/2",       {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12,12,12 } },
+    { "-X+1/2,Z+1/2,-Y+1/2",       { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12,12,12 } },
+    { "-X+1/2,-Z+1/2,Y+1/2",       { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12,12,12 } },
+    { "X+1/2,Z+1/2,Y+1/2",         {  1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12,12,12 } },
+    { "-Z+1/2,-Y+1/2,X+1/2",       {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 12,12,12 } },
+    { "Z+1/2,Y+1/2,X+1/2",         {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, { 12,12,12 } },
+    { "-Z+1/2,Y+1/2,-X+1/2",       {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 12,12,12 } },
+    { "Z+1/2,-Y+1/2,-X+1/2",       {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 12,12,12 } },
+    { "x+1/2,-z+1/2,-y+1/2",       {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12,12,12 } },
+    { "-x+1/2,z+1/2,-y+1/2",       { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12,12,12 } },
+    { "-x+1/2,-z+1/2,y+1/2",       { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12,12,12 } },
+    { "-z+1/2,-y+1/2,x+1/2",       {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 12,12,12 } },
+    { "-z+1/2,y+1/2,-x+1/2",       {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 12,12,12 } },
+    { "z+1/2,-y+1/2,-x+1/2",       {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 12,12,12 } },
+    { "-y+1/2,-x,z",               {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0, 0 } },
+    { "y,x+1/2,z",                 {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, {  0,12, 0 } },
+    { "x+1/2,-z,-y",               {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12, 0, 0 } },
+    { "-x,z+1/2,-y",               { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  0,12, 0 } },
+    { "-x+1/2,-z,y",               { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12, 0, 0 } },
+    { "-z+1/2,x+1/2,-y",           {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, { 12,12, 0 } },
+    { "x,z+1/2,y",                 {  1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0,12, 0 } },
+    { "-z,-y,x+1/2",               {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  0, 0,12 } },
+    { "z+1/2,y,x",                 {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, { 12, 0, 0 } },
+    { "-z,y,-x+1/2",               {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, {  0, 0,12 } },
+    { "-Y,X,-Z+1/2",               {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "Y,X,Z+1/2",                 {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "-X,Z,-Y+1/2",               { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  0, 0,12 } },
+    { "X,Z,Y+1/2",                 {  1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0, 0,12 } },
+    { "-Z,-Y+1/2,X",               {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  0,12, 0 } },
+    { "-Z,Y+1/2,-X",               {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, {  0,12, 0 } },
+    { "Z+1/2,-Y,-X",               {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 12, 0, 0 } },
+    { "Y,-X,-Z+1/2",               {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "-Y,-X,Z+1/2",               {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "X,-Z,-Y+1/2",               {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0, 0,12 } },
+    { "-X,-Z,Y+1/2",               { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  0, 0,12 } },
+    { "-Z+1/2,-Y,X",               {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 12, 0, 0 } },
+    { "Z,Y,X+1/2",                 {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, {  0, 0,12 } },
+    { "-Z+1/2,Y,-X",               {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 12, 0, 0 } },
+    { "Z,-Y+1/2,-X",               {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  0,12, 0 } },
+    { "Y,-X+1/2,-Z",               {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0,12, 0 } },
+    { "-Y+1/2,X,-Z",               {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 12, 0, 0 } },
+    { "-Y,-X+1/2,Z",               {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  0,12, 0 } },
+    { "Y+1/2,X,Z",                 {  0, 1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 0, 0 } },
+    { "X,-Z+1/2,-Y",               {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0,12, 0 } },
+    { "-X+1/2,Z,-Y",               { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12, 0, 0 } },
+    { "-X,-Z+1/2,Y",               { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  0,12, 0 } },
+    { "X+1/2,Z,Y",                 {  1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12, 0, 0 } },
+    { "Z,Y+1/2,X",                 {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, {  0,12, 0 } },
+    { "Z,-Y,-X+1/2",               {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  0, 0,12 } },
+    { "y+1/4,-x+3/4,-z+1/4",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  6,18, 6 } },
+    { "-y+1/4,-x+3/4,z+3/4",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  6,18,18 } },
+    { "x+1/4,-z+3/4,-y+1/4",       {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  6,18, 6 } },
+    { "-x+3/4,z+3/4,-y+1/4",       { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18,18, 6 } },
+    { "-x+1/4,-z+3/4,y+3/4",       { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6,18,18 } },
+    { "x+3/4,z+3/4,y+3/4",         {  1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 18,18,18 } },
+    { "-z+1/4,-y+3/4,x+3/4",       {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  6,18,18 } },
+    { "z+1/4,y+1/4,x+1/4",         {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, {  6, 6, 6 } },
+    { "-z+1/4,y+1/4,-x+3/4",       {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, {  6, 6,18 } },
+    { "z+3/4,-y+1/4,-x+3/4",       {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 18, 6,18 } },
+    { "Y+3/4,-X+1/4,-Z+3/4",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 18, 6,18 } },
+    { "-Y+3/4,-X+1/4,Z+1/4",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 18, 6, 6 } },
+    { "X+3/4,-Z+1/4,-Y+3/4",       {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 18, 6,18 } },
+    { "-X+1/4,Z+1/4,-Y+3/4",       { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6, 6,18 } },
+    { "-X+3/4,-Z+1/4,Y+1/4",       { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18, 6, 6 } },
+    { "X+1/4,Z+1/4,Y+1/4",         {  1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  6, 6, 6 } },
+    { "-Z+3/4,-Y+1/4,X+1/4",       {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 18, 6, 6 } },
+    { "Z+3/4,Y+3/4,X+3/4",         {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, { 18,18,18 } },
+    { "-Z+3/4,Y+3/4,-X+1/4",       {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 18,18, 6 } },
+    { "Z+1/4,-Y+3/4,-X+1/4",       {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  6,18, 6 } },
+    { "-x+1/2,z,y",                { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12, 0, 0 } },
+    { "x,-z+1/2,y",                {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  0,12, 0 } },
+    { "x,z,-y+1/2",                {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  0, 0,12 } },
+    { "z,y,-x+1/2",                {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, {  0, 0,12 } },
+    { "z,-y+1/2,x",                {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  0,12, 0 } },
+    { "-z+1/2,y,x",                {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 12, 0, 0 } },
+    { "-x,-z,y+1/2",               { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  0, 0,12 } },
+    { "-z,y+1/2,-x",               {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, {  0,12, 0 } },
+    { "z+1/2,-y,-x",               {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 12, 0, 0 } },
+    { "-x,z+1/2,y+1/2",            { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0,12,12 } },
+    { "x+1/2,-z,y+1/2",            {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12, 0,12 } },
+    { "x+1/2,z+1/2,-y",            {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12,12, 0 } },
+    { "z+1/2,y+1/2,-x",            {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 12,12, 0 } },
+    { "z+1/2,-y,x+1/2",            {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 12, 0,12 } },
+    { "-z,y+1/2,x+1/2",            {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  0,12,12 } },
+    { "x,-z+1/2,-y+1/2",           {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0,12,12 } },
+    { "-x+1/2,z,-y+1/2",           { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12, 0,12 } },
+    { "-x+1/2,-z+1/2,y",           { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12,12, 0 } },
+    { "-z+1/2,-y+1/2,x",           {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 12,12, 0 } },
+    { "-z+1/2,y,-x+1/2",           {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 12, 0,12 } },
+    { "z,-y+1/2,-x+1/2",           {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  0,12,12 } },
+    { "y+1/2,x,-z",                {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 12, 0, 0 } },
+    { "-y,-x+1/2,-z",              {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  0,12, 0 } },
+    { "x+1/2,z,-y",                {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 12, 0, 0 } },
+    { "-x,-z+1/2,-y",              { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0,12, 0 } },
+    { "-z+1/2,-y,-x",              {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, { 12, 0, 0 } },
+    { "z,-y,x+1/2",                {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  0, 0,12 } },
+    { "z+1/2,-x+1/2,y",            {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 12,12, 0 } },
+    { "Y,-X,Z+1/2",                {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "-Y,-X,-Z+1/2",              {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 0,12 } },
+    { "X,-Z,Y+1/2",                {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  0, 0,12 } },
+    { "-X,-Z,-Y+1/2",              { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0, 0,12 } },
+    { "Z,Y+1/2,-X",                {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, {  0,12, 0 } },
+    { "Z,-Y+1/2,X",                {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  0,12, 0 } },
+    { "-Z+1/2,Y,X",                {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 12, 0, 0 } },
+    { "-Y,Z,X",                    {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  0, 0, 0 } },
+    { "-Y,X,Z+1/2",                {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 0,12 } },
+    { "-X,Z,Y+1/2",                { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0, 0,12 } },
+    { "X,Z,-Y+1/2",                {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  0, 0,12 } },
+    { "Z+1/2,Y,-X",                {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 12, 0, 0 } },
+    { "-Z,-Y,-X+1/2",              {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, {  0, 0,12 } },
+    { "Z+1/2,-Y,X",                {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 12, 0, 0 } },
+    { "-Z,Y+1/2,X",                {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  0,12, 0 } },
+    { "Y,-Z,X",                    {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, {  0, 0, 0 } },
+    { "-Y,X+1/2,Z",                {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0,12, 0 } },
+    { "Y+1/2,-X,Z",                {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0, 0 } },
+    { "Y,X+1/2,-Z",                {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  0,12, 0 } },
+    { "-Y+1/2,-X,-Z",              {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, { 12, 0, 0 } },
+    { "-X,Z+1/2,Y",                { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0,12, 0 } },
+    { "X+1/2,-Z,Y",                {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12, 0, 0 } },
+    { "X,Z+1/2,-Y",                {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  0,12, 0 } },
+    { "-X+1/2,-Z,-Y",              { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12, 0, 0 } },
+    { "-Z,-Y+1/2,-X",              {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, {  0,12, 0 } },
+    { "-Z,Y,X+1/2",                {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  0, 0,12 } },
+    { "X,Y,-Z",                    {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  0, 0, 0 } },
+    { "Z,X,-Y",                    {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  0, 0, 0 } },
+    { "Z,-X,Y",                    {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  0, 0, 0 } },
+    { "y+3/4,x+1/4,-z+3/4",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 18, 6,18 } },
+    { "x+3/4,z+1/4,-y+3/4",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18, 6,18 } },
+    { "-z+1/4,-y+3/4,-x+3/4",      {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, {  6,18,18 } },
+    { "z+1/4,-y+1/4,x+1/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  6, 6, 6 } },
+    { "-y+1/2,-x,z+1/2",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0,12 } },
+    { "z+1/4,x+3/4,-y+3/4",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  6,18,18 } },
+    { "-x+1/2,-z,y+1/2",           { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12, 0,12 } },
+    { "z+1/4,-x+1/4,y+1/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  6, 6, 6 } },
+    { "-y+3/4,z+1/4,x+3/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 18, 6,18 } },
+    { "-z,-y+1/2,x+1/2",           {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  0,12,12 } },
+    { "y+3/4,-z+3/4,x+1/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 18,18, 6 } },
+    { "z,y+1/2,x+1/2",             {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, {  0,12,12 } },
+    { "z+1/2,-y,-x+1/2",           {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 12, 0,12 } },
+    { "-Z+1/4,-Y+1/4,-X+1/4",      {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, {  6, 6, 6 } },
+    { "Z+1/4,-Y+3/4,X+3/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  6,18,18 } },
+    { "-Z+3/4,Y+3/4,X+1/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 18,18, 6 } },
+    { "-Z,-Y,X",                   {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  0, 0, 0 } },
+    { "Y+3/4,-Z+1/4,X+3/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 18, 6,18 } },
+    { "Z,Y,X",                     {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, {  0, 0, 0 } },
+    { "Y+1/4,X+1/4,-Z+1/4",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  6, 6, 6 } },
+    { "-Y+3/4,-X+1/4,-Z+3/4",      {  0,-1, 0,-1, 0, 0, 0, 0,-1 }, { 18, 6,18 } },
+    { "X+1/4,Z+1/4,-Y+1/4",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6, 6, 6 } },
+    { "-X+3/4,-Z+1/4,-Y+3/4",      { -1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 18, 6,18 } },
+    { "-Y,-X,Z",                   {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  0, 0, 0 } },
+    { "Z+3/4,X+3/4,-Y+1/4",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 18,18, 6 } },
+    { "-X,Z,-Y",                   { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  0, 0, 0 } },
+    { "-X,-Z,Y",                   { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  0, 0, 0 } },
+    { "Z+3/4,-X+1/4,Y+3/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 18, 6,18 } },
+    { "Z,-Y,-X",                   {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  0, 0, 0 } },
+    { "-Y+1/4,Z+3/4,X+3/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  6,18,18 } },
+    { "-y,x+1/4,z+1/4",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 6, 6 } },
+    { "-x+3/4,-y+1/4,z+1/2",       { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18, 6,12 } },
+    { "y+3/4,-x,z+3/4",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 18, 0,18 } },
+    { "y+3/4,x+1/4,-z+1/2",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 18, 6,12 } },
+    { "-x+3/4,y,-z+3/4",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18, 0,18 } },
+    { "-x,z+1/4,y+1/4",            { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0, 6, 6 } },
+    { "-z+3/4,-x+1/4,y+1/2",       {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, { 18, 6,12 } },
+    { "x+3/4,-z,y+3/4",            {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18, 0,18 } },
+    { "x+3/4,z+1/4,-y+1/2",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18, 6,12 } },
+    { "-z+3/4,x,-y+3/4",           {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, { 18, 0,18 } },
+    { "y+1/2,-z+3/4,-x+1/4",       {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, { 12,18, 6 } },
+    { "z+1/4,y+3/4,-x+1/2",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, {  6,18,12 } },
+    { "-y+1/4,z+1/2,-x+3/4",       {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, {  6,12,18 } },
+    { "-z,-y+1/2,-x+1/2",          {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, {  0,12,12 } },
+    { "z+1/4,-y,x+1/4",            {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  6, 0, 6 } },
+    { "-z+1/2,y+1/4,x+3/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 12, 6,18 } },
+    { "y,-x+3/4,-z+3/4",           {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0,18,18 } },
+    { "x+1/4,y+3/4,-z+1/2",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6,18,12 } },
+    { "-y+1/4,x,-z+1/4",           {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  6, 0, 6 } },
+    { "-y+1/4,-x+3/4,z+1/2",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  6,18,12 } },
+    { "x+1/4,-y,z+1/4",            {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6, 0, 6 } },
+    { "x,-z+3/4,-y+3/4",           {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0,18,18 } },
+    { "z+1/4,x+3/4,-y+1/2",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  6,18,12 } },
+    { "-x+1/4,z,-y+1/4",           { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6, 0, 6 } },
+    { "-x+1/4,-z+3/4,y+1/2",       { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6,18,12 } },
+    { "z+1/4,-x,y+1/4",            {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  6, 0, 6 } },
+    { "-y+1/2,z+1/4,x+3/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 12, 6,18 } },
+    { "-z+3/4,-y+1/4,x+1/2",       {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 18, 6,12 } },
+    { "y+3/4,-z+1/2,x+1/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 18,12, 6 } },
+    { "-z+3/4,y,-x+3/4",           {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 18, 0,18 } },
+    { "z+1/2,-y+3/4,-x+1/4",       {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 12,18, 6 } },
+    { "-Y,X+3/4,Z+3/4",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0,18,18 } },
+    { "Y+3/4,-X+1/2,Z+1/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 18,12, 6 } },
+    { "Y+3/4,X+3/4,-Z",            {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 18,18, 0 } },
+    { "-X,Z+3/4,Y+3/4",            { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0,18,18 } },
+    { "X+3/4,-Z+1/2,Y+1/4",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18,12, 6 } },
+    { "X+3/4,Z+3/4,-Y",            {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18,18, 0 } },
+    { "Z+1/4,Y+1/4,-X",            {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, {  6, 6, 0 } },
+    { "-Y+1/4,Z,-X+1/4",           {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, {  6, 0, 6 } },
+    { "-Z,-Y,-X",                  {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, {  0, 0, 0 } },
+    { "Z+1/4,-Y+1/2,X+3/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  6,12,18 } },
+    { "-Z+1/2,Y+3/4,X+1/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 12,18, 6 } },
+    { "Y,-X+1/4,-Z+1/4",           {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 6, 6 } },
+    { "-Y+1/4,X+1/2,-Z+3/4",       {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  6,12,18 } },
+    { "-Y+1/4,-X+1/4,Z",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  6, 6, 0 } },
+    { "X,-Z+1/4,-Y+1/4",           {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0, 6, 6 } },
+    { "-X+1/4,Z+1/2,-Y+3/4",       { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6,12,18 } },
+    { "-X+1/4,-Z+1/4,Y",           { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6, 6, 0 } },
+    { "-Z+3/4,-Y+3/4,X",           {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 18,18, 0 } },
+    { "Y+3/4,-Z,X+3/4",            {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 18, 0,18 } },
+    { "-Z+3/4,Y+1/2,-X+1/4",       {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 18,12, 6 } },
+    { "Z+1/2,-Y+1/4,-X+3/4",       {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 12, 6,18 } },
+    { "-Y+1/2,X+1/4,Z+3/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 6,18 } },
+    { "-X+1/4,-Y+1/4,Z",           { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6, 6, 0 } },
+    { "Y+1/4,-X,Z+1/4",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  6, 0, 6 } },
+    { "Y+1/4,X+1/4,-Z",            {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  6, 6, 0 } },
+    { "-X+1/4,Y,-Z+1/4",           { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6, 0, 6 } },
+    { "-X+1/2,Z+1/4,Y+3/4",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12, 6,18 } },
+    { "-Z+1/4,-X+1/4,Y",           {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, {  6, 6, 0 } },
+    { "X+1/4,-Z,Y+1/4",            {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6, 0, 6 } },
+    { "X+1/4,Z+1/4,-Y",            {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6, 6, 0 } },
+    { "-Z+1/4,X,-Y+1/4",           {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, {  6, 0, 6 } },
+    { "Z+3/4,Y+3/4,-X",            {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 18,18, 0 } },
+    { "Z+3/4,-Y,X+3/4",            {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 18, 0,18 } },
+    { "-Z,Y+1/4,X+1/4",            {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  0, 6, 6 } },
+    { "Y+1/2,-X+3/4,-Z+1/4",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12,18, 6 } },
+    { "X+3/4,Y+3/4,-Z",            {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18,18, 0 } },
+    { "-Y+3/4,X,-Z+3/4",           {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 18, 0,18 } },
+    { "-Y+3/4,-X+3/4,Z",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 18,18, 0 } },
+    { "X+3/4,-Y,Z+3/4",            {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18, 0,18 } },
+    { "X+1/2,-Z+3/4,-Y+1/4",       {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12,18, 6 } },
+    { "Z+3/4,X+3/4,-Y",            {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 18,18, 0 } },
+    { "-X+3/4,Z,-Y+3/4",           { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18, 0,18 } },
+    { "-X+3/4,-Z+3/4,Y",           { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18,18, 0 } },
+    { "Z+3/4,-X,Y+3/4",            {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 18, 0,18 } },
+    { "-Z+1/4,-Y+1/4,X",           {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  6, 6, 0 } },
+    { "-Z+1/4,Y,-X+1/4",           {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, {  6, 0, 6 } },
+    { "Z,-Y+3/4,-X+3/4",           {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  0,18,18 } },
+    { "-Y+1/2,X+3/4,Z+1/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12,18, 6 } },
+    { "Y+1/4,-X+1/2,Z+3/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  6,12,18 } },
+    { "Y+1/4,X+3/4,-Z+1/2",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  6,18,12 } },
+    { "-X+1/2,Z+3/4,Y+1/4",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12,18, 6 } },
+    { "X+1/4,-Z+1/2,Y+3/4",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6,12,18 } },
+    { "X+1/4,Z+3/4,-Y+1/2",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6,18,12 } },
+    { "Y,-Z+1/4,-X+1/4",           {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, {  0, 6, 6 } },
+    { "Z+3/4,Y+1/4,-X+1/2",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 18, 6,12 } },
+    { "Z+3/4,-Y+1/2,X+1/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 18,12, 6 } },
+    { "-Z,Y+3/4,X+3/4",            {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  0,18,18 } },
+    { "Y+1/2,-X+1/4,-Z+3/4",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12, 6,18 } },
+    { "-Y+3/4,X+1/2,-Z+1/4",       {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 18,12, 6 } },
+    { "-Y+3/4,-X+1/4,Z+1/2",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 18, 6,12 } },
+    { "X+1/2,-Z+1/4,-Y+3/4",       {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12, 6,18 } },
+    { "-X+3/4,Z+1/2,-Y+1/4",       { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18,12, 6 } },
+    { "-X+3/4,-Z+1/4,Y+1/2",       { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18, 6,12 } },
+    { "-Y,Z+3/4,X+3/4",            {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  0,18,18 } },
+    { "-Z+1/4,-Y+3/4,X+1/2",       {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  6,18,12 } },
+    { "-Z+1/4,Y+1/2,-X+3/4",       {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, {  6,12,18 } },
+    { "Z,-Y+1/4,-X+1/4",           {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  0, 6, 6 } },
+    { "-x+3/4,-y+3/4,-z+3/4",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 18,18,18 } },
+    { "x+3/4,y+1/4,-z+1/4",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18, 6, 6 } },
+    { "-x+3/4,y+3/4,z+3/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 18,18,18 } },
+    { "x+3/4,-y+1/4,z+1/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18, 6, 6 } },
+    { "-z+3/4,-x+3/4,-y+3/4",      {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, { 18,18,18 } },
+    { "z+3/4,x+1/4,-y+1/4",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 18, 6, 6 } },
+    { "-z+3/4,x+3/4,y+3/4",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, { 18,18,18 } },
+    { "z+3/4,-x+1/4,y+1/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 18, 6, 6 } },
+    { "-y+3/4,-z+3/4,-x+3/4",      {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, { 18,18,18 } },
+    { "-y+1/4,z+3/4,x+1/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  6,18, 6 } },
+    { "-z+1/2,-y,x",               {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 12, 0, 0 } },
+    { "y+1/4,-z+1/4,x+3/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, {  6, 6,18 } },
+    { "y+3/4,z+3/4,-x+3/4",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 18,18,18 } },
+    { "-z+1/2,y,-x",               {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 12, 0, 0 } },
+    { "z,-y,-x+1/2",               {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  0, 0,12 } },
+    { "-X+3/4,-Y+1/4,-Z+1/4",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, { 18, 6, 6 } },
+    { "Y+1/2,-X,-Z",               {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12, 0, 0 } },
+    { "X+3/4,Y+3/4,-Z+3/4",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18,18,18 } },
+    { "-X+3/4,Y+1/4,Z+1/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 18, 6, 6 } },
+    { "-Y+1/2,-X,Z",               {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 12, 0, 0 } },
+    { "X+3/4,-Y+3/4,Z+3/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18,18,18 } },
+    { "-Z+3/4,-X+1/4,-Y+1/4",      {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, { 18, 6, 6 } },
+    { "X+1/2,-Z,-Y",               {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12, 0, 0 } },
+    { "Z+3/4,X+3/4,-Y+3/4",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 18,18,18 } },
+    { "-Z+3/4,X+1/4,Y+1/4",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, { 18, 6, 6 } },
+    { "-X+1/2,-Z,Y",               { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 12, 0, 0 } },
+    { "Z+3/4,-X+3/4,Y+3/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 18,18,18 } },
+    { "-Y+3/4,-Z+1/4,-X+1/4",      {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, { 18, 6, 6 } },
+    { "-Y+1/4,Z+1/4,X+3/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  6, 6,18 } },
+    { "Y+1/4,-Z+3/4,X+1/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, {  6,18, 6 } },
+    { "Z+1/2,Y,X",                 {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, { 12, 0, 0 } },
+    { "Y+3/4,Z+1/4,-X+1/4",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, { 18, 6, 6 } },
+    { "-X+1/4,-Y+3/4,-Z+1/4",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  6,18, 6 } },
+    { "X+1/4,Y+1/4,-Z+3/4",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6, 6,18 } },
+    { "-X+1/4,Y+3/4,Z+1/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  6,18, 6 } },
+    { "X+1/4,-Y+1/4,Z+3/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6, 6,18 } },
+    { "-Z+1/4,-X+3/4,-Y+1/4",      {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, {  6,18, 6 } },
+    { "Z+1/4,X+1/4,-Y+3/4",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  6, 6,18 } },
+    { "-Z+1/4,X+3/4,Y+1/4",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, {  6,18, 6 } },
+    { "Z+1/4,-X+1/4,Y+3/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  6, 6,18 } },
+    { "-Y+1/4,-Z+3/4,-X+1/4",      {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, {  6,18, 6 } },
+    { "-Y+3/4,Z+3/4,X+3/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 18,18,18 } },
+    { "-Z,-Y,X+1/2",               {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  0, 0,12 } },
+    { "Y+3/4,-Z+1/4,X+1/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 18, 6, 6 } },
+    { "Y+1/4,Z+3/4,-X+1/4",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, {  6,18, 6 } },
+    { "-Z,Y,-X+1/2",               {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, {  0, 0,12 } },
+    { "-X+1/4,-Y+1/4,-Z+3/4",      { -1, 0, 0, 0,-1, 0, 0, 0,-1 }, {  6, 6,18 } },
+    { "X+1/4,Y+3/4,-Z+1/4",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6,18, 6 } },
+    { "-X+1/4,Y+1/4,Z+3/4",        { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, {  6, 6,18 } },
+    { "X+1/4,-Y+3/4,Z+1/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6,18, 6 } },
+    { "-Z+1/4,-X+1/4,-Y+3/4",      {  0, 0,-1,-1, 0, 0, 0,-1, 0 }, {  6, 6,18 } },
+    { "Z+1/4,X+3/4,-Y+1/4",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  6,18, 6 } },
+    { "-Z+1/4,X+1/4,Y+3/4",        {  0, 0,-1, 1, 0, 0, 0, 1, 0 }, {  6, 6,18 } },
+    { "Z+1/4,-X+3/4,Y+1/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, {  6,18, 6 } },
+    { "-Y+1/4,-Z+1/4,-X+3/4",      {  0,-1, 0, 0, 0,-1,-1, 0, 0 }, {  6, 6,18 } },
+    { "-Y+3/4,Z+1/4,X+1/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 18, 6, 6 } },
+    { "Y+3/4,-Z+3/4,X+3/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, { 18,18,18 } },
+    { "Y+1/4,Z+1/4,-X+3/4",        {  0, 1, 0, 0, 0, 1,-1, 0, 0 }, {  6, 6,18 } },
+    { "-y+1/2,x+1/4,z+1/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12, 6, 6 } },
+    { "-x+1/4,-y+3/4,z+1/2",       { -1, 0, 0, 0,-1, 0, 0, 0, 1 }, {  6,18,12 } },
+    { "y+3/4,-x+1/2,z+3/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 18,12,18 } },
+    { "y+1/4,x+1/4,-z+1/2",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  6, 6,12 } },
+    { "-x+1/4,y+1/2,-z+3/4",       { -1, 0, 0, 0, 1, 0, 0, 0,-1 }, {  6,12,18 } },
+    { "-x+1/2,z+1/4,y+1/4",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12, 6, 6 } },
+    { "-z+1/4,-x+3/4,y+1/2",       {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, {  6,18,12 } },
+    { "x+3/4,-z+1/2,y+3/4",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18,12,18 } },
+    { "x+1/4,z+1/4,-y+1/2",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6, 6,12 } },
+    { "-z+1/4,x+1/2,-y+3/4",       {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, {  6,12,18 } },
+    { "y+1/2,-z+1/4,-x+3/4",       {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, { 12, 6,18 } },
+    { "z+1/4,y+3/4,-x",            {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, {  6,18, 0 } },
+    { "-y+3/4,z+1/2,-x+1/4",       {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, { 18,12, 6 } },
+    { "z+1/4,-y,x+3/4",            {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  6, 0,18 } },
+    { "-z,y+3/4,x+1/4",            {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  0,18, 6 } },
+    { "y+1/2,-x+3/4,-z+3/4",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12,18,18 } },
+    { "x+3/4,y+1/4,-z+1/2",        {  1, 0, 0, 0, 1, 0, 0, 0,-1 }, { 18, 6,12 } },
+    { "-y+1/4,x+1/2,-z+1/4",       {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  6,12, 6 } },
+    { "-y+3/4,-x+3/4,z+1/2",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 18,18,12 } },
+    { "x+3/4,-y+1/2,z+1/4",        {  1, 0, 0, 0,-1, 0, 0, 0, 1 }, { 18,12, 6 } },
+    { "x+1/2,-z+3/4,-y+3/4",       {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12,18,18 } },
+    { "z+3/4,x+1/4,-y+1/2",        {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, { 18, 6,12 } },
+    { "-x+1/4,z+1/2,-y+1/4",       { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6,12, 6 } },
+    { "-x+3/4,-z+3/4,y+1/2",       { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18,18,12 } },
+    { "z+3/4,-x+1/2,y+1/4",        {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 18,12, 6 } },
+    { "-y+1/2,z+3/4,x+1/4",        {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, { 12,18, 6 } },
+    { "-z+3/4,-y+1/4,x",           {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 18, 6, 0 } },
+    { "y+1/4,-z+1/2,x+3/4",        {  0, 1, 0, 0, 0,-1, 1, 0, 0 }, {  6,12,18 } },
+    { "-z+3/4,y,-x+1/4",           {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 18, 0, 6 } },
+    { "z,-y+1/4,-x+3/4",           {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  0, 6,18 } },
+    { "-Y+1/2,X+3/4,Z+3/4",        {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, { 12,18,18 } },
+    { "Y+3/4,-X,Z+1/4",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, { 18, 0, 6 } },
+    { "Y+1/4,X+3/4,-Z",            {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, {  6,18, 0 } },
+    { "-X+1/2,Z+3/4,Y+3/4",        { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, { 12,18,18 } },
+    { "X+3/4,-Z,Y+1/4",            {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18, 0, 6 } },
+    { "X+1/4,Z+3/4,-Y",            {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6,18, 0 } },
+    { "Z+1/4,Y+1/4,-X+1/2",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, {  6, 6,12 } },
+    { "-Z+1/2,-Y,-X",              {  0, 0,-1, 0,-1, 0,-1, 0, 0 }, { 12, 0, 0 } },
+    { "Z+1/4,-Y+1/2,X+1/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, {  6,12, 6 } },
+    { "-Z,Y+1/4,X+3/4",            {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, {  0, 6,18 } },
+    { "Y+1/2,-X+1/4,-Z+1/4",       {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, { 12, 6, 6 } },
+    { "-Y+1/4,X,-Z+3/4",           {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, {  6, 0,18 } },
+    { "-Y+3/4,-X+1/4,Z",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, { 18, 6, 0 } },
+    { "X+1/2,-Z+1/4,-Y+1/4",       {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 12, 6, 6 } },
+    { "-X+1/4,Z,-Y+3/4",           { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, {  6, 0,18 } },
+    { "-X+3/4,-Z+1/4,Y",           { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18, 6, 0 } },
+    { "-Z+3/4,-Y+3/4,X+1/2",       {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, { 18,18,12 } },
+    { "-Z+3/4,Y+1/2,-X+3/4",       {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, { 18,12,18 } },
+    { "Z,-Y+3/4,-X+1/4",           {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  0,18, 6 } },
+    { "-Y,X+1/4,Z+3/4",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0, 6,18 } },
+    { "Y+1/4,-X+1/2,Z+1/4",        {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  6,12, 6 } },
+    { "Y+3/4,X+1/4,-Z",            {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 18, 6, 0 } },
+    { "-X,Z+1/4,Y+3/4",            { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0, 6,18 } },
+    { "X+1/4,-Z+1/2,Y+1/4",        {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6,12, 6 } },
+    { "X+3/4,Z+1/4,-Y",            {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18, 6, 0 } },
+    { "Z+3/4,Y+3/4,-X+1/2",        {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 18,18,12 } },
+    { "Z+3/4,-Y,X+1/4",            {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 18, 0, 6 } },
+    { "-Z+1/2,Y+3/4,X+3/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 12,18,18 } },
+    { "Y,-X+3/4,-Z+1/4",           {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0,18, 6 } },
+    { "-Y+3/4,X+1/2,-Z+3/4",       {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 18,12,18 } },
+    { "-Y+1/4,-X+3/4,Z",           {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  6,18, 0 } },
+    { "X,-Z+3/4,-Y+1/4",           {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0,18, 6 } },
+    { "-X+3/4,Z+1/2,-Y+3/4",       { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18,12,18 } },
+    { "-X+1/4,-Z+3/4,Y",           { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6,18, 0 } },
+    { "-Z+1/4,-Y+1/4,X+1/2",       {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  6, 6,12 } },
+    { "-Z+1/4,Y,-X+3/4",           {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, {  6, 0,18 } },
+    { "Z+1/2,-Y+1/4,-X+1/4",       {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 12, 6, 6 } },
+    { "-Y,X+3/4,Z+1/4",            {  0,-1, 0, 1, 0, 0, 0, 0, 1 }, {  0,18, 6 } },
+    { "Y+1/4,-X,Z+3/4",            {  0, 1, 0,-1, 0, 0, 0, 0, 1 }, {  6, 0,18 } },
+    { "Y+3/4,X+3/4,-Z+1/2",        {  0, 1, 0, 1, 0, 0, 0, 0,-1 }, { 18,18,12 } },
+    { "-X,Z+3/4,Y+1/4",            { -1, 0, 0, 0, 0, 1, 0, 1, 0 }, {  0,18, 6 } },
+    { "X+1/4,-Z,Y+3/4",            {  1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6, 0,18 } },
+    { "X+3/4,Z+3/4,-Y+1/2",        {  1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18,18,12 } },
+    { "Z+3/4,Y+1/4,-X",            {  0, 0, 1, 0, 1, 0,-1, 0, 0 }, { 18, 6, 0 } },
+    { "Z+3/4,-Y+1/2,X+3/4",        {  0, 0, 1, 0,-1, 0, 1, 0, 0 }, { 18,12,18 } },
+    { "-Z+1/2,Y+1/4,X+1/4",        {  0, 0,-1, 0, 1, 0, 1, 0, 0 }, { 12, 6, 6 } },
+    { "Y,-X+1/4,-Z+3/4",           {  0, 1, 0,-1, 0, 0, 0, 0,-1 }, {  0, 6,18 } },
+    { "-Y+3/4,X,-Z+1/4",           {  0,-1, 0, 1, 0, 0, 0, 0,-1 }, { 18, 0, 6 } },
+    { "-Y+1/4,-X+1/4,Z+1/2",       {  0,-1, 0,-1, 0, 0, 0, 0, 1 }, {  6, 6,12 } },
+    { "X,-Z+1/4,-Y+3/4",           {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  0, 6,18 } },
+    { "-X+3/4,Z,-Y+1/4",           { -1, 0, 0, 0, 0, 1, 0,-1, 0 }, { 18, 0, 6 } },
+    { "-X+1/4,-Z+1/4,Y+1/2",       { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6, 6,12 } },
+    { "-Z+1/4,-Y+3/4,X",           {  0, 0,-1, 0,-1, 0, 1, 0, 0 }, {  6,18, 0 } },
+    { "-Z+1/4,Y+1/2,-X+1/4",       {  0, 0,-1, 0, 1, 0,-1, 0, 0 }, {  6,12, 6 } },
+    { "Z+1/2,-Y+3/4,-X+3/4",       {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 12,18,18 } },
+    { "x+3/4,-z+1/4,-y+3/4",       {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, { 18, 6,18 } },
+    { "-x+3/4,-z+1/4,y+1/4",       { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, { 18, 6, 6 } },
+    { "z+1/2,-x,y",                {  0, 0, 1,-1, 0, 0, 0, 1, 0 }, { 12, 0, 0 } },
+    { "z+3/4,y+3/4,x+3/4",         {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, { 18,18,18 } },
+    { "z+1/4,-y+3/4,-x+1/4",       {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, {  6,18, 6 } },
+    { "X+1/4,-Z+3/4,-Y+1/4",       {  1, 0, 0, 0, 0,-1, 0,-1, 0 }, {  6,18, 6 } },
+    { "Z,X+1/2,-Y",                {  0, 0, 1, 1, 0, 0, 0,-1, 0 }, {  0,12, 0 } },
+    { "-X+1/4,-Z+3/4,Y+3/4",       { -1, 0, 0, 0, 0,-1, 0, 1, 0 }, {  6,18,18 } },
+    { "-Y,Z,X+1/2",                {  0,-1, 0, 0, 0, 1, 1, 0, 0 }, {  0, 0,12 } },
+    { "Z+1/4,Y+1/4,X+1/4",         {  0, 0, 1, 0, 1, 0, 1, 0, 0 }, {  6, 6, 6 } },
+    { "Z+3/4,-Y+1/4,-X+3/4",       {  0, 0, 1, 0,-1, 0,-1, 0, 0 }, { 18, 6,18 } },
+    { "-Z,-X,Y+1/2",               {  0, 0,-1,-1, 0, 0, 0, 1, 0 }, {  0, 0,12 } },
+    { "Z+1/2,-X,-Y",               {  0, 0, 1,-1, 0, 0, 0,-1, 0 }, { 12, 0, 0 } },
+    { "-Z,X+1/2,-Y",               {  0, 0,-1, 1, 0, 0, 0,-1, 0 }, {  0,12, 0 } },
+    { "Y+1/2,-Z,-X",               {  0, 1, 0, 0, 0,-1,-1, 0, 0 }, { 12, 0, 0 } },
+    { "-Y,Z+1/2,-X",               {  0,-1, 0, 0, 0, 1,-1, 0, 0 }, {  0,12, 0 } },
+    { "-Y,-Z,X+1/2",               {  0,-1, 0, 0, 0,-1, 1, 0, 0 }, {  0, 0,12 } }
+  };
+
+  short const SymInfoOpList[nSymInfoOpList] = {
+       0,   0,   1,   0,   2,   0,   3,   0,   4,   0,   5,   0,
+       6,   0,   7,   0,   2,   8,   9,   0,   2,  10,  11,   0,
+       2,  12,  13,   0,   3,  10,  14,   0,   3,  15,  16,   0,
+       3,  12,  17,   0,   4,  15,  18,   0,   4,   8,  19,   0,
+       4,  12,  20,   0,  21,   0,  22,   0,  23,   0,  24,   0,
+      25,   0,  26,   0,  27,   0,  28,   0,  29,   0,  30,   0,
+      31,   0,  32,   0,  21,   8,  33,   0,  21,  10,  34,   0,
+      21,  12,  35,   0,  22,  10,  36,   0,  22,  15,  37,   0,
+      22,  12,  38,   0,  23,  15,  39,   0,  23,   8,  40,   0,
+      23,  12,  41,   0,  24,   8,  35,   0,  25,  10,  33,   0,
+      26,  12,  34,   0,  26,  10,  35,   0,  42,   8,  43,   0,
+      24,  12,  33,   0,  27,  10,  38,   0,  28,  15,  36,   0,
+      29,  12,  37,   0,  29,  15,  38,   0,  28,  10,  37,   0,
+      27,  12,  36,   0,  30,  15,  41,   0,  31,   8,  39,   0,
+      32,  12,  40,   0,  32,   8,  41,   0,  31,  15,  40,   0,
+      30,  12,  39,   0,   2,   1,  21,   0,   3,   1,  22,   0,
+       4,   1,  23,   0,   5,   1,  44,   0,   6,   1,  45,   0,
+       7,   1,  46,   0,   2,   1,  21,   8,   9,  47,  33,   0,
+       2,   1,  21,  10,  11,  48,  34,   0,   2,   1,  21,  12,
+      13,  49,  35,   0,   3,   1,  22,  10,  14,  48,  36,   0,
+       3,   1,  22,  15,  16,  50,  37,   0,   3,   1,  22,  12,
+      17,  49,  38,   0,   4,   1,  23,  15,  18,  50,  39,   0,
+       4,   1,  23,   8,  19,  47,  40,   0,   4,   1,  23,  12,
+      20,  49,  41,   0,  51,   1,  24,   0,  52,   1,  25,   0,
+      53,   1,  26,   0,  54,   1,  27,   0,  55,   1,  28,   0,
+      56,   1,  29,   0,  57,   1,  30,   0,  58,   1,  31,   0,
+      59,   1,  32,   0,  60,   1,  42,   0,  61,   1,  62,   0,
+      63,   1,  64,   0,  65,   1,  66,   0,  67,   1,  68,   0,
+      69,   1,  70,   0,  71,   1,  72,   0,  73,   1,  74,   0,
+      75,   1,  76,   0,  51,   1,  24,   8,  13,  47,  35,   0,
+      52,   1,  25,  10,   9,  48,  33,   0,  53,   1,  26,  12,
+      11,  49,  34,   0,  53,   1,  26,  10,  13,  48,  35,   0,
+      52,  77,  42,   8,  11,  78,  43,   0,  51,   1,  24,  12,
+       9,  49,  33,   0,  54,   1,  27,  10,  17,  48,  38,   0,
+      55,   1,  28,  15,  14,  50,  36,   0,  56,   1,  29,  12,
+      16,  49,  37,   0,  56,   1,  29,  15,  17,  50,  38,   0,
+      55,   1,  28,  10,  16,  48,  37,   0,  54,   1,  27,  12,
+      14,  49,  36,   0,  57,   1,  30,  15,  20,  50,  41,   0,
+      58,   1,  31,   8,  18,  47,  39,   0,  59,   1,  32,  12,
+      19,  49,  40,   0,  59,   1,  32,   8,  20,  47,  41,   0,
+      58,   1,  31,  15,  19,  50,  40,   0,  57,   1,  30,  12,
+      18,  49,  39,   0,   3,   4,   2,   0,   6,   4,  51,   0,
+       7,   2,  54,   0,   5,   3,  57,   0,   3,  71,  63,   0,
+       4,  60,  69,   0,   2,  65,  75,   0,  65,  71,  60,   0,
+       6,   4,  51,   8,  17,  19,  13,   0,   7,   2,  54,  10,
+      20,  11,  17,   0,   5,   3,  57,  15,  13,  16,  20,   0,
+       3,   4,   2,   8,  79,  19,   9,   0,   4,   2,   3,  10,
+      80,  11,  14,   0,   2,   3,   4,  15,  81,  16,  18,   0,
+       3,   4,   2,  10,  14,  80,  11,  15,  16,  18,  81,   8,
+      79,  19,   9,   0,   3,   4,   2,  12,  17,  20,  13,   0,
+      56,  59,  60,  12,  16,  19,  82,   0,   3,  23,  21,   0,
+       4,  21,  22,   0,   2,  22,  23,   0,   6,  23,  24,   0,
+       6,  21,  32,   0,   7,  21,  27,   0,   7,  22,  26,   0,
+       5,  22,  30,   0,   5,  23,  29,   0,   3,  32,  24,   0,
+       4,  26,  27,   0,   2,  29,  30,   0,   3,  46,  26,   0,
+       3,  44,  30,   0,   4,  44,  29,   0,   4,  45,  24,   0,
+       2,  45,  32,   0,   2,  46,  27,   0,   6,  76,  26,   0,
+       6,  42,  30,   0,   7,  64,  29,   0,   7,  66,  24,   0,
+       5,  70,  32,   0,   5,  72,  27,   0,   3,  31,  42,   0,
+       3,  25,  76,   0,   4,  25,  66,   0,   4,  28,  64,   0,
+       2,  28,  72,   0,   2,  31,  70,   0,  65,  23,  25,   0,
+      69,  21,  31,   0,  71,  21,  28,   0,  75,  22,  25,   0,
+      60,  22,  31,   0,  63,  23,  28,   0,   3,  72,  64,   0,
+       4,  42,  70,   0,   2,  66,  76,   0,   6,  74,  64,   0,
+       6,  62,  72,   0,   7,  62,  70,   0,   7,  68,  42,   0,
+       5,  68,  76,   0,   5,  74,  66,   0,   3,  74,  62,   0,
+       4,  62,  68,   0,   2,  68,  74,   0,   3,  23,  21,   8,
+      79,  40,  33,   0,   4,  21,  22,  10,  80,  34,  36,   0,
+       2,  22,  23,  15,  81,  37,  39,   0,   6,  23,  24,   8,
+      17,  40,  35,   0,   6,  21,  32,   8,  17,  33,  41,   0,
+       7,  21,  27,  10,  20,  34,  38,   0,   7,  22,  26,  10,
+      20,  36,  35,   0,   5,  22,  30,  15,  13,  37,  41,   0,
+       5,  23,  29,  15,  13,  39,  38,   0,   3,  32,  24,   8,
+      79,  41,  35,   0,   4,  26,  27,  10,  80,  35,  38,   0,
+       2,  29,  30,  15,  81,  38,  41,   0,   3,  23,  21,  10,
+      14,  83,  34,   0,   3,  21,  23,  15,  16,  43,  39,   0,
+       4,  21,  22,  15,  18,  43,  37,   0,   4,  22,  21,   8,
+      19,  84,  33,   0,   2,  22,  23,   8,   9,  84,  40,   0,
+       2,  23,  22,  10,  11,  83,  36,   0,   3,  30,  44,  10,
+      14,  85,  86,   0,   3,  26,  46,  15,  16,  86,  85,   0,
+       4,  24,  45,  15,  18,  87,  88,   0,   4,  29,  44,   8,
+      19,  88,  87,   0,   2,  27,  46,   8,   9,  89,  90,   0,
+       2,  32,  45,  10,  11,  90,  89,   0,   3,  46,  26,  10,
+      14,  41,  35,   0,   3,  44,  30,  15,  16,  35,  41,   0,
+       4,  44,  29,  15,  18,  35,  38,   0,   4,  45,  24,   8,
+      19,  38,  35,   0,   2,  45,  32,   8,   9,  38,  41,   0,
+       2,  46,  27,  10,  11,  41,  38,   0,   3,  72,  64,  10,
+      14,  39,  43,   0,   3,  64,  72,  15,  16,  34,  83,   0,
+       4,  42,  70,  15,  18,  33,  84,   0,   4,  70,  42,   8,
+      19,  37,  43,   0,   2,  66,  76,   8,   9,  36,  83,   0,
+       2,  76,  66,  10,  11,  40,  84,   0,   3,  23,  21,  10,
+      14,  83,  34,  15,  16,  39,  43,   8,  79,  40,  33,   0,
+       4,  21,  22,  15,  18,  43,  37,   8,  19,  33,  84,  10,
+      80,  34,  36,   0,   2,  22,  23,   8,   9,  84,  40,  10,
+      11,  36,  83,  15,  81,  37,  39,   0,   3,  91,  92,  10,
+      14,  93,  94,  15,  16,  95,  96,   8,  79,  97,  98,   0,
+       4,  99, 100,  15,  18,  94, 101,   8,  19, 102, 103,  10,
+      80,  96, 104,   0,   2, 105, 106,   8,   9, 101,  93,  10,
+      11, 107,  97,  15,  81, 103, 108,   0,   3,  23,  21,  12,
+      17,  41,  35,   0,   4,  21,  22,  12,  20,  35,  38,   0,
+       2,  22,  23,  12,  13,  38,  41,   0,   3,  32,  24,  12,
+      17,  40,  33,   0,   4,  26,  27,  12,  20,  34,  36,   0,
+       2,  29,  30,  12,  13,  37,  39,   0,   3,  46,  26,  12,
+      17,  83,  34,   0,   3,  44,  30,  12,  17,  43,  39,   0,
+       4,  44,  29,  12,  20,  43,  37,   0,   4,  45,  24,  12,
+      20,  84,  33,   0,   2,  45,  32,  12,  13,  84,  40,   0,
+       2,  46,  27,  12,  13,  83,  36,   0,   3,   4,   2,   1,
+      22,  23,  21,   0,   3,   4,   2, 109,  68,  74,  62,   0,
+      55,  58,  52,   1,  28,  31,  25,   0,   3,  59,  51,   1,
+      22,  32,  24,   0,   4,  53,  54,   1,  23,  26,  27,   0,
+       2,  56,  57,   1,  21,  29,  30,   0,   3,   4,   2,  77,
+      28,  72,  64,   0,  55,  57,  53,   1,  28,  30,  26,   0,
+       4,   2,   3, 110,  31,  42,  70,   0,  58,  51,  56,   1,
+      31,  24,  29,   0,   2,   3,   4, 111,  25,  66,  76,   0,
+      52,  54,  59,   1,  25,  27,  32,   0,  54,   7,   2,   1,
+      27,  46,  21,   0,  56,   5,   4,   1,  29,  44,  23,   0,
+      57,   5,   3,   1,  30,  44,  22,   0,  59,   6,   2,   1,
+      32,  45,  21,   0,  51,   6,   4,   1,  24,  45,  23,   0,
+      53,   7,   3,   1,  26,  46,  22,   0,  54,  58,  61,   1,
+      27,  31,  62,   0,  56,  52,  73,   1,  29,  25,  74,   0,
+      57,  52,  67,   1,  30,  25,  68,   0,  59,  55,  61,   1,
+      32,  28,  62,   0,  51,  55,  73,   1,  24,  28,  74,   0,
+      53,  58,  67,   1,  26,  31,  68,   0,  65,   4,  52,   1,
+      66,  23,  25,   0,  69,   2,  58,   1,  70,  21,  31,   0,
+      71,   2,  55,   1,  72,  21,  28,   0,  75,   3,  52,   1,
+      76,  22,  25,   0,  60,   3,  58,   1,  42,  22,  31,   0,
+      63,   4,  55,   1,  64,  23,  28,   0,  54,  75,  51,   1,
+      27,  76,  24,   0,  56,  60,  59,   1,  29,  42,  32,   0,
+      57,  63,  54,   1,  30,  64,  27,   0,  59,  65,  53,   1,
+      32,  66,  26,   0,  51,  69,  57,   1,  24,  70,  30,   0,
+      53,  71,  56,   1,  26,  72,  29,   0,   3,  71,  63,   1,
+      22,  72,  64,   0,   4,  60,  69,   1,  23,  42,  70,   0,
+       2,  65,  75,   1,  21,  66,  76,   0,  55,  75,  60,   1,
+      28,  76,  42,   0,  58,  63,  65,   1,  31,  64,  66,   0,
+      52,  69,  71,   1,  25,  70,  72,   0,   6,  57,  60,   1,
+      45,  30,  42,   0,   6,  53,  75,   1,  45,  26,  76,   0,
+       7,  51,  65,   1,  46,  24,  66,   0,   7,  56,  63,   1,
+      46,  29,  64,   0,   5,  54,  71,   1,  44,  27,  72,   0,
+       5,  59,  69,   1,  44,  32,  70,   0,   3,  73,  61,   1,
+      22,  74,  62,   0,   4,  61,  67,   1,  23,  62,  68,   0,
+       2,  67,  73,   1,  21,  68,  74,   0,   3,  71,  63,  77,
+      28,  23,  21,   0,  55,   7,   5,   1,  28,  46,  44,   0,
+       4,  60,  69, 110,  31,  21,  22,   0,  58,   5,   6,   1,
+      31,  44,  45,   0,   2,  65,  75, 111,  25,  22,  23,   0,
+      52,   6,   7,   1,  25,  45,  46,   0,  67,  71,  51,   1,
+      68,  72,  24,   0,  67,  63,  59,   1,  68,  64,  32,   0,
+      73,  60,  54,   1,  74,  42,  27,   0,  73,  69,  53,   1,
+      74,  70,  26,   0,  61,  65,  57,   1,  62,  66,  30,   0,
+      61,  75,  56,   1,  62,  76,  29,   0,  65,  71,  60,   1,
+      66,  72,  42,   0,  75,  69,  63,   1,  76,  70,  64,   0,
+      65,  73,   5,   1,  66,  74,  44,   0,  69,  61,   7,   1,
+      70,  62,  46,   0,  71,  61,   6,   1,  72,  62,  45,   0,
+      75,  67,   5,   1,  76,  68,  44,   0,  60,  67,   7,   1,
+      42,  68,  46,   0,  63,  73,   6,   1,  64,  74,  45,   0,
+       6,   4,  51,   1,  45,  23,  24,   8,  17,  19,  13,  47,
+      38,  40,  35,   0,   6,   2,  59,   1,  45,  21,  32,   8,
+      17,   9,  20,  47,  38,  33,  41,   0,   7,   2,  54,   1,
+      46,  21,  27,  10,  20,  11,  17,  48,  41,  34,  38,   0,
+       7,   3,  53,   1,  46,  22,  26,  10,  20,  14,  13,  48,
+      41,  36,  35,   0,   5,   3,  57,   1,  44,  22,  30,  15,
+      13,  16,  20,  50,  35,  37,  41,   0,   5,   4,  56,   1,
+      44,  23,  29,  15,  13,  18,  17,  50,  35,  39,  38,   0,
+      65,   4,  52,   1,  66,  23,  25,   8,  14,  19,  11,  47,
+      36,  40,  34,   0,  69,   2,  58,   1,  70,  21,  31,   8,
+      16,   9,  18,  47,  37,  33,  39,   0,  71,   2,  55,   1,
+      72,  21,  28,  10,  18,  11,  16,  48,  39,  34,  37,   0,
+      75,   3,  52,   1,  76,  22,  25,  10,  19,  14,   9,  48,
+      40,  36,  33,   0,  60,   3,  58,   1,  42,  22,  31,  15,
+       9,  16,  19,  50,  33,  37,  40,   0,  63,   4,  55,   1,
+      64,  23,  28,  15,  11,  18,  14,  50,  34,  39,  36,   0,
+       3,   4,   2,   1,  22,  23,  21,   8,  79,  19,   9,  47,
+      84,  40,  33,   0,   4,   2,   3,   1,  23,  21,  22,  10,
+      80,  11,  14,  48,  83,  34,  36,   0,   2,   3,   4,   1,
+      21,  22,  23,  15,  81,  16,  18,  50,  43,  37,  39,   0,
+       3,  59,  51,   1,  22,  32,  24,   8,  79,  20,  13,  47,
+      84,  41,  35,   0,   4,  53,  54,   1,  23,  26,  27,  10,
+      80,  13,  17,  48,  83,  35,  38,   0,   2,  56,  57,   1,
+      21,  29,  30,  15,  81,  17,  20,  50,  43,  38,  41,   0,
+      54,   4,  53,   1,  27,  23,  26,   8, 112,  19, 113,  47,
+      89,  40, 114,   0,  56,  57,   2,  77,  27,  46,  64,   8,
+     115, 116,   9,  78,  89,  90, 117,   0,  57,   2,  56,   1,
+      30,  21,  29,  10, 118,  11, 119,  48,  85,  34, 120,   0,
+      59,   3,  51,   1,  32,  22,  24,  10, 121,  14, 113,  48,
+      90,  36, 114,   0,  51,   3,  59,   1,  24,  22,  32,  15,
+      82,  16, 116,  50,  87,  37, 122,   0,  53,   4,  54,   1,
+      26,  23,  27,  15, 123,  18, 119,  50,  86,  39, 120,   0,
+      55,  71,   2, 110,  66,  76,  42,   8, 124, 125,   9,  50,
+      36,  83,  43,   0,  54,  75,  51,   1,  27,  76,  24,   8,
+     112,  80,  13,  47,  89,  83,  35,   0,  55,  71,   2, 110,
+      66,  76,  42,   8, 124, 125,   9,  50,  36,  83,  43,   0,
+      56,  73,  52,  77,  27,  32,  42,   8, 115, 118,  11,  78,
+      89,  41,  43,   0,  58,  60,   3, 111,  72,  64,  66,  10,
+     125, 126,  14,  47,  39,  43,  84,   0,  57,  63,  54,   1,
+      30,  64,  27,  10, 118,  81,  17,  48,  85,  43,  38,   0,
+      58,  60,   3, 111,  72,  64,  66,  10, 125, 126,  14,  47,
+      39,  43,  84,   0,  59,  65,  53,   1,  32,  66,  26,  10,
+     121,  79,  13,  48,  90,  84,  35,   0,  52,  65,   4,  77,
+      42,  70,  72,  15, 126, 124,  18,  48,  33,  84,  83,   0,
+      51,  69,  57,   1,  24,  70,  30,  15,  82,  79,  20,  50,
+      87,  84,  41,   0,  52,  65,   4,  77,  42,  70,  72,  15,
+     126, 124,  18,  48,  33,  84,  83,   0,  53,  71,  56,   1,
+      26,  72,  29,  15, 123,  80,  17,  50,  86,  83,  38,   0,
+       3,   4,   2,   1,  22,  23,  21,  10,  14,  80,  11,  48,
+      36,  83,  34,  15,  16,  18,  81,  50,  37,  39,  43,   8,
+      79,  19,   9,  47,  84,  40,  33,   0,  55,  58,  52, 127,
+     128, 129, 130,  10,  16, 125,   9, 131, 103, 108, 102,  15,
+      14,  19, 126, 132, 107,  97,  98,   8, 124,  18,  11, 133,
+     104,  95,  96,   0, 134, 135, 136,   1, 137, 138, 139,  10,
+     140, 141, 142,  48, 143, 144, 145,  15, 146, 147, 148,  50,
+     149, 150, 151,   8, 152, 153, 154,  47, 155, 156, 157,   0,
+       3,   4,   2,   1,  22,  23,  21,  12,  17,  20,  13,  49,
+      38,  41,  35,   0,   3,  59,  51,   1,  22,  32,  24,  12,
+      17,  19,   9,  49,  38,  40,  33,   0,   4,  53,  54,   1,
+      23,  26,  27,  12,  20,  11,  14,  49,  41,  34,  36,   0,
+       2,  56,  57,   1,  21,  29,  30,  12,  13,  16,  18,  49,
+      35,  37,  39,   0,  56,  59,  60,   1,  29,  32,  42,  12,
+      16,  19,  82,  49,  37,  40,  87,   0,  54,  57,  63, 109,
+      70,  76,  24,  12,  14,  18, 123,  78,  88,  90,  33,   0,
+      56,   4,   5,   1,  29,  23,  44,  12,  16,  20,  81,  49,
+      37,  41,  43,   0,  54,  58,  61, 109,  70,  46,  21,  12,
+      14, 116, 126,  78,  88,  83,  35,   0,  59,   2,   6,   1,
+      32,  21,  45,  12,  19,  13,  79,  49,  40,  35,  84,   0,
+      57,   3,   5,   1,  30,  22,  44,  12,  18,  17,  81,  49,
+      39,  38,  43,   0,  53,   3,   7,   1,  26,  22,  46,  12,
+      11,  17,  80,  49,  34,  38,  83,   0,  51,   4,   6,   1,
+      24,  23,  45,  12,   9,  20,  79,  49,  33,  41,  84,   0,
+     158,   3, 159,   0, 160,   6, 161,   0, 162,   3, 163,   0,
+     164,   6, 165,   0, 158,   3, 159,  12, 166,  17, 167,   0,
+     168,  67, 169,  12, 170, 124, 171,   0, 172,   3, 173,   0,
+     172,   3, 173,  12, 174,  17, 175,   0, 158,   3, 159,   1,
+     172,  22, 173,   0, 162,   3, 163,   1, 176,  22, 177,   0,
+     178,   3, 179,  77, 172,  28, 173,   0, 180,  55, 181,   1,
+     182,  28, 183,   0, 184,   3, 185, 109, 172,  68, 173,   0,
+     186,  55, 187,   1, 188,  28, 189,   0, 158,   3, 159,   1,
+     172,  22, 173,  12, 166,  17, 167,  49, 174,  38, 175,   0,
+     168,  67, 169, 190, 172, 191, 192,  12, 170, 124, 171, 193,
+     174, 194, 195,   0, 196,  65, 197,   1, 198,  66, 199,  12,
+     200, 112, 201,  49, 202,  89, 203,   0, 158,   3, 159,   4,
+     204,   2, 205,   0, 178,   3, 179,  71, 204,  63, 205,   0,
+     160,   6, 161,  59, 206,   2, 207,   0, 208,   6, 209, 210,
+     204, 211, 212,   0, 162,   3, 163,   4, 213,   2, 212,   0,
+     184,   3, 185,  73, 204,  61, 205,   0, 164,   6, 165,  59,
+     214,   2, 215,   0, 216,   6, 217, 218, 204, 219, 212,   0,
+     158,   3, 159,   4, 204,   2, 205,  12, 166,  17, 167,  20,
+     220,  13, 221,   0, 168,  67, 169, 222, 223, 224, 205,  12,
+     170, 124, 171, 225, 226, 227, 221,   0, 158,   3, 159,  23,
+     228,  21, 229,   0, 158,   3, 159,  72, 230,  64, 231,   0,
+     162,   3, 163,  32, 228,  24, 229,   0, 184,   3, 185,  74,
+     228,  62, 229,   0, 158,   3, 159,  32, 232,  24, 233,   0,
+     158,   3, 159,  74, 234,  62, 235,   0, 162,   3, 163,  23,
+     232,  21, 233,   0, 162,   3, 163,  72, 234,  64, 235,   0,
+     158,   3, 159,  23, 228,  21, 229,  12, 166,  17, 167,  41,
+     236,  35, 237,   0, 158,   3, 159,  32, 232,  24, 233,  12,
+     166,  17, 167,  40, 238,  33, 239,   0, 168,  67, 169,  23,
+     240,  62, 241,  12, 170, 124, 171,  41, 242, 117, 243,   0,
+     168,  67, 169,  32, 244,  64, 245,  12, 170, 124, 171,  40,
+     246,  86, 247,   0, 172,   3, 173,   4, 228,   2, 229,   0,
+     172,   3, 173,  59, 232,  51, 233,   0, 172,   3, 173,  71,
+     230,  63, 231,   0, 172,   3, 173,  73, 234,  61, 235,   0,
+     172,   3, 173,  23, 204,  21, 205,   0, 172,   3, 173,  32,
+     213,  24, 212,   0, 172,   3, 173,  72, 248,  64, 249,   0,
+     172,   3, 173,  74, 223,  62, 250,   0, 172,   3, 173,  23,
+     204,  21, 205,  12, 174,  17, 175,  41, 220,  35, 221,   0,
+     172,   3, 173,  32, 213,  24, 212,  12, 174,  17, 175,  40,
+     251,  33, 252,   0, 172,   3, 173,   4, 228,   2, 229,  12,
+     174,  17, 175,  20, 236,  13, 237,   0, 172,   3, 173, 222,
+     253, 254, 241,  12, 174,  17, 175, 225, 255, 256, 243,   0,
+     158,   3, 159,   4, 204,   2, 205,   1, 172,  22, 173,  23,
+     228,  21, 229,   0, 158,   3, 159,  59, 213,  51, 212,   1,
+     172,  22, 173,  32, 232,  24, 233,   0, 158,   3, 159,   4,
+     204,   2, 205,  77, 257,  28, 258,  72, 230,  64, 231,   0,
+     180,  55, 181,  57, 204,  53, 249,   1, 182,  28, 183,  30,
+     228,  26, 231,   0, 158,   3, 159,   4, 204,   2, 205, 109,
+     259,  68, 192,  74, 234,  62, 235,   0, 180,  55, 181,  58,
+     213,  52, 250,   1, 182,  28, 183,  31, 232,  25, 235,   0,
+     158,   3, 159,  71, 248,  63, 249,   1, 172,  22, 173,  72,
+     230,  64, 231,   0, 158,   3, 159,  73, 223,  61, 250,   1,
+     172,  22, 173,  74, 234,  62, 235,   0, 178,   3, 179,  71,
+     204,  63, 205,  77, 172,  28, 173,  23, 230,  21, 231,   0,
+     180,  55, 181,   7, 248,   5, 205,   1, 182,  28, 183,  46,
+     230,  44, 229,   0, 178,   3, 179,  73, 213,  61, 212,  77,
+     172,  28, 173,  32, 234,  24, 235,   0, 180,  55, 181,  75,
+     223,  60, 212,   1, 182,  28, 183,  76, 234,  42, 233,   0,
+     162,   3, 163,   4, 213,   2, 212,   1, 176,  22, 177,  23,
+     232,  21, 233,   0, 162,   3, 163,  59, 204,  51, 205,   1,
+     176,  22, 177,  32, 228,  24, 229,   0, 184,   3, 185,  59,
+     248,  51, 249, 109, 172,  68, 173,  72, 232,  64, 233,   0,
+     260,  55, 261,  57, 213,  53, 250,   1, 262,  28, 263,  30,
+     232,  26, 235,   0, 184,   3, 185,   4, 223,   2, 250, 109,
+     172,  68, 173,  74, 228,  62, 229,   0, 260,  55, 261,  58,
+     204,  52, 249,   1, 262,  28, 263,  31, 228,  25, 231,   0,
+     162,   3, 163,  71, 223,  63, 250,   1, 176,  22, 177,  72,
+     234,  64, 235,   0, 184,   3, 185,  73, 204,  61, 205,   1,
+     259,  22, 192,  74, 228,  62, 229,   0, 184,   3, 185,  73,
+     204,  61, 205, 109, 172,  68, 173,  23, 234,  21, 235,   0,
+     260,  55, 261,   7, 223,   5, 212,   1, 262,  28, 263,  46,
+     234,  44, 233,   0, 184,   3, 185,  71, 213,  63, 212, 109,
+     172,  68, 173,  32, 230,  24, 231,   0, 260,  55, 261,  75,
+     248,  60, 205,   1, 262,  28, 263,  76, 230,  42, 229,   0,
+     158,   3, 159,   4, 204,   2, 205,   1, 172,  22, 173,  23,
+     228,  21, 229,  12, 166,  17, 167,  20, 220,  13, 221,  49,
+     174,  38, 175,  41, 236,  35, 237,   0, 158,   3, 159,  59,
+     213,  51, 212,   1, 172,  22, 173,  32, 232,  24, 233,  12,
+     166,  17, 167,  19, 251,   9, 252,  49, 174,  38, 175,  40,
+     238,  33, 239,   0, 168,  67, 169, 222, 223, 224, 205, 190,
+     172, 191, 192,  23, 253,  62, 264,  12, 170, 124, 171, 225,
+     226, 227, 221, 193, 174, 194, 195,  41, 255, 117, 265,   0,
+     266,  65, 267,   4, 268,  52, 269,   1, 270,  66, 271,  23,
+     272,  25, 273,  12, 274, 112, 275,  20, 276, 113, 277,  49,
+     278,  89, 279,  41, 280, 114, 281,   0, 168,  67, 169, 282,
+     248, 283, 212, 190, 172, 191, 192,  32, 284,  64, 285,  12,
+     170, 124, 171, 286, 287, 288, 252, 193, 174, 194, 195,  40,
+     289,  86, 290,   0, 266,  65, 267,  59, 291,  53, 292,   1,
+     270,  66, 271,  32, 293,  26, 294,  12, 274, 112, 275,  19,
+     295,  11, 296,  49, 278,  89, 279,  40, 297,  34, 298,   0,
+     299, 300,   0, 301, 302,   0, 303, 304,   0, 299, 300, 305,
+     306, 307, 308, 309, 310,   0, 311, 312,   0, 299, 300,   1,
+     313, 314,   0, 299, 300,   1, 313, 314, 305, 306, 307, 315,
+     316, 317, 308, 309, 310, 318, 319, 320,   0, 311, 312,   1,
+     321, 322,   0, 299, 300, 205, 323, 324,   0, 299, 300, 204,
+     325, 326,   0, 301, 302, 327, 323, 328,   0, 301, 302, 204,
+     329, 330,   0, 303, 304, 331, 323, 332,   0, 303, 304, 204,
+     333, 334,   0, 299, 300, 204, 325, 326, 305, 306, 307, 335,
+     336, 337, 308, 309, 310, 338, 339, 340,   0, 311, 312, 205,
+     341, 342,   0, 299, 300, 228, 343, 344,   0, 299, 300, 229,
+     345, 346,   0, 299, 300, 232, 347, 348,   0, 299, 300, 233,
+     349, 350,   0, 299, 300, 228, 343, 344, 305, 306, 307, 351,
+     352, 353, 308, 309, 310, 354, 355, 356,   0, 311, 312, 229,
+     357, 358,   0, 299, 300, 232, 347, 348, 305, 306, 307, 359,
+     360, 361, 308, 309, 310, 362, 363, 364,   0, 311, 312, 235,
+     365, 366,   0, 299, 300, 205, 323, 324,   1, 313, 314, 229,
+     345, 346,   0, 299, 300, 212, 367, 368,   1, 313, 314, 233,
+     349, 350,   0, 299, 300, 204, 325, 326,   1, 313, 314, 228,
+     343, 344,   0, 299, 300, 213, 369, 370,   1, 313, 314, 232,
+     347, 348,   0, 299, 300, 204, 325, 326,   1, 313, 314, 228,
+     343, 344, 305, 306, 307, 335, 336, 337, 315, 316, 317, 351,
+     352, 353, 308, 309, 310, 338, 339, 340, 318, 319, 320, 354,
+     355, 356,   0, 311, 312, 205, 341, 342,   1, 321, 322, 229,
+     357, 358,   0, 299, 300, 213, 369, 370,   1, 313, 314, 232,
+     347, 348, 305, 306, 307, 371, 372, 373, 315, 316, 317, 359,
+     360, 361, 308, 309, 310, 374, 375, 376, 318, 319, 320, 362,
+     363, 364,   0, 311, 312, 250, 377, 378,   1, 321, 322, 235,
+     365, 366,   0, 379, 299,   3, 300, 380,   0, 381, 301,   6,
+     302, 382,   0, 383, 303,   6, 304, 384,   0, 385, 303,   3,
+     304, 386,   0, 387, 301,   3, 302, 388,   0, 389, 299,   6,
+     300, 390,   0, 391, 299,  22, 300, 392,   0, 379, 299,   3,
+     300, 380,   1, 391, 313,  22, 314, 392,   0, 389, 299,   6,
+     300, 390,   1, 393, 313,  45, 314, 394,   0, 379, 299,   3,
+     300, 380, 205, 326, 323, 204, 324, 325,   0, 381, 301,   6,
+     302, 382, 395, 326, 396, 397, 368, 333,   0, 383, 303,   6,
+     304, 384, 398, 326, 399, 400, 368, 329,   0, 385, 303,   3,
+     304, 386, 327, 326, 401, 400, 324, 329,   0, 387, 301,   3,
+     302, 388, 331, 326, 402, 397, 324, 333,   0, 389, 299,   6,
+     300, 390, 212, 326, 367, 204, 368, 325,   0, 379, 299,   3,
+     300, 380, 229, 344, 345, 228, 346, 343,   0, 379, 299,   3,
+     300, 380, 233, 348, 349, 232, 350, 347,   0, 389, 299,   6,
+     300, 390, 229, 348, 345, 232, 346, 347,   0, 389, 299,   6,
+     300, 390, 233, 344, 349, 228, 350, 343,   0, 391, 299,  22,
+     300, 392, 205, 344, 323, 228, 324, 343,   0, 393, 299,  45,
+     300, 394, 205, 348, 323, 232, 324, 347,   0, 391, 299,  22,
+     300, 392, 229, 326, 345, 204, 346, 325,   0, 393, 299,  45,
+     300, 394, 233, 326, 349, 204, 350, 325,   0, 379, 299,   3,
+     300, 380, 205, 326, 323, 204, 324, 325,   1, 391, 313,  22,
+     314, 392, 229, 344, 345, 228, 346, 343,   0, 379, 299,   3,
+     300, 380, 212, 370, 367, 213, 368, 369,   1, 391, 313,  22,
+     314, 392, 233, 348, 349, 232, 350, 347,   0, 389, 299,   6,
+     300, 390, 205, 370, 323, 213, 324, 369,   1, 393, 313,  45,
+     314, 394, 229, 348, 345, 232, 346, 347,   0, 389, 299,   6,
+     300, 390, 212, 326, 367, 204, 368, 325,   1, 393, 313,  45,
+     314, 394, 233, 344, 349, 228, 350, 343,   0,   3,   4,   2,
+     311, 403, 404, 405, 312, 406, 407, 408,   0,   3,   4,   2,
+     311, 403, 404, 405, 312, 406, 407, 408,  10,  14,  80,  11,
+     409, 410, 411, 412, 413, 414, 415, 416,  15,  16,  18,  81,
+     417, 418, 419, 420, 421, 422, 423, 424,   8,  79,  19,   9,
+     425, 426, 427, 428, 429, 430, 431, 432,   0,   3,   4,   2,
+     311, 403, 404, 405, 312, 406, 407, 408,  12,  17,  20,  13,
+     433, 434, 435, 436, 437, 438, 439, 440,   0,  65,  71,  60,
+     311, 441, 442, 443, 312, 444, 445, 446,   0,  56,  59,  60,
+     311, 447, 448, 443, 312, 449, 445, 446,  12,  16,  19,  82,
+     433, 418, 427, 450, 437, 430, 451, 452,   0,   3,   4,   2,
+     311, 403, 404, 405, 312, 406, 407, 408,   1,  22,  23,  21,
+     321, 453, 454, 455, 322, 456, 457, 458,   0,   3,   4,   2,
+     311, 403, 404, 405, 312, 406, 407, 408, 109,  68,  74,  62,
+     459, 460, 461, 462, 463, 464, 465, 466,   0,  55,  58,  52,
+     311, 467, 468, 469, 312, 470, 471, 472,   1,  28,  31,  25,
+     321, 473, 474, 475, 322, 476, 477, 478,   0,   3,   4,   2,
+     311, 403, 404, 405, 312, 406, 407, 408,   1,  22,  23,  21,
+     321, 453, 454, 455, 322, 456, 457, 458,  10,  14,  80,  11,
+     409, 410, 411, 412, 413, 414, 415, 416,  48,  36,  83,  34,
+     479, 480, 481, 482, 483, 484, 485, 486,  15,  16,  18,  81,
+     417, 418, 419, 420, 421, 422, 423, 424,  50,  37,  39,  43,
+     487, 488, 489, 490, 491, 492, 493, 494,   8,  79,  19,   9,
+     425, 426, 427, 428, 429, 430, 431, 432,  47,  84,  40,  33,
+     495, 496, 497, 498, 499, 500, 501, 502,   0,  55,  58,  52,
+     311, 467, 468, 469, 312, 470, 471, 472, 127, 128, 129, 130,
+     503, 504, 505, 506, 507, 508, 509, 510,  10,  16, 125,   9,
+     409, 418, 511, 428, 413, 512, 431, 424, 131, 103, 108, 102,
+     513, 514, 515, 516, 517, 518, 519, 520,  15,  14,  19, 126,
+     417, 410, 427, 521, 421, 430, 522, 416, 132, 107,  97,  98,
+     523, 524, 525, 526, 527, 528, 529, 530,   8, 124,  18,  11,
+     425, 531, 419, 412, 429, 422, 415, 532, 133, 104,  95,  96,
+     533, 534, 535, 536, 537, 538, 539, 540,   0, 134, 135, 136,
+     311, 541, 542, 543, 312, 544, 545, 546,   1, 137, 138, 139,
+     321, 547, 548, 549, 322, 550, 551, 552,  10, 140, 141, 142,
+     409, 553, 554, 555, 413, 556, 557, 558,  48, 143, 144, 145,
+     479, 559, 560, 561, 483, 562, 563, 564,  15, 146, 147, 148,
+     417, 565, 566, 567, 421, 568, 569, 570,  50, 149, 150, 151,
+     487, 571, 572, 573, 491, 574, 575, 576,   8, 152, 153, 154,
+     425, 577, 578, 579, 429, 580, 581, 582,  47, 155, 156, 157,
+     495, 583, 584, 585, 499, 586, 587, 588,   0,   3,   4,   2,
+     311, 403, 404, 405, 312, 406, 407, 408,   1,  22,  23,  21,
+     321, 453, 454, 455, 322, 456, 457, 458,  12,  17,  20,  13,
+     433, 434, 435, 436, 437, 438, 439, 440,  49,  38,  41,  35,
+     589, 590, 591, 592, 593, 594, 595, 596,   0,  65,  71,  60,
+     311, 441, 442, 443, 312, 444, 445, 446,   1,  66,  72,  42,
+     321, 597, 598, 599, 322, 600, 601, 602,   0,  56,  59,  60,
+     311, 447, 448, 443, 312, 449, 445, 446,   1,  29,  32,  42,
+     321, 603, 604, 599, 322, 605, 601, 602,  12,  16,  19,  82,
+     433, 418, 427, 450, 437, 430, 451, 452,  49,  37,  40,  87,
+     589, 488, 497, 606, 593, 500, 607, 608,   0, 158,   3, 159,
+       4, 204,   2, 205, 311, 609, 403, 610, 404, 611, 405, 342,
+     312, 406, 612, 407, 341, 408, 613, 614,   0, 184,   3, 185,
+       4, 223,   2, 250, 311, 615, 403, 616, 404, 617, 405, 378,
+     312, 406, 618, 407, 377, 408, 619, 620,   0, 158,   3, 159,
+       4, 204,   2, 205, 311, 609, 403, 610, 404, 611, 405, 342,
+     312, 406, 612, 407, 341, 408, 613, 614,  10, 621,  14, 622,
+      80, 623,  11, 624, 409, 625, 410, 626, 411, 627, 412, 628,
+     413, 414, 629, 415, 630, 416, 631, 632,  15, 633,  16, 634,
+      18, 635,  81, 636, 417, 637, 418, 638, 419, 639, 420, 640,
+     421, 422, 641, 423, 642, 424, 643, 644,   8, 645,  79, 646,
+      19, 251,   9, 252, 425, 647, 426, 648, 427, 649, 428, 650,
+     429, 430, 651, 431, 652, 432, 653, 654,   0, 655,  69, 656,
+       4, 657,  60, 658, 311, 659, 660, 661, 404, 662, 443, 663,
+     312, 664, 665, 666, 667, 408, 668, 669,  10, 200, 124, 275,
+      80, 670, 126, 277, 409, 671, 531, 672, 411, 673, 521, 674,
+     413, 430, 675, 423, 676, 416, 677, 678,  15, 274,  79, 201,
+      18, 276,   9, 679, 417, 680, 426, 681, 419, 682, 428, 683,
+     421, 512, 684, 415, 685, 424, 686, 687,   8, 688,  16, 689,
+      19, 690,  81, 691, 425, 692, 418, 693, 427, 694, 420, 695,
+     429, 414, 696, 522, 697, 432, 698, 699,   0, 158,   3, 159,
+       4, 204,   2, 205, 311, 609, 403, 610, 404, 611, 405, 342,
+     312, 406, 612, 407, 341, 408, 613, 614,  12, 166,  17, 167,
+      20, 220,  13, 221, 433, 700, 434, 701, 435, 702, 436, 703,
+     437, 438, 704, 439, 705, 440, 706, 707,   0, 708,  65, 709,
+      71, 291,  60, 292, 311, 710, 441, 711, 442, 712, 443, 713,
+     312, 444, 665, 445, 667, 446, 714, 715,   0, 266,  65, 267,
+      71, 716,  60, 717, 311, 718, 441, 719, 442, 720, 443, 721,
+     312, 444, 722, 445, 723, 446, 724, 725,   0, 266,  65, 267,
+      59, 291,  53, 292, 311, 718, 441, 719, 448, 712, 726, 713,
+     312, 444, 722, 445, 667, 446, 714, 715,  12, 274, 112, 275,
+      19, 295,  11, 296, 433, 680, 727, 672, 427, 728, 412, 729,
+     437, 730, 731, 451, 732, 452, 733, 734,   0, 172,   3, 173,
+       4, 228,   2, 229, 311, 735, 403, 736, 404, 737, 405, 358,
+     312, 406, 738, 407, 357, 408, 739, 740,   0, 172,   3, 173,
+       4, 228,   2, 229, 311, 735, 403, 736, 404, 737, 405, 358,
+     312, 406, 738, 407, 357, 408, 739, 740,  10, 741,  14, 742,
+      80, 743,  11, 744, 409, 745, 410, 746, 411, 747, 412, 748,
+     413, 414, 749, 415, 750, 416, 751, 752,  15, 753,  16, 754,
+      18, 755,  81, 756, 417, 757, 418, 758, 419, 759, 420, 760,
+     421, 422, 761, 423, 762, 424, 763, 764,   8, 765,  79, 766,
+      19, 238,   9, 239, 425, 767, 426, 768, 427, 769, 428, 770,
+     429, 430, 771, 431, 772, 432, 773, 774,   0, 172,   3, 173,
+       4, 228,   2, 229, 311, 735, 403, 736, 404, 737, 405, 358,
+     312, 406, 738, 407, 357, 408, 739, 740,  12, 174,  17, 175,
+      20, 236,  13, 237, 433, 775, 434, 776, 435, 777, 436, 778,
+     437, 438, 779, 439, 780, 440, 781, 782,   0, 259,   3, 192,
+       4, 234,   2, 235, 311, 783, 403, 784, 404, 785, 405, 366,
+     312, 406, 786, 407, 365, 408, 787, 788,   0, 182,  55, 183,
+       4, 789,  63, 790, 311, 791, 467, 792, 404, 793, 794, 795,
+     312, 470, 796, 471, 797, 408, 798, 788,  10, 174,  16, 799,
+      80, 236,  81, 800, 409, 775, 418, 801, 411, 777, 420, 802,
+     413, 512, 803, 431, 780, 416, 804, 805,  15, 806,  14, 175,
+      18, 807,  11, 237, 417, 808, 410, 776, 419, 809, 412, 778,
+     421, 430, 810, 522, 811, 424, 812, 813,   8, 814, 124, 815,
+      19, 816, 126, 817, 425, 818, 531, 819, 427, 820, 521, 821,
+     429, 422, 779, 415, 822, 432, 781, 823,   0, 824,  56, 271,
+      59, 825,  60, 294, 311, 826, 447, 827, 448, 828, 443, 829,
+     312, 449, 830, 445, 831, 446, 832, 833,  12, 834,  16, 279,
+      19, 835,  82, 298, 433, 836, 418, 837, 427, 838, 450, 839,
+     437, 430, 840, 451, 841, 452, 842, 843,   0, 158,   3, 159,
+       4, 204,   2, 205, 311, 609, 403, 610, 404, 611, 405, 342,
+     312, 406, 612, 407, 341, 408, 613, 614,   1, 172,  22, 173,
+      23, 228,  21, 229, 321, 735, 453, 736, 454, 737, 455, 358,
+     322, 456, 738, 457, 357, 458, 739, 740,   0, 158,   3, 159,
+       4, 204,   2, 205, 311, 609, 403, 610, 404, 611, 405, 342,
+     312, 406, 612, 407, 341, 408, 613, 614, 109, 259,  68, 192,
+      74, 234,  62, 235, 459, 783, 460, 784, 461, 785, 462, 366,
+     463, 464, 786, 465, 365, 466, 787, 788,   0, 180,  55, 181,
+      58, 213,  52, 250, 311, 844, 467, 845, 468, 846, 469, 378,
+     312, 470, 847, 471, 377, 472, 848, 849,   1, 182,  28, 183,
+      31, 232,  25, 235, 321, 791, 473, 792, 474, 850, 475, 366,
+     322, 476, 796, 477, 365, 478, 851, 852,   0, 184,   3, 185,
+       4, 223,   2, 250, 311, 615, 403, 616, 404, 617, 405, 378,
+     312, 406, 618, 407, 377, 408, 619, 620,   1, 259,  22, 192,
+      23, 234,  21, 235, 321, 783, 453, 784, 454, 785, 455, 366,
+     322, 456, 786, 457, 365, 458, 787, 788,   0, 184,   3, 185,
+       4, 223,   2, 250, 311, 615, 403, 616, 404, 617, 405, 378,
+     312, 406, 618, 407, 377, 408, 619, 620, 109, 172,  68, 173,
+      74, 228,  62, 229, 459, 735, 460, 736, 461, 737, 462, 358,
+     463, 464, 738, 465, 357, 466, 739, 740,   0, 186,  55, 187,
+      58, 248,  52, 205, 311, 853, 467, 854, 468, 855, 469, 342,
+     312, 470, 856, 471, 341, 472, 857, 858,   1, 188,  28, 189,
+      31, 230,  25, 229, 321, 859, 473, 860, 474, 861, 475, 358,
+     322, 476, 862, 477, 357, 478, 863, 864,   0, 158,   3, 159,
+       4, 204,   2, 205, 311, 609, 403, 610, 404, 611, 405, 342,
+     312, 406, 612, 407, 341, 408, 613, 614,   1, 172,  22, 173,
+      23, 228,  21, 229, 321, 735, 453, 736, 454, 737, 455, 358,
+     322, 456, 738, 457, 357, 458, 739, 740,  10, 621,  14, 622,
+      80, 623,  11, 624, 409, 625, 410, 626, 411, 627, 412, 628,
+     413, 414, 629, 415, 630, 416, 631, 632,  48, 741,  36, 742,
+      83, 743,  34, 744, 479, 745, 480, 746, 481, 747, 482, 748,
+     483, 484, 749, 485, 750, 486, 751, 752,  15, 633,  16, 634,
+      18, 635,  81, 636, 417, 637, 418, 638, 419, 639, 420, 640,
+     421, 422, 641, 423, 642, 424, 643, 644,  50, 753,  37, 754,
+      39, 755,  43, 756, 487, 757, 488, 758, 489, 759, 490, 760,
+     491, 492, 761, 493, 762, 494, 763, 764,   8, 645,  79, 646,
+      19, 251,   9, 252, 425, 647, 426, 648, 427, 649, 428, 650,
+     429, 430, 651, 431, 652, 432, 653, 654,  47, 765,  84, 766,
+      40, 238,  33, 239, 495, 767, 496, 768, 497, 769, 498, 770,
+     499, 500, 771, 501, 772, 502, 773, 774,   0, 180,  55, 181,
+       4, 865,  63, 866, 311, 844, 467, 845, 404, 867, 794, 868,
+     312, 470, 847, 471, 869, 408, 870, 620,   1, 182,  28, 183,
+      23, 789,  64, 790, 321, 791, 473, 792, 454, 793, 871, 795,
+     322, 476, 796, 477, 797, 458, 798, 788,  10, 166,  16, 872,
+      80, 220,  81, 873, 409, 700, 418, 874, 411, 702, 420, 875,
+     413, 512, 876, 431, 705, 416, 877, 878,  48, 174,  37, 799,
+      83, 236,  43, 800, 479, 775, 488, 801, 481, 777, 490, 802,
+     483, 879, 803, 501, 780, 486, 804, 805,  15, 880,  14, 167,
+      18, 287,  11, 221, 417, 881, 410, 701, 419, 882, 412, 703,
+     421, 430, 883, 522, 884, 424, 885, 886,  50, 806,  36, 175,
+      39, 807,  34, 237, 487, 808, 480, 776, 489, 809, 482, 778,
+     491, 500, 810, 887, 811, 494, 812, 813,   8, 888, 124, 889,
+      19, 890, 126, 891, 425, 892, 531, 893, 427, 894, 521, 895,
+     429, 422, 704, 415, 896, 432, 706, 897,  47, 814, 898, 815,
+      40, 816, 117, 817, 495, 818, 899, 819, 497, 820, 900, 821,
+     499, 492, 779, 485, 822, 502, 781, 823,   0, 655,  69, 656,
+      58, 901,   2, 292, 311, 659, 660, 661, 468, 902, 405, 713,
+     312, 664, 665, 666, 903, 472, 904, 715, 127, 172, 100, 189,
+     129, 905,  99, 229, 503, 735, 906, 860, 505, 907, 908, 358,
+     507, 909, 910, 911, 912, 510, 739, 913,  10, 200, 124, 275,
+     125, 690,  11, 691, 409, 671, 531, 672, 511, 694, 412, 695,
+     413, 430, 675, 423, 914, 424, 915, 916, 131, 741, 104, 766,
+     108, 238,  96, 744, 513, 745, 534, 768, 515, 769, 536, 748,
+     517, 528, 917, 918, 919, 520, 751, 774,  15, 274,  79, 201,
+      19, 920,  81, 921, 417, 680, 426, 681, 427, 922, 420, 923,
+     421, 512, 684, 415, 697, 416, 698, 699, 132, 753, 101, 195,
+      97, 924,  94, 756, 523, 757, 925, 926, 525, 927, 928, 760,
+     527, 518, 771, 539, 772, 530, 763, 929,   8, 688,  16, 689,
+      18, 670,   9, 277, 425, 692, 418, 693, 419, 673, 428, 674,
+     429, 414, 696, 522, 685, 532, 686, 687, 133, 765, 103, 742,
+      95, 743, 102, 239, 533, 767, 514, 746, 535, 747, 516, 770,
+     537, 930, 761, 529, 762, 540, 773, 752,   0, 931, 932, 933,
+     135, 934, 935, 205, 311, 936, 937, 938, 542, 939, 940, 342,
+     312, 941, 942, 943, 944, 546, 945, 946,   1, 947, 948, 949,
+     138, 950, 951, 229, 321, 952, 953, 954, 548, 955, 956, 358,
+     322, 957, 958, 959, 912, 552, 960, 961,  10, 962, 152, 963,
+     141, 964, 154, 624, 409, 965, 577, 966, 554, 967, 579, 628,
+     413, 568, 968, 969, 970, 558, 971, 972,  48, 973, 155, 974,
+     144, 975, 157, 744, 479, 976, 583, 977, 560, 978, 585, 748,
+     483, 574, 979, 980, 919, 564, 981, 982,  15, 983, 984, 985,
+     147, 986, 987, 636, 417, 988, 989, 990, 566, 991, 992, 640,
+     421, 556, 993, 581, 652, 570, 994, 995,  50, 996, 997, 998,
+     150, 999,1000, 756, 487,1001,1002,1003, 572,1004,1005, 760,
+     491, 562,1006, 587, 772, 576,1007,1008,   8,1009, 140,1010,
+     153,1011, 142, 252, 425,1012, 553,1013, 578,1014, 555, 650,
+     429,1015,1016, 569, 642, 582,1017,1018,  47,1019, 143,1020,
+     156,1021, 145, 239, 495,1022, 559,1023, 584,1024, 561, 770,
+     499,1025,1026, 575, 762, 588,1027,1028,   0, 655,  69, 656,
+       4, 657,  60, 658, 311, 659, 660, 661, 404, 662, 443, 663,
+     312, 664, 665, 666, 667, 408, 668, 669,1029, 259,1030, 183,
+    1031, 234,1032, 790,1033, 783,1034, 792,1035, 785,1036, 795,
+    1037,1038,1039,1040, 365,1041,1042,1043,  10, 200, 124, 275,
+      80, 670, 126, 277, 409, 671, 531, 672, 411, 673, 521, 674,
+     413, 430, 675, 423, 676, 416, 677, 678,1044,1045,1046, 799,
+    1047,1048,1049, 800,1050,1051,1052, 801,1053,1054,1055, 802,
+    1056,1057, 779,1058,1059,1060, 781, 813,  15, 274,  79, 201,
+      18, 276,   9, 679, 417, 680, 426, 681, 419, 682, 428, 683,
+     421, 512, 684, 415, 685, 424, 686, 687,1061, 814,1062, 175,
+    1063, 816,1064, 237,1065, 818,1066, 776,1067, 820,1068, 778,
+    1069,1070,1071,1072, 822,1073,1074, 805,   8, 688,  16, 689,
+      19, 690,  81, 691, 425, 692, 418, 693, 427, 694, 420, 695,
+     429, 414, 696, 522, 697, 432, 698, 699,1075, 806,1076, 815,
+    1077, 807,1078, 817,1079, 808,1080, 819,1081, 809,1082, 821,
+    1083,1084, 803,1085, 811,1086, 804, 782,   0,1087,1088,1089,
+     135,1090,1091, 866, 311,1092,1093,1094, 542,1095,1096, 868,
+     312,1097,1098,1099, 377, 546,1100,1101,   1,1102,1103,1104,
+     138,1105,1106, 790, 321,1107,1108,1109, 548,1110,1111, 795,
+     322,1112,1113,1114, 365, 552,1115,1116,  10,1117, 984,1118,
+     141,1119, 987, 873, 409,1120, 989,1121, 554,1122, 992, 875,
+     413, 580,1123, 569,1124, 558,1125,1126,  48,1127, 997,1128,
+     144,1129,1000, 800, 479,1130,1002,1131, 560,1132,1005, 802,
+     483, 586,1133, 575,1059, 564,1134,1135,  15,1136, 152,1137,
+     147,1138, 154, 221, 417,1139, 577,1140, 566,1141, 579, 703,
+     421,1015,1142, 557, 896, 570,1143,1144,  50,1145, 155,1146,
+     150,1147, 157, 237, 487,1148, 583,1149, 572,1150, 585, 778,
+     491,1025,1151, 563, 822, 576,1152,1153,   8,1154, 146,1155,
+     153,1156, 148, 891, 425,1157, 565,1158, 578,1159, 567, 895,
+     429, 556,1160, 969, 884, 582,1161,1162,  47,1163, 149,1164,
+     156,1165, 151, 817, 495,1166, 571,1167, 584,1168, 573, 821,
+     499, 562,1169, 980, 811, 588,1170,1171,   0, 158,   3, 159,
+       4, 204,   2, 205, 311, 609, 403, 610, 404, 611, 405, 342,
+     312, 406, 612, 407, 341, 408, 613, 614,   1, 172,  22, 173,
+      23, 228,  21, 229, 321, 735, 453, 736, 454, 737, 455, 358,
+     322, 456, 738, 457, 357, 458, 739, 740,  12, 166,  17, 167,
+      20, 220,  13, 221, 433, 700, 434, 701, 435, 702, 436, 703,
+     437, 438, 704, 439, 705, 440, 706, 707,  49, 174,  38, 175,
+      41, 236,  35, 237, 589, 775, 590, 776, 591, 777, 592, 778,
+     593, 594, 779, 595, 780, 596, 781, 782,   0, 266,  65, 267,
+      59, 291,  53, 292, 311, 718, 441, 719, 448, 712, 726, 713,
+     312, 444, 722, 445, 667, 446, 714, 715,   1, 270,  66, 271,
+      32, 293,  26, 294, 321,1172, 597, 827, 604,1173,1174, 829,
+     322, 600, 830, 601,1175, 602, 832,1176,  12, 274, 112, 275,
+      19, 295,  11, 296, 433, 680, 727, 672, 427, 728, 412, 729,
+     437, 730, 731, 451, 732, 452, 733, 734,  49, 278,  89, 279,
+      40, 297,  34, 298, 589,1177,1178, 837, 497,1179, 482, 839,
+     593,1180, 840, 607,1181, 608, 842,1182,   0,  52,  12, 113,
+       0,  53,   8, 113,   0,  22,  15,  37,   0,  55,   7,   5,
+       0,  65,   4,  52,   8,  14,  19,  11,   0,  55,  57,  53,
+       8, 124, 116, 113,   0,   3,  59,  51,  10,  14, 121, 113,
+      15,  16, 116,  82,   8,  79,  20,  13,   0,  55,  58,  52,
+      12, 119, 116, 113,   0, 186,  55, 187,   7, 213,   5, 250,
+       0,  55,  58,  52, 311, 467, 468, 469, 312, 470, 471, 472,
+      12, 119, 116, 113, 433,1183,1184,1185, 437,1186,1187,1188
+  };
+
+  SymInfoGroup const SymInfoGroups[nSymInfoGroups] = {
+    {   1,    1, " P 1", "P 1", "P 1", "", 0,1 },
+    {   2,    2, "-P 1", "P -1", "P 1-", "", 1,2 },
+    {   3,    3, " P 2y", "P 1 2 1", "P 1 2 1", "", 3,2 },
+    {   3, 1003, " P 2y (z,x,y)", "P 1 1 2", "P 1 1 2", "", 5,2 },
+    {   3,    0, " P 2y (y,z,x)", "P 2 1 1", "", "", 7,2 },
+    {   4,    4, " P 2yb", "P 1 21 1", "P 1 21 1", "", 9,2 },
+    {   4, 1004, " P 2yb (z,x,y)", "P 1 1 21", "P 1 1 21", "", 11,2 },
+    {   4,    0, " P 2yb (y,z,x)", "P 21 1 1", "", "", 13,2 },
+    {   5,    5, " C 2y", "C 1 2 1", "C 1 2 1", "", 15,4 },
+    {   5, 2005, " C 2y (z,y,-x)", "A 1 2 1", "A 1 2 1", "A 2", 19,4 },
+    {   5, 4005, " C 2y (x,y,-x+z)", "I 1 2 1", "I 1 2 1", "I 2", 23,4 },
+    {   5,    0, " C 2y (z,x,y)", "A 1 1 2", "", "", 27,4 },
+    {   5, 1005, " C 2y (-x,z,y)", "B 1 1 2", "B 1 1 2", "B 2", 31,4 },
+    {   5,    0, " C 2y (-x+z,x,y)", "I 1 1 2", "", "", 35,4 },
+    {   5,    0, " C 2y (y,z,x)", "B 2 1 1", "", "", 39,4 },
+    {   5,    0, " C 2y (y,-x,z)", "C 2 1 1", "", "", 43,4 },
+    {   5,    0, " C 2y (y,-x+z,x)", "I 2 1 1", "", "", 47,4 },
+    {   6,    6, " P -2y", "P 1 m 1", "P 1 m 1", "", 51,2 },
+    {   6, 1006, " P -2y (z,x,y)", "P 1 1 m", "P 1 1 m", "", 53,2 },
+    {   6,    0, " P -2y (y,z,x)", "P m 1 1", "", "", 55,2 },
+    {   7,    7, " P -2yc", "P 1 c 1", "P 1 c 1", "", 57,2 },
+    {   7,    0, " P -2yc (x-z,y,z)", "P 1 n 1", "", "", 59,2 },
+    {   7,    0, " P -2yc (z,y,-x)", "P 1 a 1", "", "", 61,2 },
+    {   7,    0, " P -2yc (z,x,y)", "P 1 1 a", "", "", 63,2 },
+    {   7,    0, " P -2yc (z,x-z,y)", "P 1 1 n", "", "", 65,2 },
+    {   7, 1007, " P -2yc (-x,z,y)", "P 1 1 b", "P 1 1 b", "", 67,2 },
+    {   7,    0, " P -2yc (y,z,x)", "P b 1 1", "", "", 69,2 },
+    {   7,    0, " P -2yc (y,z,x-z)", "P n 1 1", "", "", 71,2 },
+    {   7,    0, " P -2yc (y,-x,z)", "P c 1 1", "", "", 73,2 },
+    {   8,    8, " C -2y", "C 1 m 1", "C 1 m 1", "", 75,4 },
+    {   8,    0, " C -2y (z,y,-x)", "A 1 m 1", "", "", 79,4 },
+    {   8,    0, " C -2y (x,y,-x+z)", "I 1 m 1", "", "", 83,4 },
+    {   8,    0, " C -2y (z,x,y)", "A 1 1 m", "", "", 87,4 },
+    {   8,    0, " C -2y (-x,z,y)", "B 1 1 m", "", "", 91,4 },
+    {   8,    0, " C -2y (-x+z,x,y)", "I 1 1 m", "", "", 95,4 },
+    {   8,    0, " C -2y (y,z,x)", "B m 1 1", "", "", 99,4 },
+    {   8,    0, " C -2y (y,-x,z)", "C m 1 1", "", "", 103,4 },
+    {   8,    0, " C -2y (y,-x+z,x)", "I m 1 1", "", "", 107,4 },
+    {   9,    9, " C -2yc", "C 1 c 1", "C 1 c 1", "", 111,4 },
+    {   9,    0, " C -2yc (z,y,-x+z)", "A 1 n 1", "", "", 115,4 },
+    {   9,    0, " C -2yc (x+z,y,-x)", "I 1 a 1", "", "", 119,4 },
+    {   9,    0, " C -2yc (z,y,-x)", "A 1 a 1", "", "", 123,4 },
+    {   9,    0, " C -2yc (x+1/4,y+1/4,z)", "C 1 n 1", "", "", 127,4 },
+    {   9,    0, " C -2yc (x,y,-x+z)", "I 1 c 1", "", "", 131,4 },
+    {   9,    0, " C -2yc (z,x,y)", "A 1 1 a", "", "", 135,4 },
+    {   9,    0, " C -2yc (-x+z,z,y)", "B 1 1 n", "", "", 139,4 },
+    {   9,    0, " C -2yc (-x,x+z,y)", "I 1 1 b", "", "", 143,4 },
+    {   9, 1009, " C -2yc (-x,z,y)", "B 1 1 b", "B 1 1 b", "", 147,4 },
+    {   9,    0, " C -2yc (z,x-z,y)", "A 1 1 n", "", "", 151,4 },
+    {   9,    0, " C -2yc (-x+z,x,y)", "I 1 1 a", "", "", 155,4 },
+    {   9,    0, " C -2yc (y,z,x)", "B b 1 1", "", "", 159,4 },
+    {   9,    0, " C -2yc (y,-x+z,z)", "C n 1 1", "", "", 163,4 },
+    {   9,    0, " C -2yc (y,-x,x+z)", "I c 1 1", "", "", 167,4 },
+    {   9,    0, " C -2yc (y,-x,z)", "C c 1 1", "", "", 171,4 },
+    {   9,    0, " C -2yc (y,z,x-z)", "B n 1 1", "", "", 175,4 },
+    {   9,    0, " C -2yc (y,-x+z,x)", "I b 1 1", "", "", 179,4 },
+    {  10,   10, "-P 2y", "P 1 2/m 1", "P 1 2/m 1", "", 183,4 },
+    {  10, 1010, "-P 2y (z,x,y)", "P 1 1 2/m", "P 1 1 2/m", "", 187,4 },
+    {  10,    0, "-P 2y (y,z,x)", "P 2/m 1 1", "", "", 191,4 },
+    {  11,   11, "-P 2yb", "P 1 21/m 1", "P 1 21/m 1", "", 195,4 },
+    {  11, 1011, "-P 2yb (z,x,y)", "P 1 1 21/m", "P 1 1 21/m", "", 199,4 },
+    {  11,    0, "-P 2yb (y,z,x)", "P 21/m 1 1", "", "", 203,4 },
+    {  12,   12, "-C 2y", "C 1 2/m 1", "C 1 2/m 1", "", 207,8 },
+    {  12,    0, "-C 2y (z,y,-x)", "A 1 2/m 1", "", "", 215,8 },
+    {  12,    0, "-C 2y (x,y,-x+z)", "I 1 2/m 1", "", "", 223,8 },
+    {  12,    0, "-C 2y (z,x,y)", "A 1 1 2/m", "", "", 231,8 },
+    {  12, 1012, "-C 2y (-x,z,y)", "B 1 1 2/m", "B 1 1 2/m", "", 239,8 },
+    {  12,    0, "-C 2y (-x+z,x,y)", "I 1 1 2/m", "", "", 247,8 },
+    {  12,    0, "-C 2y (y,z,x)", "B 2/m 1 1", "", "", 255,8 },
+    {  12,    0, "-C 2y (y,-x,z)", "C 2/m 1 1", "", "", 263,8 },
+    {  12,    0, "-C 2y (y,-x+z,x)", "I 2/m 1 1", "", "", 271,8 },
+    {  13,   13, "-P 2yc", "P 1 2/c 1", "P 1 2/c 1", "", 279,4 },
+    {  13,    0, "-P 2yc (x-z,y,z)", "P 1 2/n 1", "", "", 283,4 },
+    {  13,    0, "-P 2yc (z,y,-x)", "P 1 2/a 1", "", "", 287,4 },
+    {  13,    0, "-P 2yc (z,x,y)", "P 1 1 2/a", "", "", 291,4 },
+    {  13,    0, "-P 2yc (z,x-z,y)", "P 1 1 2/n", "", "", 295,4 },
+    {  13, 1013, "-P 2yc (-x,z,y)", "P 1 1 2/b", "P 1 1 2/b", "", 299,4 },
+    {  13,    0, "-P 2yc (y,z,x)", "P 2/b 1 1", "", "", 303,4 },
+    {  13,    0, "-P 2yc (y,z,x-z)", "P 2/n 1 1", "", "", 307,4 },
+    {  13,    0, "-P 2yc (y,-x,z)", "P 2/c 1 1", "", "", 311,4 },
+    {  14,   14, "-P 2ybc", "P 1 21/c 1", "P 1 21/c 1", "", 315,4 },
+    {  14,    0, "-P 2ybc (x-z,y,z)", "P 1 21/n 1", "", "", 319,4 },
+    {  14,    0, "-P 2ybc (z,y,-x)", "P 1 21/a 1", "", "", 323,4 },
+    {  14,    0, "-P 2ybc (z,x,y)", "P 1 1 21/a", "", "", 327,4 },
+    {  14,    0, "-P 2ybc (z,x-z,y)", "P 1 1 21/n", "", "", 331,4 },
+    {  14, 1014, "-P 2ybc (-x,z,y)", "P 1 1 21/b", "P 1 1 21/b", "", 335,4 },
+    {  14,    0, "-P 2ybc (y,z,x)", "P 21/b 1 1", "", "", 339,4 },
+    {  14,    0, "-P 2ybc (y,z,x-z)", "P 21/n 1 1", "", "", 343,4 },
+    {  14,    0, "-P 2ybc (y,-x,z)", "P 21/c 1 1", "", "", 347,4 },
+    {  15,   15, "-C 2yc", "C 1 2/c 1", "C 1 2/c 1", "", 351,8 },
+    {  15,    0, "-C 2yc (z,y,-x+z)", "A 1 2/n 1", "", "", 359,8 },
+    {  15,    0, "-C 2yc (x+z,y,-x)", "I 1 2/a 1", "", "", 367,8 },
+    {  15,    0, "-C 2yc (z,y,-x)", "A 1 2/a 1", "", "", 375,8 },
+    {  15,    0, "-C 2yc (x+1/4,y-1/4,z)", "C 1 2/n 1", "", "", 383,8 },
+    {  15,    0, "-C 2yc (x,y,-x+z)", "I 1 2/c 1", "", "", 391,8 },
+    {  15,    0, "-C 2yc (z,x,y)", "A 1 1 2/a", "", "", 399,8 },
+    {  15,    0, "-C 2yc (-x+z,z,y)", "B 1 1 2/n", "", "", 407,8 },
+    {  15,    0, "-C 2yc (-x,x+z,y)", "I 1 1 2/b", "", "", 415,8 },
+    {  15, 1015, "-C 2yc (-x,z,y)", "B 1 1 2/b", "B 1 1 2/b", "", 423,8 },
+    {  15,    0, "-C 2yc (z,x-z,y)", "A 1 1 2/n", "", "", 431,8 },
+    {  15,    0, "-C 2yc (-x+z,x,y)", "I 1 1 2/a", "", "", 439,8 },
+    {  15,    0, "-C 2yc (y,z,x)", "B 2/b 1 1", "", "", 447,8 },
+    {  15,    0, "-C 2yc (y,-x+z,z)", "C 2/n 1 1", "", "", 455,8 },
+    {  15,    0, "-C 2yc (y,-x,x+z)", "I 2/c 1 1", "", "", 463,8 },
+    {  15,    0, "-C 2yc (y,-x,z)", "C 2/c 1 1", "", "", 471,8 },
+    {  15,    0, "-C 2yc (y,z,x-z)", "B 2/n 1 1", "", "", 479,8 },
+    {  15,    0, "-C 2yc (y,-x+z,x)", "I 2/b 1 1", "", "", 487,8 },
+    {  16,   16, " P 2 2", "P 2 2 2", "P 2 2 2", "", 495,4 },
+    {  17,   17, " P 2c 2", "P 2 2 21", "P 2 2 21", "", 499,4 },
+    {  17, 1017, " P 2c 2 (z,x,y)", "P 21 2 2", "P 21 2 2", "", 503,4 },
+    {  17, 2017, " P 2c 2 (y,z,x)", "P 2 21 2", "P 2 21 2", "", 507,4 },
+    {  18,   18, " P 2 2ab", "P 21 21 2", "P 21 21 2", "", 511,4 },
+    {  18, 3018, " P 2 2ab (z,x,y)", "P 2 21 21", "P 2 21 21", "", 515,4 },
+    {  18, 2018, " P 2 2ab (y,z,x)", "P 21 2 21", "P 21 2 21", "", 519,4 },
+    {  19,   19, " P 2ac 2ab", "P 21 21 21", "P 21 21 21", "", 523,4 },
+    {  20,   20, " C 2c 2", "C 2 2 21", "C 2 2 21", "", 527,8 },
+    {  20,    0, " C 2c 2 (z,x,y)", "A 21 2 2", "", "", 535,8 },
+    {  20,    0, " C 2c 2 (y,z,x)", "B 2 21 2", "", "", 543,8 },
+    {  21,   21, " C 2 2", "C 2 2 2", "C 2 2 2", "", 551,8 },
+    {  21,    0, " C 2 2 (z,x,y)", "A 2 2 2", "", "", 559,8 },
+    {  21,    0, " C 2 2 (y,z,x)", "B 2 2 2", "", "", 567,8 },
+    {  22,   22, " F 2 2", "F 2 2 2", "F 2 2 2", "", 575,16 },
+    {  23,   23, " I 2 2", "I 2 2 2", "I 2 2 2", "", 591,8 },
+    {  24,   24, " I 2b 2c", "I 21 21 21", "I 21 21 21", "", 599,8 },
+    {  25,   25, " P 2 -2", "P m m 2", "P m m 2", "", 607,4 },
+    {  25,    0, " P 2 -2 (z,x,y)", "P 2 m m", "", "", 611,4 },
+    {  25,    0, " P 2 -2 (y,z,x)", "P m 2 m", "", "", 615,4 },
+    {  26,   26, " P 2c -2", "P m c 21", "P m c 21", "", 619,4 },
+    {  26,    0, " P 2c -2 (y,-x,z)", "P c m 21", "", "", 623,4 },
+    {  26,    0, " P 2c -2 (z,x,y)", "P 21 m a", "", "", 627,4 },
+    {  26,    0, " P 2c -2 (z,y,-x)", "P 21 a m", "", "", 631,4 },
+    {  26,    0, " P 2c -2 (y,z,x)", "P b 21 m", "", "", 635,4 },
+    {  26,    0, " P 2c -2 (-x,z,y)", "P m 21 b", "", "", 639,4 },
+    {  27,   27, " P 2 -2c", "P c c 2", "P c c 2", "", 643,4 },
+    {  27,    0, " P 2 -2c (z,x,y)", "P 2 a a", "", "", 647,4 },
+    {  27,    0, " P 2 -2c (y,z,x)", "P b 2 b", "", "", 651,4 },
+    {  28,   28, " P 2 -2a", "P m a 2", "P m a 2", "", 655,4 },
+    {  28,    0, " P 2 -2a (y,-x,z)", "P b m 2", "", "", 659,4 },
+    {  28,    0, " P 2 -2a (z,x,y)", "P 2 m b", "", "", 663,4 },
+    {  28,    0, " P 2 -2a (z,y,-x)", "P 2 c m", "", "", 667,4 },
+    {  28,    0, " P 2 -2a (y,z,x)", "P c 2 m", "", "", 671,4 },
+    {  28,    0, " P 2 -2a (-x,z,y)", "P m 2 a", "", "", 675,4 },
+    {  29,   29, " P 2c -2ac", "P c a 21", "P c a 21", "", 679,4 },
+    {  29,    0, " P 2c -2ac (y,-x,z)", "P b c 21", "", "", 683,4 },
+    {  29,    0, " P 2c -2ac (z,x,y)", "P 21 a b", "", "", 687,4 },
+    {  29,    0, " P 2c -2ac (z,y,-x)", "P 21 c a", "", "", 691,4 },
+    {  29,    0, " P 2c -2ac (y,z,x)", "P c 21 b", "", "", 695,4 },
+    {  29,    0, " P 2c -2ac (-x,z,y)", "P b 21 a", "", "", 699,4 },
+    {  30,   30, " P 2 -2bc", "P n c 2", "P n c 2", "", 703,4 },
+    {  30,    0, " P 2 -2bc (y,-x,z)", "P c n 2", "", "", 707,4 },
+    {  30,    0, " P 2 -2bc (z,x,y)", "P 2 n a", "", "", 711,4 },
+    {  30,    0, " P 2 -2bc (z,y,-x)", "P 2 a n", "", "", 715,4 },
+    {  30,    0, " P 2 -2bc (y,z,x)", "P b 2 n", "", "", 719,4 },
+    {  30,    0, " P 2 -2bc (-x,z,y)", "P n 2 b", "", "", 723,4 },
+    {  31,   31, " P 2ac -2", "P m n 21", "P m n 21", "", 727,4 },
+    {  31,    0, " P 2ac -2 (y,-x,z)", "P n m 21", "", "", 731,4 },
+    {  31,    0, " P 2ac -2 (z,x,y)", "P 21 m n", "", "", 735,4 },
+    {  31,    0, " P 2ac -2 (z,y,-x)", "P 21 n m", "", "", 739,4 },
+    {  31,    0, " P 2ac -2 (y,z,x)", "P n 21 m", "", "", 743,4 },
+    {  31,    0, " P 2ac -2 (-x,z,y)", "P m 21 n", "", "", 747,4 },
+    {  32,   32, " P 2 -2ab", "P b a 2", "P b a 2", "", 751,4 },
+    {  32,    0, " P 2 -2ab (z,x,y)", "P 2 c b", "", "", 755,4 },
+    {  32,    0, " P 2 -2ab (y,z,x)", "P c 2 a", "", "", 759,4 },
+    {  33,   33, " P 2c -2n", "P n a 21", "P n a 21", "", 763,4 },
+    {  33,    0, " P 2c -2n (y,-x,z)", "P b n 21", "", "", 767,4 },
+    {  33,    0, " P 2c -2n (z,x,y)", "P 21 n b", "", "", 771,4 },
+    {  33,    0, " P 2c -2n (z,y,-x)", "P 21 c n", "", "", 775,4 },
+    {  33,    0, " P 2c -2n (y,z,x)", "P c 21 n", "", "", 779,4 },
+    {  33,    0, " P 2c -2n (-x,z,y)", "P n 21 a", "", "", 783,4 },
+    {  34,   34, " P 2 -2n", "P n n 2", "P n n 2", "", 787,4 },
+    {  34,    0, " P 2 -2n (z,x,y)", "P 2 n n", "", "", 791,4 },
+    {  34,    0, " P 2 -2n (y,z,x)", "P n 2 n", "", "", 795,4 },
+    {  35,   35, " C 2 -2", "C m m 2", "C m m 2", "", 799,8 },
+    {  35,    0, " C 2 -2 (z,x,y)", "A 2 m m", "", "", 807,8 },
+    {  35,    0, " C 2 -2 (y,z,x)", "B m 2 m", "", "", 815,8 },
+    {  36,   36, " C 2c -2", "C m c 21", "C m c 21", "", 823,8 },
+    {  36,    0, " C 2c -2 (y,-x,z)", "C c m 21", "", "", 831,8 },
+    {  36,    0, " C 2c -2 (z,x,y)", "A 21 m a", "", "", 839,8 },
+    {  36,    0, " C 2c -2 (z,y,-x)", "A 21 a m", "", "", 847,8 },
+    {  36,    0, " C 2c -2 (y,z,x)", "B b 21 m", "", "", 855,8 },
+    {  36,    0, " C 2c -2 (-x,z,y)", "B m 21 b", "", "", 863,8 },
+    {  37,   37, " C 2 -2c", "C c c 2", "C c c 2", "", 871,8 },
+    {  37,    0, " C 2 -2c (z,x,y)", "A 2 a a", "", "", 879,8 },
+    {  37,    0, " C 2 -2c (y,z,x)", "B b 2 b", "", "", 887,8 },
+    {  38,   38, " A 2 -2", "A m m 2", "A m m 2", "", 895,8 },
+    {  38,    0, " A 2 -2 (y,-x,z)", "B m m 2", "", "", 903,8 },
+    {  38,    0, " A 2 -2 (z,x,y)", "B 2 m m", "", "", 911,8 },
+    {  38,    0, " A 2 -2 (z,y,-x)", "C 2 m m", "", "", 919,8 },
+    {  38,    0, " A 2 -2 (y,z,x)", "C m 2 m", "", "", 927,8 },
+    {  38,    0, " A 2 -2 (-x,z,y)", "A m 2 m", "", "", 935,8 },
+    {  39,   39, " A 2 -2b", "A b m 2", "A b m 2", "", 943,8 },
+    {  39,    0, " A 2 -2b (y,-x,z)", "B m a 2", "", "", 951,8 },
+    {  39,    0, " A 2 -2b (z,x,y)", "B 2 c m", "", "", 959,8 },
+    {  39,    0, " A 2 -2b (z,y,-x)", "C 2 m b", "", "", 967,8 },
+    {  39,    0, " A 2 -2b (y,z,x)", "C m 2 a", "", "", 975,8 },
+    {  39,    0, " A 2 -2b (-x,z,y)", "A c 2 m", "", "", 983,8 },
+    {  40,   40, " A 2 -2a", "A m a 2", "A m a 2", "", 991,8 },
+    {  40,    0, " A 2 -2a (y,-x,z)", "B b m 2", "", "", 999,8 },
+    {  40,    0, " A 2 -2a (z,x,y)", "B 2 m b", "", "", 1007,8 },
+    {  40,    0, " A 2 -2a (z,y,-x)", "C 2 c m", "", "", 1015,8 },
+    {  40,    0, " A 2 -2a (y,z,x)", "C c 2 m", "", "", 1023,8 },
+    {  40,    0, " A 2 -2a (-x,z,y)", "A m 2 a", "", "", 1031,8 },
+    {  41,   41, " A 2 -2ab", "A b a 2", "A b a 2", "", 1039,8 },
+    {  41,    0, " A 2 -2ab (y,-x,z)", "B b a 2", "", "", 1047,8 },
+    {  41,    0, " A 2 -2ab (z,x,y)", "B 2 c b", "", "", 1055,8 },
+    {  41,    0, " A 2 -2ab (z,y,-x)", "C 2 c b", "", "", 1063,8 },
+    {  41,    0, " A 2 -2ab (y,z,x)", "C c 2 a", "", "", 1071,8 },
+    {  41,    0, " A 2 -2ab (-x,z,y)", "A c 2 a", "", "", 1079,8 },
+    {  42,   42, " F 2 -2", "F m m 2", "F m m 2", "", 1087,16 },
+    {  42,    0, " F 2 -2 (z,x,y)", "F 2 m m", "", "", 1103,16 },
+    {  42,    0, " F 2 -2 (y,z,x)", "F m 2 m", "", "", 1119,16 },
+    {  43,   43, " F 2 -2d", "F d d 2", "F d d 2", "", 1135,16 },
+    {  43,    0, " F 2 -2d (z,x,y)", "F 2 d d", "", "", 1151,16 },
+    {  43,    0, " F 2 -2d (y,z,x)", "F d 2 d", "", "", 1167,16 },
+    {  44,   44, " I 2 -2", "I m m 2", "I m m 2", "", 1183,8 },
+    {  44,    0, " I 2 -2 (z,x,y)", "I 2 m m", "", "", 1191,8 },
+    {  44,    0, " I 2 -2 (y,z,x)", "I m 2 m", "", "", 1199,8 },
+    {  45,   45, " I 2 -2c", "I b a 2", "I b a 2", "", 1207,8 },
+    {  45,    0, " I 2 -2c (z,x,y)", "I 2 c b", "", "", 1215,8 },
+    {  45,    0, " I 2 -2c (y,z,x)", "I c 2 a", "", "", 1223,8 },
+    {  46,   46, " I 2 -2a", "I m a 2", "I m a 2", "", 1231,8 },
+    {  46,    0, " I 2 -2a (y,-x,z)", "I b m 2", "", "", 1239,8 },
+    {  46,    0, " I 2 -2a (z,x,y)", "I 2 m b", "", "", 1247,8 },
+    {  46,    0, " I 2 -2a (z,y,-x)", "I 2 c m", "", "", 1255,8 },
+    {  46,    0, " I 2 -2a (y,z,x)", "I c 2 m", "", "", 1263,8 },
+    {  46,    0, " I 2 -2a (-x,z,y)", "I m 2 a", "", "", 1271,8 },
+    {  47,   47, "-P 2 2", "P m m m", "P 2/m 2/m 2/m", "P m m m", 1279,8 },
+    {  48,   48, "-P 2ab 2bc (x-1/4,y-1/4,z-1/4)", "P n n n :1", "P 2/n 2/n 2/n", "P n n n", 1287,8 },
+    {  48,    0, "-P 2ab 2bc", "P n n n :2", "", "", 1295,8 },
+    {  49,   49, "-P 2 2c", "P c c m", "P 2/c 2/c 2/m", "P c c m", 1303,8 },
+    {  49,    0, "-P 2 2c (z,x,y)", "P m a a", "", "", 1311,8 },
+    {  49,    0, "-P 2 2c (y,z,x)", "P b m b", "", "", 1319,8 },
+    {  50,   50, "-P 2ab 2b (x-1/4,y-1/4,z)", "P b a n :1", "P 2/b 2/a 2/n", "P b a n", 1327,8 },
+    {  50,    0, "-P 2ab 2b", "P b a n :2", "", "", 1335,8 },
+    {  50,    0, "-P 2ab 2b (z,x-1/4,y-1/4)", "P n c b :1", "", "", 1343,8 },
+    {  50,    0, "-P 2ab 2b (z,x,y)", "P n c b :2", "", "", 1351,8 },
+    {  50,    0, "-P 2ab 2b (y-1/4,z,x-1/4)", "P c n a :1", "", "", 1359,8 },
+    {  50,    0, "-P 2ab 2b (y,z,x)", "P c n a :2", "", "", 1367,8 },
+    {  51,   51, "-P 2a 2a", "P m m a", "P 21/m 2/m 2/a", "P m m a", 1375,8 },
+    {  51,    0, "-P 2a 2a (y,-x,z)", "P m m b", "", "", 1383,8 },
+    {  51,    0, "-P 2a 2a (z,x,y)", "P b m m", "", "", 1391,8 },
+    {  51,    0, "-P 2a 2a (z,y,-x)", "P c m m", "", "", 1399,8 },
+    {  51,    0, "-P 2a 2a (y,z,x)", "P m c m", "", "", 1407,8 },
+    {  51,    0, "-P 2a 2a (-x,z,y)", "P m a m", "", "", 1415,8 },
+    {  52,   52, "-P 2a 2bc", "P n n a", "P 2/n 21/n 2/a", "P n n a", 1423,8 },
+    {  52,    0, "-P 2a 2bc (y,-x,z)", "P n n b", "", "", 1431,8 },
+    {  52,    0, "-P 2a 2bc (z,x,y)", "P b n n", "", "", 1439,8 },
+    {  52,    0, "-P 2a 2bc (z,y,-x)", "P c n n", "", "", 1447,8 },
+    {  52,    0, "-P 2a 2bc (y,z,x)", "P n c n", "", "", 1455,8 },
+    {  52,    0, "-P 2a 2bc (-x,z,y)", "P n a n", "", "", 1463,8 },
+    {  53,   53, "-P 2ac 2", "P m n a", "P 2/m 2/n 21/a", "P m n a", 1471,8 },
+    {  53,    0, "-P 2ac 2 (y,-x,z)", "P n m b", "", "", 1479,8 },
+    {  53,    0, "-P 2ac 2 (z,x,y)", "P b m n", "", "", 1487,8 },
+    {  53,    0, "-P 2ac 2 (z,y,-x)", "P c n m", "", "", 1495,8 },
+    {  53,    0, "-P 2ac 2 (y,z,x)", "P n c m", "", "", 1503,8 },
+    {  53,    0, "-P 2ac 2 (-x,z,y)", "P m a n", "", "", 1511,8 },
+    {  54,   54, "-P 2a 2ac", "P c c a", "P 21/c 2/c 2/a", "P c c a", 1519,8 },
+    {  54,    0, "-P 2a 2ac (y,-x,z)", "P c c b", "", "", 1527,8 },
+    {  54,    0, "-P 2a 2ac (z,x,y)", "P b a a", "", "", 1535,8 },
+    {  54,    0, "-P 2a 2ac (z,y,-x)", "P c a a", "", "", 1543,8 },
+    {  54,    0, "-P 2a 2ac (y,z,x)", "P b c b", "", "", 1551,8 },
+    {  54,    0, "-P 2a 2ac (-x,z,y)", "P b a b", "", "", 1559,8 },
+    {  55,   55, "-P 2 2ab", "P b a m", "P 21/b 21/a 2/m", "P b a m", 1567,8 },
+    {  55,    0, "-P 2 2ab (z,x,y)", "P m c b", "", "", 1575,8 },
+    {  55,    0, "-P 2 2ab (y,z,x)", "P c m a", "", "", 1583,8 },
+    {  56,   56, "-P 2ab 2ac", "P c c n", "P 21/c 21/c 2/n", "P c c n", 1591,8 },
+    {  56,    0, "-P 2ab 2ac (z,x,y)", "P n a a", "", "", 1599,8 },
+    {  56,    0, "-P 2ab 2ac (y,z,x)", "P b n b", "", "", 1607,8 },
+    {  57,   57, "-P 2c 2b", "P b c m", "P 2/b 21/c 21/m", "P b c m", 1615,8 },
+    {  57,    0, "-P 2c 2b (y,-x,z)", "P c a m", "", "", 1623,8 },
+    {  57,    0, "-P 2c 2b (z,x,y)", "P m c a", "", "", 1631,8 },
+    {  57,    0, "-P 2c 2b (z,y,-x)", "P m a b", "", "", 1639,8 },
+    {  57,    0, "-P 2c 2b (y,z,x)", "P b m a", "", "", 1647,8 },
+    {  57,    0, "-P 2c 2b (-x,z,y)", "P c m b", "", "", 1655,8 },
+    {  58,   58, "-P 2 2n", "P n n m", "P 21/n 21/n 2/m", "P n n m", 1663,8 },
+    {  58,    0, "-P 2 2n (z,x,y)", "P m n n", "", "", 1671,8 },
+    {  58,    0, "-P 2 2n (y,z,x)", "P n m n", "", "", 1679,8 },
+    {  59,   59, "-P 2ab 2a (x-1/4,y-1/4,z)", "P m m n :1", "P 21/m 21/m 2/n", "P m m n", 1687,8 },
+    {  59, 1059, "-P 2ab 2a", "P m m n :2", "P 21/m 21/m 2/n a", "", 1695,8 },
+    {  59,    0, "-P 2ab 2a (z,x-1/4,y-1/4)", "P n m m :1", "", "", 1703,8 },
+    {  59,    0, "-P 2ab 2a (z,x,y)", "P n m m :2", "", "", 1711,8 },
+    {  59,    0, "-P 2ab 2a (y-1/4,z,x-1/4)", "P m n m :1", "", "", 1719,8 },
+    {  59,    0, "-P 2ab 2a (y,z,x)", "P m n m :2", "", "", 1727,8 },
+    {  60,   60, "-P 2n 2ab", "P b c n", "P 21/b 2/c 21/n", "P b c n", 1735,8 },
+    {  60,    0, "-P 2n 2ab (y,-x,z)", "P c a n", "", "", 1743,8 },
+    {  60,    0, "-P 2n 2ab (z,x,y)", "P n c a", "", "", 1751,8 },
+    {  60,    0, "-P 2n 2ab (z,y,-x)", "P n a b", "", "", 1759,8 },
+    {  60,    0, "-P 2n 2ab (y,z,x)", "P b n a", "", "", 1767,8 },
+    {  60,    0, "-P 2n 2ab (-x,z,y)", "P c n b", "", "", 1775,8 },
+    {  61,   61, "-P 2ac 2ab", "P b c a", "P 21/b 21/c 21/a", "P b c a", 1783,8 },
+    {  61,    0, "-P 2ac 2ab (z,y,-x)", "P c a b", "", "", 1791,8 },
+    {  62,   62, "-P 2ac 2n", "P n m a", "P 21/n 21/m 21/a", "P n m a", 1799,8 },
+    {  62,    0, "-P 2ac 2n (y,-x,z)", "P m n b", "", "", 1807,8 },
+    {  62,    0, "-P 2ac 2n (z,x,y)", "P b n m", "", "", 1815,8 },
+    {  62,    0, "-P 2ac 2n (z,y,-x)", "P c m n", "", "", 1823,8 },
+    {  62,    0, "-P 2ac 2n (y,z,x)", "P m c n", "", "", 1831,8 },
+    {  62,    0, "-P 2ac 2n (-x,z,y)", "P n a m", "", "", 1839,8 },
+    {  63,   63, "-C 2c 2", "C m c m", "C 2/m 2/c 21/m", "C m c m", 1847,16 },
+    {  63,    0, "-C 2c 2 (y,-x,z)", "C c m m", "", "", 1863,16 },
+    {  63,    0, "-C 2c 2 (z,x,y)", "A m m a", "", "", 1879,16 },
+    {  63,    0, "-C 2c 2 (z,y,-x)", "A m a m", "", "", 1895,16 },
+    {  63,    0, "-C 2c 2 (y,z,x)", "B b m m", "", "", 1911,16 },
+    {  63,    0, "-C 2c 2 (-x,z,y)", "B m m b", "", "", 1927,16 },
+    {  64,   64, "-C 2ac 2", "C m c a", "C 2/m 2/c 21/a", "C m c a", 1943,16 },
+    {  64,    0, "-C 2ac 2 (y,-x,z)", "C c m b", "", "", 1959,16 },
+    {  64,    0, "-C 2ac 2 (z,x,y)", "A b m a", "", "", 1975,16 },
+    {  64,    0, "-C 2ac 2 (z,y,-x)", "A c a m", "", "", 1991,16 },
+    {  64,    0, "-C 2ac 2 (y,z,x)", "B b c m", "", "", 2007,16 },
+    {  64,    0, "-C 2ac 2 (-x,z,y)", "B m a b", "", "", 2023,16 },
+    {  65,   65, "-C 2 2", "C m m m", "C 2/m 2/m 2/m", "C m m m", 2039,16 },
+    {  65,    0, "-C 2 2 (z,x,y)", "A m m m", "", "", 2055,16 },
+    {  65,    0, "-C 2 2 (y,z,x)", "B m m m", "", "", 2071,16 },
+    {  66,   66, "-C 2 2c", "C c c m", "C 2/c 2/c 2/m", "C c c m", 2087,16 },
+    {  66,    0, "-C 2 2c (z,x,y)", "A m a a", "", "", 2103,16 },
+    {  66,    0, "-C 2 2c (y,z,x)", "B b m b", "", "", 2119,16 },
+    {  67,   67, "-C 2a 2", "C m m a", "C 2/m 2/m 2/a", "C m m a", 2135,16 },
+    {  67,    0, "-C 2a 2 (x+1/4,y+1/4,z)", "C m m b", "", "", 2151,16 },
+    {  67,    0, "-C 2a 2 (z,x,y)", "A b m m", "", "", 2167,16 },
+    {  67,    0, "-C 2a 2 (z,y,-x)", "A c m m", "", "", 2183,16 },
+    {  67,    0, "-C 2a 2 (y,z,x)", "B m c m", "", "", 2199,16 },
+    {  67,    0, "-C 2a 2 (-x,z,y)", "B m a m", "", "", 2215,16 },
+    {  68,   68, "-C 2a 2ac (x-1/2,y-1/4,z+1/4)", "C c c a :1", "C c c a", "C 2/c 2/c 2/a", 2231,16 },
+    {  68,    0, "-C 2a 2ac", "C c c a :2", "", "", 2247,16 },
+    {  68,    0, "-C 2a 2ac (x-1/2,y-1/4,z+1/4)", "C c c b :1", "", "", 2263,16 },
+    {  68,    0, "-C 2a 2ac (x-1/4,y-1/4,z)", "C c c b :2", "", "", 2279,16 },
+    {  68,    0, "-C 2a 2ac (z+1/4,x-1/2,y-1/4)", "A b a a :1", "", "", 2295,16 },
+    {  68,    0, "-C 2a 2ac (z,x,y)", "A b a a :2", "", "", 2311,16 },
+    {  68,    0, "-C 2a 2ac (z+1/4,x-1/2,y-1/4)", "A c a a :1", "", "", 2327,16 },
+    {  68,    0, "-C 2a 2ac (z,y,-x)", "A c a a :2", "", "", 2343,16 },
+    {  68,    0, "-C 2a 2ac (y-1/4,z+1/4,x-1/2)", "B b c b :1", "", "", 2359,16 },
+    {  68,    0, "-C 2a 2ac (y,z,x)", "B b c b :2", "", "", 2375,16 },
+    {  68,    0, "-C 2a 2ac (y-1/4,z+1/4,x-1/2)", "B b a b :1", "", "", 2391,16 },
+    {  68,    0, "-C 2a 2ac (-x,z,y)", "B b a b :2", "", "", 2407,16 },
+    {  69,   69, "-F 2 2", "F m m m", "F 2/m 2/m 2/m", "F m m m", 2423,32 },
+    {  70,   70, "-F 2uv 2vw (x+1/8,y+1/8,z+1/8)", "F d d d :1", "F 2/d 2/d 2/d", "F d d d", 2455,32 },
+    {  70,    0, "-F 2uv 2vw", "F d d d :2", "", "", 2487,32 },
+    {  71,   71, "-I 2 2", "I m m m", "I 2/m 2/m 2/m", "I m m m", 2519,16 },
+    {  72,   72, "-I 2 2c", "I b a m", "I 2/b 2/a 2/m", "I b a m", 2535,16 },
+    {  72,    0, "-I 2 2c (z,x,y)", "I m c b", "", "", 2551,16 },
+    {  72,    0, "-I 2 2c (y,z,x)", "I c m a", "", "", 2567,16 },
+    {  73,   73, "-I 2b 2c", "I b c a", "I 21/b 21/c 21/a", "I b c a", 2583,16 },
+    {  73,    0, "-I 2b 2c (x+1/4,y-1/4,z+1/4)", "I c a b", "", "", 2599,16 },
+    {  74,   74, "-I 2b 2", "I m m a", "I 21/m 21/m 21/a", "I m m a", 2615,16 },
+    {  74,    0, "-I 2b 2 (x+1/4,y-1/4,z+1/4)", "I m m b", "", "", 2631,16 },
+    {  74,    0, "-I 2b 2 (z,x,y)", "I b m m", "", "", 2647,16 },
+    {  74,    0, "-I 2b 2 (z,y,-x)", "I c m m", "", "", 2663,16 },
+    {  74,    0, "-I 2b 2 (y,z,x)", "I m c m", "", "", 2679,16 },
+    {  74,    0, "-I 2b 2 (-x,z,y)", "I m a m", "", "", 2695,16 },
+    {  75,   75, " P 4", "P 4", "P 4", "", 2711,4 },
+    {  76,   76, " P 4w", "P 41", "P 41", "", 2715,4 },
+    {  77,   77, " P 4c", "P 42", "P 42", "", 2719,4 },
+    {  78,   78, " P 4cw", "P 43", "P 43", "", 2723,4 },
+    {  79,   79, " I 4", "I 4", "I 4", "", 2727,8 },
+    {  80,   80, " I 4bw", "I 41", "I 41", "", 2735,8 },
+    {  81,   81, " P -4", "P -4", "P -4", "", 2743,4 },
+    {  82,   82, " I -4", "I -4", "I -4", "", 2747,8 },
+    {  83,   83, "-P 4", "P 4/m", "P 4/m", "", 2755,8 },
+    {  84,   84, "-P 4c", "P 42/m", "P 42/m", "", 2763,8 },
+    {  85,   85, "-P 4a (x-1/4,y+1/4,z)", "P 4/n :1", "P 4/n", "", 2771,8 },
+    {  85,    0, "-P 4a", "P 4/n :2", "", "", 2779,8 },
+    {  86,   86, "-P 4bc (x+1/4,y+1/4,z+1/4)", "P 42/n :1", "P 42/n", "", 2787,8 },
+    {  86,    0, "-P 4bc", "P 42/n :2", "", "", 2795,8 },
+    {  87,   87, "-I 4", "I 4/m", "I 4/m", "", 2803,16 },
+    {  88,   88, "-I 4ad (x,y+1/4,z+1/8)", "I 41/a :1", "I 41/a", "", 2819,16 },
+    {  88,    0, "-I 4ad", "I 41/a :2", "", "", 2835,16 },
+    {  89,   89, " P 4 2", "P 4 2 2", "P 4 2 2", "", 2851,8 },
+    {  90,   90, " P 4ab 2ab", "P 4 21 2", "P 4 21 2", "", 2859,8 },
+    {  91,   91, " P 4w 2c", "P 41 2 2", "P 41 2 2", "", 2867,8 },
+    {  92,   92, " P 4abw 2nw", "P 41 21 2", "P 41 21 2", "", 2875,8 },
+    {  93,   93, " P 4c 2", "P 42 2 2", "P 42 2 2", "", 2883,8 },
+    {  94,   94, " P 4n 2n", "P 42 21 2", "P 42 21 2", "", 2891,8 },
+    {  95,   95, " P 4cw 2c", "P 43 2 2", "P 43 2 2", "", 2899,8 },
+    {  96,   96, " P 4nw 2abw", "P 43 21 2", "P 43 21 2", "", 2907,8 },
+    {  97,   97, " I 4 2", "I 4 2 2", "I 4 2 2", "", 2915,16 },
+    {  98,   98, " I 4bw 2bw", "I 41 2 2", "I 41 2 2", "", 2931,16 },
+    {  99,   99, " P 4 -2", "P 4 m m", "P 4 m m", "", 2947,8 },
+    { 100,  100, " P 4 -2ab", "P 4 b m", "P 4 b m", "", 2955,8 },
+    { 101,  101, " P 4c -2c", "P 42 c m", "P 42 c m", "", 2963,8 },
+    { 102,  102, " P 4n -2n", "P 42 n m", "P 42 n m", "", 2971,8 },
+    { 103,  103, " P 4 -2c", "P 4 c c", "P 4 c c", "", 2979,8 },
+    { 104,  104, " P 4 -2n", "P 4 n c", "P 4 n c", "", 2987,8 },
+    { 105,  105, " P 4c -2", "P 42 m c", "P 42 m c", "", 2995,8 },
+    { 106,  106, " P 4c -2ab", "P 42 b c", "P 42 b c", "", 3003,8 },
+    { 107,  107, " I 4 -2", "I 4 m m", "I 4 m m", "", 3011,16 },
+    { 108,  108, " I 4 -2c", "I 4 c m", "I 4 c m", "", 3027,16 },
+    { 109,  109, " I 4bw -2", "I 41 m d", "I 41 m d", "", 3043,16 },
+    { 110,  110, " I 4bw -2c", "I 41 c d", "I 41 c d", "", 3059,16 },
+    { 111,  111, " P -4 2", "P -4 2 m", "P -4 2 m", "", 3075,8 },
+    { 112,  112, " P -4 2c", "P -4 2 c", "P -4 2 c", "", 3083,8 },
+    { 113,  113, " P -4 2ab", "P -4 21 m", "P -4 21 m", "", 3091,8 },
+    { 114,  114, " P -4 2n", "P -4 21 c", "P -4 21 c", "", 3099,8 },
+    { 115,  115, " P -4 -2", "P -4 m 2", "P -4 m 2", "", 3107,8 },
+    { 116,  116, " P -4 -2c", "P -4 c 2", "P -4 c 2", "", 3115,8 },
+    { 117,  117, " P -4 -2ab", "P -4 b 2", "P -4 b 2", "", 3123,8 },
+    { 118,  118, " P -4 -2n", "P -4 n 2", "P -4 n 2", "", 3131,8 },
+    { 119,  119, " I -4 -2", "I -4 m 2", "I -4 m 2", "", 3139,16 },
+    { 120,  120, " I -4 -2c", "I -4 c 2", "I -4 c 2", "", 3155,16 },
+    { 121,  121, " I -4 2", "I -4 2 m", "I -4 2 m", "", 3171,16 },
+    { 122,  122, " I -4 2bw", "I -4 2 d", "I -4 2 d", "", 3187,16 },
+    { 123,  123, "-P 4 2", "P 4/m m m", "P 4/m 2/m 2/m", "P4/m m m", 3203,16 },
+    { 124,  124, "-P 4 2c", "P 4/m c c", "P 4/m 2/c 2/c", "P4/m c c", 3219,16 },
+    { 125,  125, "-P 4a 2b (x-1/4,y-1/4,z)", "P 4/n b m :1", "P 4/n 2/b 2/m", "P4/n b m", 3235,16 },
+    { 125,    0, "-P 4a 2b", "P 4/n b m :2", "", "", 3251,16 },
+    { 126,  126, "-P 4a 2bc (x-1/4,y-1/4,z-1/4)", "P 4/n n c :1", "P 4/n 2/n 2/c", "P4/n n c", 3267,16 },
+    { 126,    0, "-P 4a 2bc", "P 4/n n c :2", "", "", 3283,16 },
+    { 127,  127, "-P 4 2ab", "P 4/m b m", "P 4/m 21/b 2/m", "P4/m b m", 3299,16 },
+    { 128,  128, "-P 4 2n", "P 4/m n c", "P 4/m 21/n 2/c", "P4/m n c", 3315,16 },
+    { 129,  129, "-P 4a 2a (x-1/4,y+1/4,z)", "P 4/n m m :1", "P 4/n 21/m 2/m", "P4/n m m", 3331,16 },
+    { 129,    0, "-P 4a 2a", "P 4/n m m :2", "", "", 3347,16 },
+    { 130,  130, "-P 4a 2ac (x-1/4,y+1/4,z)", "P 4/n c c :1", "P 4/n 2/c 2/c", "P4/n c c", 3363,16 },
+    { 130,    0, "-P 4a 2ac", "P 4/n c c :2", "", "", 3379,16 },
+    { 131,  131, "-P 4c 2", "P 42/m m c", "P 42/m 2/m 2/c", "P42/m m c", 3395,16 },
+    { 132,  132, "-P 4c 2c", "P 42/m c m", "P 42/m 2/c 2/m", "P42/m c m", 3411,16 },
+    { 133,  133, "-P 4ac 2b (x-1/4,y+1/4,z+1/4)", "P 42/n b c :1", "P 42/n 2/b 2/c", "P42/n b c", 3427,16 },
+    { 133,    0, "-P 4ac 2b", "P 42/n b c :2", "", "", 3443,16 },
+    { 134,  134, "-P 4ac 2bc (x-1/4,y+1/4,z-1/4)", "P 42/n n m :1", "P 42/n 2/n 2/m", "P42/n n m", 3459,16 },
+    { 134,    0, "-P 4ac 2bc", "P 42/n n m :2", "", "", 3475,16 },
+    { 135,  135, "-P 4c 2ab", "P 42/m b c", "P 42/m 21/b 2/c", "P42/m b c", 3491,16 },
+    { 136,  136, "-P 4n 2n", "P 42/m n m", "P 42/m 21/n 2/m", "P42/m n m", 3507,16 },
+    { 137,  137, "-P 4ac 2a (x-1/4,y+1/4,z+1/4)", "P 42/n m c :1", "P 42/n 21/m 2/c", "P42/n m c", 3523,16 },
+    { 137,    0, "-P 4ac 2a", "P 42/n m c :2", "", "", 3539,16 },
+    { 138,  138, "-P 4ac 2ac (x-1/4,y+1/4,z-1/4)", "P 42/n c m :1", "P 42/n 21/c 2/m", "P42/n c m", 3555,16 },
+    { 138,    0, "-P 4ac 2ac", "P 42/n c m :2", "", "", 3571,16 },
+    { 139,  139, "-I 4 2", "I 4/m m m", "I 4/m 2/m 2/m", "I4/m m m", 3587,32 },
+    { 140,  140, "-I 4 2c", "I 4/m c m", "I 4/m 2/c 2/m", "I4/m c m", 3619,32 },
+    { 141,  141, "-I 4bd 2 (x-1/2,y+1/4,z+1/8)", "I 41/a m d :1", "I 41/a 2/m 2/d", "I41/a m d", 3651,32 },
+    { 141,    0, "-I 4bd 2", "I 41/a m d :2", "", "", 3683,32 },
+    { 142,  142, "-I 4bd 2c (x-1/2,y+1/4,z-3/8)", "I 41/a c d :1", "I41/a c d", "I 41/a 2/c 2/d", 3715,32 },
+    { 142,    0, "-I 4bd 2c", "I 41/a c d :2", "", "", 3747,32 },
+    { 143,  143, " P 3", "P 3", "P 3", "", 3779,3 },
+    { 144,  144, " P 31", "P 31", "P 31", "", 3782,3 },
+    { 145,  145, " P 32", "P 32", "P 32", "", 3785,3 },
+    { 146,  146, " R 3", "R 3 :H", "H 3", "", 3788,9 },
+    { 146, 1146, " R 3 (-y+z,x+z,-x+y+z)", "R 3 :R", "R 3", "", 3797,3 },
+    { 147,  147, "-P 3", "P -3", "P -3", "", 3800,6 },
+    { 148,  148, "-R 3", "R -3 :H", "H -3", "", 3806,18 },
+    { 148, 1148, "-R 3 (-y+z,x+z,-x+y+z)", "R -3 :R", "R -3", "", 3824,6 },
+    { 149,  149, " P 3 2", "P 3 1 2", "P 3 1 2", "", 3830,6 },
+    { 150,  150, " P 3 2\"", "P 3 2 1", "P 3 2 1", "", 3836,6 },
+    { 151,  151, " P 31 2 (x,y,z+1/3)", "P 31 1 2", "P 31 1 2", "", 3842,6 },
+    { 152,  152, " P 31 2\"", "P 31 2 1", "P 31 2 1", "", 3848,6 },
+    { 153,  153, " P 32 2 (x,y,z+1/6)", "P 32 1 2", "P 32 1 2", "", 3854,6 },
+    { 154,  154, " P 32 2\"", "P 32 2 1", "P 32 2 1", "", 3860,6 },
+    { 155,  155, " R 3 2\"", "R 3 2 :H", "H 3 2", "", 3866,18 },
+    { 155, 1155, " R 3 2\" (-y+z,x+z,-x+y+z)", "R 3 2 :R", "R 3 2", "", 3884,6 },
+    { 156,  156, " P 3 -2\"", "P 3 m 1", "P 3 m 1", "", 3890,6 },
+    { 157,  157, " P 3 -2", "P 3 1 m", "P 3 1 m", "", 3896,6 },
+    { 158,  158, " P 3 -2\"c", "P 3 c 1", "P 3 c 1", "", 3902,6 },
+    { 159,  159, " P 3 -2c", "P 3 1 c", "P 3 1 c", "", 3908,6 },
+    { 160,  160, " R 3 -2\"", "R 3 m :H", "H 3 m", "", 3914,18 },
+    { 160, 1160, " R 3 -2\" (-y+z,x+z,-x+y+z)", "R 3 m :R", "R 3 m", "", 3932,6 },
+    { 161,  161, " R 3 -2\"c", "R 3 c :H", "H 3 c", "", 3938,18 },
+    { 161, 1161, " R 3 -2\"c (-y+z,x+z,-x+y+z)", "R 3 c :R", "R 3 c", "", 3956,6 },
+    { 162,  162, "-P 3 2", "P -3 1 m", "P -3 1 2/m", "P -3 1 m", 3962,12 },
+    { 163,  163, "-P 3 2c", "P -3 1 c", "P -3 1 2/c", "P -3 1 c", 3974,12 },
+    { 164,  164, "-P 3 2\"", "P -3 m 1", "P -3 2/m 1", "P -3 m 1", 3986,12 },
+    { 165,  165, "-P 3 2\"c", "P -3 c 1", "P -3 2/c 1", "P -3 c 1", 3998,12 },
+    { 166,  166, "-R 3 2\"", "R -3 m :H", "H -3 2/m", "H -3 m", 4010,36 },
+    { 166, 1166, "-R 3 2\" (-y+z,x+z,-x+y+z)", "R -3 m :R", "R -3 2/m", "R -3 m", 4046,12 },
+    { 167,  167, "-R 3 2\"c", "R -3 c :H", "H -3 2/c", "H -3 c", 4058,36 },
+    { 167, 1167, "-R 3 2\"c (-y+z,x+z,-x+y+z)", "R -3 c :R", "R -3 2/c", "R -3 c", 4094,12 },
+    { 168,  168, " P 6", "P 6", "P 6", "", 4106,6 },
+    { 169,  169, " P 61", "P 61", "P 61", "", 4112,6 },
+    { 170,  170, " P 65", "P 65", "P 65", "", 4118,6 },
+    { 171,  171, " P 62", "P 62", "P 62", "", 4124,6 },
+    { 172,  172, " P 64", "P 64", "P 64", "", 4130,6 },
+    { 173,  173, " P 6c", "P 63", "P 63", "", 4136,6 },
+    { 174,  174, " P -6", "P -6", "P -6", "", 4142,6 },
+    { 175,  175, "-P 6", "P 6/m", "P 6/m", "", 4148,12 },
+    { 176,  176, "-P 6c", "P 63/m", "P 63/m", "", 4160,12 },
+    { 177,  177, " P 6 2", "P 6 2 2", "P 6 2 2", "", 4172,12 },
+    { 178,  178, " P 61 2 (x,y,z+5/12)", "P 61 2 2", "P 61 2 2", "", 4184,12 },
+    { 179,  179, " P 65 2 (x,y,z+1/12)", "P 65 2 2", "P 65 2 2", "", 4196,12 },
+    { 180,  180, " P 62 2 (x,y,z+1/3)", "P 62 2 2", "P 62 2 2", "", 4208,12 },
+    { 181,  181, " P 64 2 (x,y,z+1/6)", "P 64 2 2", "P 64 2 2", "", 4220,12 },
+    { 182,  182, " P 6c 2c", "P 63 2 2", "P 63 2 2", "", 4232,12 },
+    { 183,  183, " P 6 -2", "P 6 m m", "P 6 m m", "", 4244,12 },
+    { 184,  184, " P 6 -2c", "P 6 c c", "P 6 c c", "", 4256,12 },
+    { 185,  185, " P 6c -2", "P 63 c m", "P 63 c m", "", 4268,12 },
+    { 186,  186, " P 6c -2c", "P 63 m c", "P 63 m c", "", 4280,12 },
+    { 187,  187, " P -6 2", "P -6 m 2", "P -6 m 2", "", 4292,12 },
+    { 188,  188, " P -6c 2", "P -6 c 2", "P -6 c 2", "", 4304,12 },
+    { 189,  189, " P -6 -2", "P -6 2 m", "P -6 2 m", "", 4316,12 },
+    { 190,  190, " P -6c -2c", "P -6 2 c", "P -6 2 c", "", 4328,12 },
+    { 191,  191, "-P 6 2", "P 6/m m m", "P 6/m 2/m 2/m", "P 6/m m m", 4340,24 },
+    { 192,  192, "-P 6 2c", "P 6/m c c", "P 6/m 2/c 2/c", "P 6/m c c", 4364,24 },
+    { 193,  193, "-P 6c 2", "P 63/m c m", "P 63/m 2/c 2/m", "P 63/m c m", 4388,24 },
+    { 194,  194, "-P 6c 2c", "P 63/m m c", "P 63/m 2/m 2/c", "P 63/m m c", 4412,24 },
+    { 195,  195, " P 2 2 3", "P 2 3", "P 2 3", "", 4436,12 },
+    { 196,  196, " F 2 2 3", "F 2 3", "F 2 3", "", 4448,48 },
+    { 197,  197, " I 2 2 3", "I 2 3", "I 2 3", "", 4496,24 },
+    { 198,  198, " P 2ac 2ab 3", "P 21 3", "P 21 3", "", 4520,12 },
+    { 199,  199, " I 2b 2c 3", "I 21 3", "I 21 3", "", 4532,24 },
+    { 200,  200, "-P 2 2 3", "P m -3", "P 2/m -3", "P m -3", 4556,24 },
+    { 201,  201, "-P 2ab 2bc 3 (x-1/4,y-1/4,z-1/4)", "P n -3 :1", "P 2/n -3", "P n -3", 4580,24 },
+    { 201,    0, "-P 2ab 2bc 3", "P n -3 :2", "", "", 4604,24 },
+    { 202,  202, "-F 2 2 3", "F m -3", "F 2/m -3", "F m -3", 4628,96 },
+    { 203,  203, "-F 2uv 2vw 3 (x+1/8,y+1/8,z+1/8)", "F d -3 :1", "F 2/d -3", "F d -3", 4724,96 },
+    { 203,    0, "-F 2uv 2vw 3", "F d -3 :2", "", "", 4820,96 },
+    { 204,  204, "-I 2 2 3", "I m -3", "I 2/m -3", "I m -3", 4916,48 },
+    { 205,  205, "-P 2ac 2ab 3", "P a -3", "P 21/a -3", "P a -3", 4964,24 },
+    { 206,  206, "-I 2b 2c 3", "I a -3", "I 21/a -3", "I a -3", 4988,48 },
+    { 207,  207, " P 4 2 3", "P 4 3 2", "P 4 3 2", "", 5036,24 },
+    { 208,  208, " P 4n 2 3", "P 42 3 2", "P 42 3 2", "", 5060,24 },
+    { 209,  209, " F 4 2 3", "F 4 3 2", "F 4 3 2", "", 5084,96 },
+    { 210,  210, " F 4d 2 3", "F 41 3 2", "F 41 3 2", "", 5180,96 },
+    { 211,  211, " I 4 2 3", "I 4 3 2", "I 4 3 2", "", 5276,48 },
+    { 212,  212, " P 4acd 2ab 3", "P 43 3 2", "P 43 3 2", "", 5324,24 },
+    { 213,  213, " P 4bd 2ab 3", "P 41 3 2", "P 41 3 2", "", 5348,24 },
+    { 214,  214, " I 4bd 2c 3", "I 41 3 2", "I 41 3 2", "", 5372,48 },
+    { 215,  215, " P -4 2 3", "P -4 3 m", "P -4 3 m", "", 5420,24 },
+    { 216,  216, " F -4 2 3", "F -4 3 m", "F -4 3 m", "", 5444,96 },
+    { 217,  217, " I -4 2 3", "I -4 3 m", "I -4 3 m", "", 5540,48 },
+    { 218,  218, " P -4n 2 3", "P -4 3 n", "P -4 3 n", "", 5588,24 },
+    { 219,  219, " F -4a 2 3", "F -4 3 c", "F -4 3 c", "", 5612,96 },
+    { 220,  220, " I -4bd 2c 3", "I -4 3 d", "I -4 3 d", "", 5708,48 },
+    { 221,  221, "-P 4 2 3", "P m -3 m", "P 4/m -3 2/m", "P m -3 m", 5756,48 },
+    { 222,  222, "-P 4a 2bc 3 (x-1/4,y-1/4,z-1/4)", "P n -3 n :1", "P 4/n -3 2/n", "P n -3 n", 5804,48 },
+    { 222,    0, "-P 4a 2bc 3", "P n -3 n :2", "", "", 5852,48 },
+    { 223,  223, "-P 4n 2 3", "P m -3 n", "P 42/m -3 2/n", "P m -3 n", 5900,48 },
+    { 224,  224, "-P 4bc 2bc 3 (x+1/4,y+1/4,z+1/4)", "P n -3 m :1", "P 42/n -3 2/m", "P n -3 m", 5948,48 },
+    { 224,    0, "-P 4bc 2bc 3", "P n -3 m :2", "", "", 5996,48 },
+    { 225,  225, "-F 4 2 3", "F m -3 m", "F 4/m -3 2/m", "F m -3 m", 6044,192 },
+    { 226,  226, "-F 4a 2 3", "F m -3 c", "F 4/m -3 2/c", "F m -3 c", 6236,192 },
+    { 227,  227, "-F 4vw 2vw 3 (x+1/8,y+1/8,z+1/8)", "F d -3 m :1", "F 41/d -3 2/m", "F d -3 m", 6428,192 },
+    { 227,    0, "-F 4vw 2vw 3", "F d -3 m :2", "", "", 6620,192 },
+    { 228,  228, "-F 4ud 2vw 3 (x-1/8,y-1/8,z-1/8)", "F d -3 c :1", "F d -3 c", "F 41/d -3 2/c", 6812,192 },
+    { 228,    0, "-F 4ud 2vw 3", "F d -3 c :2", "", "", 7004,192 },
+    { 229,  229, "-I 4 2 3", "I m -3 m", "I 4/m -3 2/m", "I m -3 m", 7196,96 },
+    { 230,  230, "-I 4bd 2c 3", "I a -3 d", "I 41/a -3 2/d", "I a -3 d", 7292,96 },
+    {   5, 5005, " C 2y (x+1/4,y+1/4,-x+z-1/4)", "I 1 21 1", "I 1 21 1", "", 7388,4 },
+    {   5, 3005, " C 2y (x+1/4,y+1/4,z)", "C 1 21 1", "C 1 21 1", "", 7392,4 },
+    {   8, 1008, " B -2", "B 1 1 m", "B 1 1 m", "", 7396,4 },
+    {  18, 1018, " P 2 2ab (x+1/4,y+1/4,z)", "", "P 21 21 2 (a)", "", 7400,4 },
+    {  20, 1020, " C 2c 2 (x+1/4,y,z)", "", "C 2 2 21a)", "", 7404,8 },
+    {  21, 1021, " C 2 2 (x+1/4,y+1/4,z)", "", "C 2 2 2a", "", 7412,8 },
+    {  22, 1022, " F 2 2 (x,y,z+1/4)", "", "F 2 2 2a", "", 7420,16 },
+    {  23, 1023, " I 2 2 (x-1/4,y+1/4,z-1/4)", "", "I 2 2 2a", "", 7436,8 },
+    {  94, 1094, " P 4n 2n (x-1/4,y-1/4,z-1/4)", "", "P 42 21 2a", "", 7444,8 },
+    { 197, 1197, " I 2 2 3 (x+1/4,y+1/4,z+1/4)", "", "I 2 3a", "", 7452,24 }
+  };
+
+
+  //  ===============================================================
+  //
+  //   Space group names are kept in an open-address hash table,
+  // made by InitSymInfo() during static initialization. Each entry
+  // refers to a group and the kind of key: names are compared as
+  // they are, Hall symbols -- without leading and trailing spaces,
+  // and CCP4 numbers are hashed by their decimal text and compared
+  // as integers.
+
+  enum SYMINFO_KEY  {
+    SKEY_Name   = 1,  // Hermann-Mauguin symbol or CCP4 name
+    SKEY_Hall   = 2,  // Hall symbol
+    SKEY_Number = 3   // CCP4 space group number
+  };
+
+  const int SymInfoHashSize = 4096;  // must be a power of 2
+
+  static short SymInfoHashGroup[SymInfoHashSize]; // group+1, 0 if none
+  static byte  SymInfoHashKind [SymInfoHashSize];
+  static cpstr SymInfoHashName [SymInfoHashSize];
+
+  static bool InitSymInfo();
+  static bool SymInfoInit = InitSymInfo();
+
+  static unsigned int symInfoHash ( int kind, cpstr S, int len )  {
+  //  FNV-1a
+  unsigned int h;
+  int          i;
+    h = 2166136261U ^ (unsigned int)kind;
+    for (i=0;i<len;i++)  {
+      h ^= (unsigned char)S[i];
+      h *= 16777619U;
+    }
+    return h;
+  }
+
+  static void trimName ( cpstr & S, int & len )  {
+    while (*S==' ')  S++;
+    len = strlen ( S );
+    while ((len>0) && (S[len-1]==' '))  len--;
+  }
+
+  static int symInfoSlot ( int kind, cpstr S, int len, int number )  {
+  //  Returns the slot holding the key, or an empty slot if the key
+  //  is not in the table
+  cpstr p;
+  int   k,l;
+    k = int(symInfoHash(kind,S,len) & (SymInfoHashSize-1));
+    while (SymInfoHashGroup[k])  {
+      if (SymInfoHashKind[k]==kind)  {
+        if (kind==SKEY_Number)  {
+          if (SymInfoGroups[SymInfoHashGroup[k]-1].ccp4==number)
+            return k;
+        } else  {
+          p = SymInfoHashName[k];
+          if (kind==SKEY_Hall)  trimName ( p,l );
+                          else  l = strlen ( p );
+          if ((l==len) && (!strncmp(p,S,len)))  return k;
+        }
+      }
+      k = (k+1) & (SymInfoHashSize-1);
+    }
+    return k;
+  }
+
+  static void addSymInfoKey ( int kind, cpstr name, int group )  {
+  char  N[20];
+  cpstr S;
+  int   k,len;
+    S = name;
+    if (kind==SKEY_Number)  {
+      sprintf ( N,"%i",SymInfoGroups[group].ccp4 );
+      S   = N;
+      len = strlen ( N );
+    } else if (kind==SKEY_Hall)
+      trimName ( S,len );
+    else
+      len = strlen ( S );
+    if (len<=0)  return;
+    k = symInfoSlot ( kind,S,len,SymInfoGroups[group].ccp4 );
+    if (!SymInfoHashGroup[k])  {  // first setting with the key wins
+      SymInfoHashGroup[k] = short(group+1);
+      SymInfoHashKind [k] = byte(kind);
+      SymInfoHashName [k] = name;
+    }
+  }
+
+  static bool InitSymInfo()  {
+  int i;
+    for (i=0;i<SymInfoHashSize;i++)  {
+      SymInfoHashGroup[i] = 0;
+      SymInfoHashKind [i] = 0;
+      SymInfoHashName [i] = NULL;
+    }
+    for (i=0;i<nSymInfoGroups;i++)  {
+      addSymInfoKey ( SKEY_Name,SymInfoGroups[i].xHM ,i );
+      addSymInfoKey ( SKEY_Name,SymInfoGroups[i].old1,i );
+      addSymInfoKey ( SKEY_Name,SymInfoGroups[i].old2,i );
+      addSymInfoKey ( SKEY_Hall,SymInfoGroups[i].hall,i );
+      if (SymInfoGroups[i].ccp4>0)
+        addSymInfoKey ( SKEY_Number,NULL,i );
+    }
+    SymInfoInit = true;
+    return true;
+  }
+
+  int  findSymInfoGroup ( cpstr SpaceGroup )  {
+  char  N[20];
+  cpstr S;
+  int   i,k,len,kind,number;
+
+    if (!SymInfoInit)  InitSymInfo();
+    if (!SpaceGroup)   return -1;
+
+    number = 0;
+    if (!strncasecmp(SpaceGroup,"Hall:",5))  {
+      kind = SKEY_Hall;
+      S    = &(SpaceGroup[5]);
+      trimName ( S,len );
+    } else  {
+      S = SpaceGroup;
+      trimName ( S,len );
+      for (i=0;(i<len) && (S[i]>='0') && (S[i]<='9');i++);
+      if ((len>0) && (i>=len) && (len<9))  {
+        kind   = SKEY_Number;
+        number = atoi ( S );
+        sprintf ( N,"%i",number );
+        S   = N;
+        len = strlen ( N );
+      } else  {
+        kind = SKEY_Name;
+        S    = SpaceGroup;
+        len  = strlen ( S );
+      }
+    }
+    if (len<=0)  return -1;
+
+    k = symInfoSlot ( kind,S,len,number );
+    return SymInfoHashGroup[k]-1;
+
+  }
+
+  void  getSymInfoTMatrix ( int k, mat44 & T )  {
+  int i,j;
+    for (i=0;i<3;i++)  {
+      for (j=0;j<3;j++)
+        T[i][j] = SymInfoOps[k].r[3*i+j];
+      T[i][3] = SymInfoOps[k].t[i]/24.0;
+      T[3][i] = 0.0;
+    }
+    T[3][3] = 1.0;
+  }
+
+}  // namespace mmdb
@@ -0,0 +1,106 @@
+//  $Id: mmdb_syminfo.h $
+//  =================================================================
+//
+//   CCP4 Coordinate Library: support of coordinate-related
+//   functionality in protein crystallography applications.
+//
+//   Copyright (C) The MMDB contributors 2026.
+//
+//    This library is free software: you can redistribute it and/or
+//    modify it under the terms of the GNU Lesser General Public
+//    License version 3, modified in accordance with the provisions
+//    of the license to address the requirements of UK law.
+//
+//    You should have received a copy of the modified GNU Lesser
+//    General Public License along with this library. If not, copies
+//    may be downloaded from http://www.ccp4.ac.uk/ccp4license.php
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU Lesser General Public License for more details.
+//
+//  =================================================================
+//
+//    18.10.26   <--  Date of Last Modification.
+//                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  -----------------------------------------------------------------
+//
+//  **** Module  :  mmdb_syminfo <interface>
+//       ~~~~~~~~~
+//       Project :  MacroMolecular Data Base (MMDB)
+//       ~~~~~~~~~
+//  **** Functions :  mmdb::findSymInfoGroup  ( space group lookup  )
+//       ~~~~~~~~~~~  mmdb::getSymInfoTMatrix ( operator matrix     )
+//
+//  **** Constants :  mmdb::SymInfoOps    ( symmetry operators      )
+//       ~~~~~~~~~~~  mmdb::SymInfoOpList ( operators of groups     )
+//                    mmdb::SymInfoGroups ( space group settings    )
+//
+//  (C) The MMDB contributors 2026
+//
+//  =================================================================
+//
+
+#ifndef __MMDB_SymInfo__
+#define __MMDB_SymInfo__
+
+#include "mmdb_defs.h"
+
+namespace mmdb  {
+
+  //  ===============================================================
+  //
+  //   Compiled-in space group table made from CCP4's syminfo.lib.
+  // The tables are constant and shared by all SymOps objects, so
+  // that setting a space group needs neither the library file nor
+  // parsing of the operators.
+  //
+  //  ===============================================================
+
+  const int nSymInfoGroups = 540;   // number of space group settings
+  const int nSymInfoOps    = 1189;  // number of distinct operators
+  const int nSymInfoOpList = 7476;  // total number of operators
+
+  DefineStructure(SymInfoOp);
+
+  struct SymInfoOp  {
+    cpstr       op;    // operator as given by SymOp::GetSymOp()
+    signed char r[9];  // rotation part, row by row
+    signed char t[3];  // translation part, in 1/24th
+  };
+
+  DefineStructure(SymInfoGroup);
+
+  struct SymInfoGroup  {
+    int   number;  // standard space group number
+    int   ccp4;    // CCP4 space group number, 0 if not a CCP4 group
+    cpstr hall;    // Hall symbol
+    cpstr xHM;     // extended Hermann-Mauguin symbol
+    cpstr old1;    // CCP4 names of the group, empty if absent
+    cpstr old2;
+    int   op1;     // operators of the group are SymInfoOps[k] with
+    int   nOps;    //   k=SymInfoOpList[op1...op1+nOps-1]
+  };
+
+  extern SymInfoOp    const SymInfoOps   [nSymInfoOps];
+  extern short        const SymInfoOpList[nSymInfoOpList];
+  extern SymInfoGroup const SymInfoGroups[nSymInfoGroups];
+
+  //   findSymInfoGroup(..) returns index of the space group setting
+  // in SymInfoGroups[], or -1 if the group is not found. SpaceGroup
+  // may be given as
+  //    - extended Hermann-Mauguin symbol or CCP4 name, e.g. "P 21"
+  //      or "P 1 21 1", case-sensitive as in syminfo.lib;
+  //    - Hall symbol prefixed with "Hall:", e.g. "Hall: P 2yb";
+  //    - CCP4 space group number, e.g. "4" or "1003".
+  // If several settings match, the first one found in syminfo.lib
+  // is returned. Lookups are hashed and do not scan the table.
+  extern int  findSymInfoGroup  ( cpstr SpaceGroup );
+
+  //   getSymInfoTMatrix(..) returns matrix of operator SymInfoOps[k].
+  extern void getSymInfoTMatrix ( int k, mat44 & T );
+
+}  // namespace mmdb
+
+#endif
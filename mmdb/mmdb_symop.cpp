@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -44,6 +44,7 @@
 #include <math.h>
 
 #include "mmdb_symop.h"
+#include "mmdb_syminfo.h"
 
 namespace mmdb  {
 
@@ -95,6 +96,12 @@ namespace mmdb  {
 
   }
 
+  void SymOp::PutSymOp ( cpstr XYZOperation, mat44 & TMatrix )  {
+    CreateCopy ( XYZOp,XYZOperation );
+    DelSpaces  ( XYZOp );
+    SetTMatrix ( TMatrix );
+  }
+
   pstr SymOp::GetSymOp()  {
     if (XYZOp)  return XYZOp;
           else  return pstr("");
@@ -545,10 +552,41 @@ namespace mmdb  {
   }
 
 
-  #define  syminfo_file  cpstr("syminfo.lib")
-
   int  SymOps::SetGroup ( cpstr SpaceGroup,
                            cpstr syminfo_lib )  {
+  mat44 T;
+  int   i,k,n;
+
+    if (syminfo_lib)  {
+      if (syminfo_lib[0])
+        return SetGroupFile ( SpaceGroup,syminfo_lib );
+    }
+
+    FreeMemory();
+
+    CreateCopy ( SpGroup,SpaceGroup );
+
+    n = findSymInfoGroup ( SpGroup );
+    if (n<0)  return SYMOP_UnknownSpaceGroup;
+
+    Nops  = SymInfoGroups[n].nOps;
+    symOp = new PSymOp[Nops];
+    for (i=0;i<Nops;i++)  {
+      k = SymInfoOpList[SymInfoGroups[n].op1+i];
+      getSymInfoTMatrix ( k,T );
+      symOp[i] = new SymOp();
+      symOp[i]->PutSymOp ( SymInfoOps[k].op,T );
+    }
+
+    return SYMOP_Ok;
+
+  }
+
+
+  #define  syminfo_file  cpstr("syminfo.lib")
+
+  int  SymOps::SetGroupFile ( cpstr SpaceGroup,
+                              cpstr syminfo_lib )  {
   io::File f;
   pstr     p;
   psvector lines,lines1;
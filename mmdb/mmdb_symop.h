@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -61,6 +61,8 @@ namespace mmdb  {
       ~SymOp();
 
       int  SetSymOp  ( cpstr XYZOperation );
+      void PutSymOp  ( cpstr XYZOperation, mat44 & TMatrix );
+                         // sets operation without parsing it
       pstr GetSymOp  ();
 
       void Transform ( realtype & x, realtype & y, realtype & z );
@@ -120,7 +122,9 @@ namespace mmdb  {
 
       int  SetGroup ( cpstr SpaceGroup,
                       cpstr syminfo_lib=NULL );
-        // Space Group is taken from syminfo.lib. Return Code:
+        // Space Group is taken from the compiled-in copy of
+        // syminfo.lib (see mmdb_syminfo.h), or from file syminfo_lib
+        // if its name is given. Return Code:
         // SYMOP_Ok <=> success
 
       void Reset           ();        // removes all symmetry operations
@@ -156,7 +160,8 @@ namespace mmdb  {
       int     Nops;
       PPSymOp symOp;
 
-      void InitSymOps();
+      void InitSymOps  ();
+      int  SetGroupFile( cpstr SpaceGroup, cpstr syminfo_lib );
 
   };
 
@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -54,6 +54,12 @@
 
 namespace mmdb  {
 
+  //  Hash indices of element and residue names are made by
+  // InitTables() during static initialization; it is harmless to
+  // call InitTables() again.
+
+  static bool TablesInit = InitTables();
+
   //  ===============================================================
 
   cpstr const ElementName[nElementNames] = {
@@ -241,80 +247,78 @@ namespace mmdb  {
     return isThere;
   }
 
-  int  getElementNo ( cpstr element )  {
-  int  type=0;
-  char El[3];
+  bool isHydrogen ( cpstr element )  {
+  cpstr e;
+    e = element;
+    while (*e==' ')  e++;
+    if ((e[0]=='H') || (e[0]=='D'))
+      return (!e[1]) || (e[1]==' ');
+    return false;
+  }
+
+  //   Element names consist of two characters, each being either a
+  // space or a letter, so that every name maps on its own cell of
+  // a 27x27 table. ElementHash[] keeps element numbers (1...) in
+  // the cells, and 0 in cells not corresponding to any element.
+
+  const int ElementHashSize = 27*27;
+
+  static short ElementHash[ElementHashSize];
+
+  static int elementHashCode ( char c )  {
+    if (c==' ')               return 0;
+    if ((c>='A') && (c<='Z'))  return c-'A'+1;
+    if ((c>='a') && (c<='z'))  return c-'a'+1;
+    return -1;
+  }
+
+  static int elementHashKey ( cpstr element )  {
+  int c1,c2;
     if ((!element[1]) || (element[1]==' '))  {
-      El[0] = ' ';
-      El[1] = element[0];
+      c1 = 0;
+      c2 = elementHashCode ( element[0] );
     } else  {
-      El[0] = element[0];
-      El[1] = element[1];
+      c1 = elementHashCode ( element[0] );
+      c2 = elementHashCode ( element[1] );
     }
-    El[2] = char(0);
-    UpperCase ( El );
-    while (type<nElementNames)
-      if (!strcmp(El,ElementName[type]))  break;
-                                    else  type++;
-    if (type>=nElementNames)  return ELEMENT_UNKNOWN;
-    return type+1;  // so that hydrogen is 1
+    if ((c1<0) || (c2<=0))  return -1;
+    return 27*c1 + c2;
+  }
+
+  int  getElementNo ( cpstr element )  {
+  int key;
+    if (!TablesInit)  InitTables();
+    key = elementHashKey ( element );
+    if ((key<0) || (!ElementHash[key]))  return ELEMENT_UNKNOWN;
+    return ElementHash[key];  // so that hydrogen is 1
+  }
+
+  realtype  getMolecWeight ( int elementNo )  {
+    if ((elementNo<1) || (elementNo>nElementNames))  return 1.0;
+    return MolecWeight[elementNo-1];
+  }
+
+  realtype  getCovalentRadius ( int elementNo )  {
+    if ((elementNo<1) || (elementNo>nElementNames))
+      return 2.2*CovalentRadius[0];
+    return CovalentRadius[elementNo-1];
+  }
+
+  realtype  getVdWaalsRadius ( int elementNo )  {
+    if ((elementNo<1) || (elementNo>nElementNames))  return 1.8;
+    return VdWaalsRadius[elementNo-1];
   }
 
   realtype  getMolecWeight ( cpstr element )  {
-  int  type=0;
-  char El[3];
-    if ((!element[1]) || (element[1]==' '))  {
-      El[0] = ' ';
-      El[1] = element[0];
-    } else  {
-      El[0] = element[0];
-      El[1] = element[1];
-    }
-    El[2] = char(0);
-    UpperCase ( El );
-    while (type<nElementNames)
-      if (!strcmp(El,ElementName[type]))  break;
-                                    else  type++;
-    if (type>=nElementNames)  return 1.0;
-    return MolecWeight[type];
+    return getMolecWeight ( getElementNo(element) );
   }
 
   realtype  getCovalentRadius ( cpstr element )  {
-  int  type=0;
-  char El[3];
-    if ((!element[1]) || (element[1]==' '))  {
-      El[0] = ' ';
-      El[1] = element[0];
-    } else  {
-      El[0] = element[0];
-      El[1] = element[1];
-    }
-    El[2] = char(0);
-    UpperCase ( El );
-    while (type<nElementNames)
-      if (!strcmp(El,ElementName[type]))  break;
-                                    else  type++;
-    if (type>=nElementNames)  return 2.2*CovalentRadius[0];
-    return CovalentRadius[type];
+    return getCovalentRadius ( getElementNo(element) );
   }
 
   realtype  getVdWaalsRadius ( cpstr element )  {
-  int  type=0;
-  char El[3];
-    if ((!element[1]) || (element[1]==' '))  {
-      El[0] = ' ';
-      El[1] = element[0];
-    } else  {
-      El[0] = element[0];
-      El[1] = element[1];
-    }
-    El[2] = char(0);
-    UpperCase ( El );
-    while (type<nElementNames)
-      if (!strcmp(El,ElementName[type]))  break;
-                                    else  type++;
-    if (type>=nElementNames)  return 1.8;
-    return VdWaalsRadius[type];
+    return getVdWaalsRadius ( getElementNo(element) );
   }
 
   cpstr const ResidueName[nResNames] = {
@@ -581,42 +585,74 @@ namespace mmdb  {
   };
 
 
+  //   Residue names of up to 3 characters are packed into integer
+  // keys and kept in an open-address hash table together with their
+  // RESCLASS_XXXX codes, so that residue names are classified
+  // without string comparisons. The table is filled with solvent,
+  // aminoacid and nucleotide names.
+
+  const int ResClassHashSize = 256;  // must be a power of 2
+
+  static int  ResClassKey [ResClassHashSize];
+  static byte ResClassCode[ResClassHashSize];
+
+  int  getResidueKey ( cpstr resName )  {
+  int key,i;
+    key = 0;
+    for (i=0;(i<3) && resName[i];i++)
+      key |= int((unsigned char)resName[i]) << (8*i);
+    if (resName[i])  return 0;  // longer than 3 characters
+    return key;
+  }
+
+  static int resClassSlot ( int key )  {
+  unsigned int h;
+  int          k;
+    h = ((unsigned int)key)*2654435761U;
+    k = int((h >> 16) & (ResClassHashSize-1));
+    while (ResClassKey[k] && (ResClassKey[k]!=key))
+      k = (k+1) & (ResClassHashSize-1);
+    return k;
+  }
+
+  static void addResClass ( cpstr resName, int code )  {
+  int key,k;
+    key = getResidueKey ( resName );
+    k   = resClassSlot  ( key );
+    ResClassKey [k]  = key;
+    ResClassCode[k] |= byte(code);
+  }
+
+  int  getResidueClass ( int resKey )  {
+    if (!TablesInit)  InitTables();
+    if (!resKey)  return RESCLASS_Unknown;
+    return ResClassCode[resClassSlot(resKey)];
+  }
+
+  int  getResidueClass ( cpstr resName )  {
+    return getResidueClass ( getResidueKey(resName) );
+  }
+
   bool isSolvent ( cpstr resName )  {
-  bool isThere;
-  int     i;
-    isThere = false;
-    for (i=0;(i<nSolventNames) && (!isThere);i++)
-      isThere = (!strcmp(StdSolventName[i],resName));
-    return isThere;
+    return (getResidueClass(resName) & RESCLASS_Solvent)!=0;
   }
 
   bool isAminoacid ( cpstr resName )  {
-  bool isThere;
-  int     i;
-    isThere = false;
-    for (i=0;(i<nAminoacidNames) && (!isThere);i++)
-      isThere = (!strcmp(AAProperties[i].name,resName));
-    return isThere;
+    return (getResidueClass(resName) & RESCLASS_Aminoacid)!=0;
   }
 
   bool isNucleotide ( cpstr resName )  {
-  bool isThere;
-  int     i;
-    isThere = false;
-    for (i=0;(i<nNucleotideNames) && (!isThere);i++)
-      isThere = (!strcmp(NucleotideName[i],resName));
-    return isThere;
+    return (getResidueClass(resName) & RESCLASS_Nucleotide)!=0;
   }
 
   int isDNARNA ( cpstr resName )  {
-  bool isThere;
-  int     i;
-    isThere = false;
-    for (i=0;(i<nNucleotideNames) && (!isThere);i++)
-      isThere = (!strcmp(NucleotideName[i],resName));
-    if (!isThere)         return 0;  // neither
-    if (resName[0]=='D')  return 1;  // DNA
-    return 2;                        // RNA
+    return resClassDNARNA ( getResidueClass(resName) );
+  }
+
+  int resClassDNARNA ( int resClass )  {
+    if (!(resClass & RESCLASS_Nucleotide))  return 0;  // neither
+    if (resClass & RESCLASS_DNA)            return 1;  // DNA
+    return 2;                                          // RNA
   }
 
   bool isSugar ( cpstr resName )  {
@@ -745,4 +781,186 @@ namespace mmdb  {
 
   }
 
+
+  //  -------  Polar atoms
+
+  #define PA_D   PATOM_Donor
+  #define PA_A   PATOM_Acceptor
+  #define PA_DA  (PATOM_Donor | PATOM_Acceptor)
+  #define PA_DC  (PATOM_Donor | PATOM_Cation)
+  #define PA_AN  (PATOM_Acceptor | PATOM_Anion)
+
+  PolarAtom const PolarAtoms[nPolarAtoms] = {
+    { "*AA", "N",   PA_D  },  { "*AA", "O",   PA_A  },
+    { "*AA", "OXT", PA_AN },  { "PRO", "N",   0     },
+    { "ARG", "NE",  PA_DC },  { "ARG", "NH1", PA_DC },
+    { "ARG", "NH2", PA_DC },  { "ASN", "OD1", PA_A  },
+    { "ASN", "ND2", PA_D  },  { "ASP", "OD1", PA_AN },
+    { "ASP", "OD2", PA_AN },  { "GLN", "OE1", PA_A  },
+    { "GLN", "NE2", PA_D  },  { "GLU", "OE1", PA_AN },
+    { "GLU", "OE2", PA_AN },  { "HIS", "ND1", PA_DA },
+    { "HIS", "NE2", PA_DA },  { "LYS", "NZ",  PA_DC },
+    { "SER", "OG",  PA_DA },  { "THR", "OG1", PA_DA },
+    { "TRP", "NE1", PA_D  },  { "TYR", "OH",  PA_DA },
+    { "*NA", "OP1", PA_AN },  { "*NA", "OP2", PA_AN },
+    { "*NA", "OP3", PA_AN },  { "*NA", "O1P", PA_AN },
+    { "*NA", "O2P", PA_AN },  { "*NA", "O3P", PA_AN },
+    { "*NA", "O2'", PA_DA },  { "*NA", "O3'", PA_A  },
+    { "*NA", "O4'", PA_A  },  { "*NA", "O5'", PA_A  },
+    { "*NA", "O2*", PA_DA },  { "*NA", "O3*", PA_A  },
+    { "*NA", "O4*", PA_A  },  { "*NA", "O5*", PA_A  },
+    { "A",   "N1",  PA_A  },  { "A",   "N3",  PA_A  },
+    { "A",   "N6",  PA_D  },  { "A",   "N7",  PA_A  },
+    { "A",   "N9",  0     },  { "C",   "N1",  0     },
+    { "C",   "O2",  PA_A  },  { "C",   "N3",  PA_A  },
+    { "C",   "N4",  PA_D  },  { "G",   "N1",  PA_D  },
+    { "G",   "N2",  PA_D  },  { "G",   "N3",  PA_A  },
+    { "G",   "O6",  PA_A  },  { "G",   "N7",  PA_A  },
+    { "G",   "N9",  0     },  { "I",   "N1",  PA_D  },
+    { "I",   "N3",  PA_A  },  { "I",   "O6",  PA_A  },
+    { "I",   "N7",  PA_A  },  { "I",   "N9",  0     },
+    { "T",   "N1",  0     },  { "T",   "O2",  PA_A  },
+    { "T",   "N3",  PA_D  },  { "T",   "O4",  PA_A  },
+    { "U",   "N1",  0     },  { "U",   "O2",  PA_A  },
+    { "U",   "N3",  PA_D  },  { "U",   "O4",  PA_A  },
+    { "HOH", "O",   PA_DA },  { "WAT", "O",   PA_DA },
+    { "H2O", "O",   PA_DA },  { "DOD", "O",   PA_DA },
+    { "TIP", "O",   PA_DA },  { "MOH", "O",   PA_DA }
+  };
+
+  #undef PA_D
+  #undef PA_A
+  #undef PA_DA
+  #undef PA_DC
+  #undef PA_AN
+
+  //   PolarAtoms[] are indexed by an open-address hash table keyed
+  // by the residue key (see getResidueKey(..)) and the atom name of
+  // up to 4 characters packed into an integer. Atom names may be
+  // padded with spaces; the name is taken from the first non-space
+  // character up to the next space.
+
+  const int PolarHashSize = 256;  // must be a power of 2
+
+  static int  PolarResKey [PolarHashSize];
+  static word PolarAtomKey[PolarHashSize];
+  static int  PolarIndex  [PolarHashSize];  // index+1 in PolarAtoms
+
+  static bool polarAtomKey ( cpstr atomName, word & key )  {
+  int i;
+    while (*atomName==' ')  atomName++;
+    key = 0;
+    for (i=0;atomName[i] && (atomName[i]!=' ');i++)  {
+      if (i>=4)  return false;
+      key = (key << 8) | word((unsigned char)atomName[i]);
+    }
+    return true;
+  }
+
+  static int polarSlot ( int resKey, word atomKey )  {
+  unsigned int h;
+  int          k;
+    h = (((unsigned int)resKey)*2654435761U) ^ (atomKey*40503U);
+    k = int((h >> 16) & (PolarHashSize-1));
+    while (PolarIndex[k] && ((PolarResKey[k]!=resKey) ||
+                             (PolarAtomKey[k]!=atomKey)))
+      k = (k+1) & (PolarHashSize-1);
+    return k;
+  }
+
+  static int findPolarAtom ( cpstr resName, cpstr atomName )  {
+  word atomKey;
+  int  resKey,k;
+    if (!TablesInit)  InitTables();
+    resKey = getResidueKey ( resName );
+    if ((!resKey) || (!polarAtomKey(atomName,atomKey)))  return -1;
+    k = polarSlot ( resKey,atomKey );
+    return PolarIndex[k]-1;
+  }
+
+  int getPolarAtomType ( cpstr resName, cpstr atomName,
+                         cpstr element )  {
+  char base[2];
+  int  i,n;
+
+    if (isAminoacid(resName))  {
+      i = findPolarAtom ( resName,atomName );
+      if (i<0)  i = findPolarAtom ( "*AA",atomName );
+      if (i>=0)  return PolarAtoms[i].flags;
+    } else if (isNucleotide(resName))  {
+      // nucleotide names end with the base letter, as in "DA"
+      n = strlen(resName);
+      base[0] = resName[n-1];
+      base[1] = char(0);
+      i = findPolarAtom ( base,atomName );
+      if (i<0)  i = findPolarAtom ( "*NA",atomName );
+      if (i>=0)  return PolarAtoms[i].flags;
+    } else  {
+      i = findPolarAtom ( resName,atomName );
+      if (i>=0)  return PolarAtoms[i].flags;
+    }
+
+    //  classify by element
+    while (*element==' ')  element++;
+    if (((element[0]=='N') || (element[0]=='O') ||
+         (element[0]=='n') || (element[0]=='o')) &&
+        ((!element[1]) || (element[1]==' ')))
+      return PATOM_Donor | PATOM_Acceptor;
+
+    return 0;
+
+  }
+
+
+
+  //  -------  Initialization of hash indices
+
+  bool InitTables()  {
+  word a;
+  int  i,k;
+
+    for (i=0;i<ElementHashSize;i++)
+      ElementHash[i] = 0;
+    for (i=nElementNames-1;i>=0;i--)  {
+      k = elementHashKey ( ElementName[i] );
+      if (k>=0)  ElementHash[k] = short(i+1);
+    }
+
+    for (i=0;i<ResClassHashSize;i++)  {
+      ResClassKey [i] = 0;
+      ResClassCode[i] = 0;
+    }
+    for (i=0;i<nSolventNames;i++)
+      addResClass ( StdSolventName[i],RESCLASS_Solvent );
+    for (i=0;i<nAminoacidNames;i++)
+      addResClass ( AAProperties[i].name,RESCLASS_Aminoacid );
+    for (i=0;i<nNucleotideNames;i++)
+      if (NucleotideName[i][0]=='D')
+        addResClass ( NucleotideName[i],
+                      RESCLASS_Nucleotide | RESCLASS_DNA );
+      else
+        addResClass ( NucleotideName[i],RESCLASS_Nucleotide );
+
+    for (i=0;i<PolarHashSize;i++)  {
+      PolarResKey [i] = 0;
+      PolarAtomKey[i] = 0;
+      PolarIndex  [i] = 0;
+    }
+    for (i=0;i<nPolarAtoms;i++)  {
+      //  table names are short and contain no spaces
+      k = getResidueKey ( PolarAtoms[i].resName );
+      polarAtomKey ( PolarAtoms[i].atomName,a );
+      k = polarSlot ( k,a );
+      if (!PolarIndex[k])  {
+        PolarResKey [k] = getResidueKey ( PolarAtoms[i].resName );
+        PolarAtomKey[k] = a;
+        PolarIndex  [k] = i+1;
+      }
+    }
+
+    TablesInit = true;
+    return true;
+
+  }
+
 } // namespace mmdb
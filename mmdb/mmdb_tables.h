@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -68,15 +68,29 @@ namespace mmdb  {
   extern realtype const VdWaalsRadius [nElementNames];
   extern realtype const IonicRadius   [nElementNames];
 
-  extern bool isMetal ( cpstr element );
+  extern bool isMetal    ( cpstr element );
+  //   isHydrogen(..) returns true for elements "H" and "D", which
+  // may be padded with spaces on either side.
+  extern bool isHydrogen ( cpstr element );
 
   const int ELEMENT_UNKNOWN = -1;
 
-  extern int      getElementNo      ( cpstr element );
+  //   InitTables() makes hash indices used by getElementNo(..) and
+  // getResidueClass(..). It is called automatically during static
+  // initialization, and may be called again harmlessly.
+  extern bool     InitTables        ();
+
+  extern int      getElementNo      ( cpstr element );  // 1.. or
+                                                // ELEMENT_UNKNOWN
   extern realtype getMolecWeight    ( cpstr element );
   extern realtype getCovalentRadius ( cpstr element );
   extern realtype getVdWaalsRadius  ( cpstr element );
 
+  //  These take element numbers as returned by getElementNo(..)
+  extern realtype getMolecWeight    ( int elementNo );
+  extern realtype getCovalentRadius ( int elementNo );
+  extern realtype getVdWaalsRadius  ( int elementNo );
+
   const int nResNames = 26;
 
   extern cpstr const ResidueName [nResNames];
@@ -118,9 +132,62 @@ namespace mmdb  {
   extern int  isDNARNA     ( cpstr resName ); // 0,1(DNA),2(RNA)
   extern bool isSugar      ( cpstr resName );
 
+  //  -------  Residue classes
+
+  enum RESIDUE_CLASS  {
+    RESCLASS_Unknown    = 0x00,
+    RESCLASS_Aminoacid  = 0x01,
+    RESCLASS_Nucleotide = 0x02,
+    RESCLASS_DNA        = 0x04,  // together with RESCLASS_Nucleotide
+    RESCLASS_Solvent    = 0x08
+  };
+
+  //   getResidueKey(..) packs residue name into an integer key, which
+  // is 0 for empty names and names longer than 3 characters.
+  // getResidueClass(..) returns a combination of RESCLASS_XXXX
+  // flags for the name or its key, and resClassDNARNA(..) converts
+  // the class into isDNARNA(..) code.
+  extern int  getResidueKey   ( cpstr resName  );
+  extern int  getResidueClass ( cpstr resName  );
+  extern int  getResidueClass ( int   resKey   );
+  extern int  resClassDNARNA  ( int   resClass );
+
   extern void  Get1LetterCode ( cpstr res3name, pstr res1code );
   extern void  Get3LetterCode ( cpstr res1name, pstr res3code );
 
+
+  //  -------  Polar atoms (H-bond donors and acceptors, charged atoms)
+
+  enum POLAR_ATOM_FLAG  {
+    PATOM_Donor    = 0x0001,
+    PATOM_Acceptor = 0x0002,
+    PATOM_Cation   = 0x0004,
+    PATOM_Anion    = 0x0008
+  };
+
+  DefineStructure(PolarAtom);
+
+  //   Residue name "*AA" stands for main chain atoms of any aminoacid,
+  // "*NA" -- for backbone atoms of any nucleotide; nucleotide bases
+  // are listed under names "A", "C", "G", "I", "T" and "U".
+  struct PolarAtom  {
+    char resName [4];  // residue name
+    char atomName[5];  // atom name, without spaces
+    int  flags;        // combination of PATOM_XXXX flags
+  };
+
+  const int nPolarAtoms = 70;
+
+  extern PolarAtom const PolarAtoms[nPolarAtoms];
+
+  //   getPolarAtomType(..) returns a combination of PATOM_XXXX flags
+  // for atom atomName of residue resName. Atoms of aminoacids and
+  // nucleotides are looked up in PolarAtoms[]; all other atoms, or
+  // atoms not found there, are classified by their chemical element:
+  // nitrogen and oxygen are taken both as donors and acceptors.
+  extern int getPolarAtomType ( cpstr resName, cpstr atomName,
+                                cpstr element );
+
 }  // namespace mmdb
 
 #endif
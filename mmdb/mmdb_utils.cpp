@@ -651,6 +651,40 @@ namespace mmdb  {
       }
   }
 
+  void  Mat4Transform ( mat44 & T, rvector x, rvector y, rvector z,
+                        int n )  {
+  //  The matrix is copied into scalars so that the loop may be
+  //  vectorized without reloading it after every store
+  realtype t00,t01,t02,t03, t10,t11,t12,t13, t20,t21,t22,t23;
+  realtype x1,y1,z1;
+  int      i;
+    t00 = T[0][0];  t01 = T[0][1];  t02 = T[0][2];  t03 = T[0][3];
+    t10 = T[1][0];  t11 = T[1][1];  t12 = T[1][2];  t13 = T[1][3];
+    t20 = T[2][0];  t21 = T[2][1];  t22 = T[2][2];  t23 = T[2][3];
+    for (i=0;i<n;i++)  {
+      x1   = t00*x[i] + t01*y[i] + t02*z[i] + t03;
+      y1   = t10*x[i] + t11*y[i] + t12*z[i] + t13;
+      z1   = t20*x[i] + t21*y[i] + t22*z[i] + t23;
+      x[i] = x1;
+      y[i] = y1;
+      z[i] = z1;
+    }
+  }
+
+  void  Mat4Transform ( mat44 & T, rvector x, rvector y, rvector z,
+                        rvector xt, rvector yt, rvector zt, int n )  {
+  realtype t00,t01,t02,t03, t10,t11,t12,t13, t20,t21,t22,t23;
+  int      i;
+    t00 = T[0][0];  t01 = T[0][1];  t02 = T[0][2];  t03 = T[0][3];
+    t10 = T[1][0];  t11 = T[1][1];  t12 = T[1][2];  t13 = T[1][3];
+    t20 = T[2][0];  t21 = T[2][1];  t22 = T[2][2];  t23 = T[2][3];
+    for (i=0;i<n;i++)  {
+      xt[i] = t00*x[i] + t01*y[i] + t02*z[i] + t03;
+      yt[i] = t10*x[i] + t11*y[i] + t12*z[i] + t13;
+      zt[i] = t20*x[i] + t21*y[i] + t22*z[i] + t23;
+    }
+  }
+
   void  Mat4Div1 ( mat44 & A, mat44 & B, mat44 & C )  {
   //  Calculates A=B^{-1}*C
   mat44 B1;
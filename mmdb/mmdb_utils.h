@@ -22,7 +22,7 @@
 //
 //  =================================================================
 //
-//    12.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  -----------------------------------------------------------------
 //
@@ -55,6 +55,7 @@
 //                   CIFGetInteger1 (reads and del-s int from CIF loop)
 //                   CIFGetReal1    (reads and del-s int from CIF loop)
 //                   Mat4Inverse    ( inversion of 4x4 matrices       )
+//                   Mat4Transform  ( transformation of point arrays  )
 //                   GetErrorDescription (ascii line to an Error_XXXXX)
 //                   ParseAtomID    ( parses atom ID line             )
 //                   ParseResID     ( parses residue ID line          )
@@ -185,6 +186,15 @@ namespace mmdb  {
   //  Calculates determinant of the rotation part
   extern realtype Mat4RotDet ( mat44 & T );
 
+  //  Transforms points (x[i],y[i],z[i]), i=0..n-1, by matrix T, in
+  //  place or into (xt[i],yt[i],zt[i]). The results are identical
+  //  to those of Atom::Transform(T), point by point.
+  extern void  Mat4Transform ( mat44 & T, rvector x, rvector y,
+                               rvector z, int n );
+  extern void  Mat4Transform ( mat44 & T, rvector x, rvector y,
+                               rvector z, rvector xt, rvector yt,
+                               rvector zt, int n );
+
   //  Sets up a unit matrix
   extern void  Mat4Init  ( mat44 & A );
   extern void  Mat3Init  ( mat33 & A );
@@ -458,6 +468,11 @@ namespace mmdb  {
 
   //  --------------------------------------------------------------
 
+  //   QuickSort sorts through virtual functions Compare(..) and
+  // Swap(..), and is kept for compatibility with existing derived
+  // classes. New code should use templates SortArray(..) and
+  // RadixSort(..) from mmdb_sort.h, which are considerably faster.
+
   DefineClass(QuickSort);
 
   class QuickSort : public io::Stream  {
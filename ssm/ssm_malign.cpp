@@ -23,7 +23,7 @@
 //
 // =================================================================
 //
-//    18.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //  ----------------------------------------------------------------
 //
@@ -53,7 +53,8 @@
 #include <math.h>
 
 #include "ssm_malign.h"
-#include "mmdb/mmdb_math_linalg.h"
+#include "mmdb/mmdb_math_superpose.h"
+#include "mmdb/mmdb_sort.h"
 
 // ---------------------------  ssm::MAStruct  -------------------------
 
@@ -650,9 +651,6 @@ ssm::MultAlign::~MultAlign()  {
   FreeMemory();
 
   mmdb::FreeMatrixMemory ( A,3,1,1 );  // correlation matrix
-  mmdb::FreeMatrixMemory ( Z,3,1,1 );  // left SVD vectors
-  mmdb::FreeMatrixMemory ( V,3,1,1 );  // right SVD vectors
-  mmdb::FreeVectorMemory ( W,1     );  // singular values
 
 }
 
@@ -766,9 +764,6 @@ void  ssm::MultAlign::InitMultAlign()  {
                        // iterations without quality improvement
 
   mmdb::GetMatrixMemory ( A,3,3,1,1 );  // correlation matrix
-  mmdb::GetMatrixMemory ( Z,3,3,1,1 );  // left SVD vectors
-  mmdb::GetMatrixMemory ( V,3,3,1,1 );  // right SVD vectors
-  mmdb::GetVectorMemory ( W,3,1     );  // singular values
 
   Map     = NULL;  // 0:i is mapped onto j:Map[i].map[j]
   Map_nrows =  0;  // number of rows in Map;
@@ -1376,20 +1371,17 @@ int       i,i1,j,k,m,rc;
 
 int  ssm::MultAlign::CalcRotation ( mmdb::mat44 & R )  {
 //   Given the correlation matrix A, this function calculates rotation
-// matrix R, optimally excluding the rotoinversion if occured
-mmdb::realtype det,B;
-int      i,j,k;
+// matrix R by the quaternion method, which always gives a proper
+// rotation
+mmdb::mat33    A0,R0;
+mmdb::realtype lambda;
+int            i,j;
 
-  det = A[1][1]*A[2][2]*A[3][3] +
-        A[1][2]*A[2][3]*A[3][1] +
-        A[2][1]*A[3][2]*A[1][3] -
-        A[1][3]*A[2][2]*A[3][1] -
-        A[1][1]*A[2][3]*A[3][2] -
-        A[3][3]*A[1][2]*A[2][1];
+  for (i=0;i<3;i++)
+    for (j=0;j<3;j++)
+      A0[i][j] = A[i+1][j+1];
 
-  mmdb::math::SVD ( 3,3,3,A,Z,V,W,vq,true,true,i );
-
-  if (i!=0) {
+  if (mmdb::math::QCPRotation(A0,0.0,R0,lambda)!=mmdb::math::QCP_Ok)  {
     for (i=0;i<4;i++)  {
       for (j=0;j<4;j++)
         R[i][j] = 0.0;
@@ -1398,29 +1390,11 @@ int      i,j,k;
     return 1;
   }
 
-  if (det<=0.0)  {
-    k = 0;
-    B = mmdb::MaxReal;
-    for (j=1;j<=3;j++)
-      if (W[j]<B)  {
-        B = W[j];
-        k = j;
-      }
-    for (j=1;j<=3;j++)
-      V[j][k] = -V[j][k];
+  for (i=0;i<3;i++)  {
+    for (j=0;j<3;j++)
+      R[i][j] = R0[i][j];
+    R[3][i] = 0.0;
   }
-
-  for (j=1;j<=3;j++)
-    for (k=1;k<=3;k++)  {
-      B = 0.0;
-      for (i=1;i<=3;i++)
-        B += Z[j][i]*V[k][i];
-      R[j-1][k-1] = B;
-    }
-
-  R[3][0] = 0.0;
-  R[3][1] = 0.0;
-  R[3][2] = 0.0;
   R[3][3] = 1.0;
 
   return 0;
@@ -1432,31 +1406,15 @@ int      i,j,k;
 
 namespace ssm {
 
-  DefineClass(SortMappings)
+  //  sorts mapping indices by decreasing rmsd
 
-  class SortMappings : public mmdb::QuickSort  {
-    public :
-      SortMappings() : mmdb::QuickSort() {}
-      int  Compare ( int i, int j );
-      void Sort    ( mmdb::ivector ci, int nc, PMAMap Map );
-    protected :
-      PMAMap M;
+  struct MappingLess  {
+    PMAMap M;
+    bool operator() ( int i, int j ) const  {
+      return (M[i].rmsd>M[j].rmsd);
+    }
   };
 
-  int SortMappings::Compare ( int i, int j )  {
-  mmdb::realtype ri,rj;
-    ri = M[((mmdb::ivector)data)[i]].rmsd;
-    rj = M[((mmdb::ivector)data)[j]].rmsd;
-    if (ri<rj)  return  1;
-    if (ri>rj)  return -1;
-    return 0;
-  }
-
-  void SortMappings::Sort ( mmdb::ivector ci, int nc, PMAMap Map )  {
-    M = Map;
-    mmdb::QuickSort::Sort ( &(ci[0]),nc );
-  }
-
 }
 
 //  ==============================================================
@@ -1661,7 +1619,7 @@ mmdb::realtype  NormN,Na2,NormR;
 }
 
 int  ssm::MultAlign::OptimizeAlignments()  {
-SortMappings sortMappings;
+MappingLess        mappingLess;
 mmdb::rvector      rmsd0;
 mmdb::ivector      ci;
 mmdb::realtype     rmsd,Qscore,r1,Q1;
@@ -1758,7 +1716,8 @@ bool      done;
 
     if (nc>0)  {
       // unmap atoms for increasing the Q-score
-      sortMappings.Sort ( ci,nc,Map );
+      mappingLess.M = Map;
+      mmdb::SortArray ( ci,nc,mappingLess );
       nalgn1 = nalgn;
       r1     = rmsd;
       k      = -1;
@@ -286,8 +286,7 @@ namespace ssm  {
       int   maxHollowIt; //!< maximal allowed number of consequtive
                          /// iterations without quality improvement
 
-      mmdb::rmatrix     A,Z,V; //!< corr-n matrix, left and right SVD vectors
-      mmdb::rvector         W; //!< singular values
+      mmdb::rmatrix         A; //!< correlation matrix
 
       PMAMap        Map; //!< Map maps 0:i<->j:Map[i].map[j]
 
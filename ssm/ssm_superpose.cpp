@@ -23,7 +23,7 @@
 //
 // =================================================================
 //
-//    16.09.13   <--  Date of Last Modification.
+//    18.10.26   <--  Date of Last Modification.
 //                   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // -----------------------------------------------------------------
 //
@@ -42,6 +42,7 @@
 #include <math.h>
 
 #include "mmdb/mmdb_math_bfgsmin.h"
+#include "mmdb/mmdb_math_superpose.h"
 #include "ssm_superpose.h"
 
 //  =================================================================
@@ -211,19 +212,11 @@ void ssm::SSEDesc::Copy ( RSSEDesc D )  {
 ssm::Superpose::Superpose()  {
   InitSuperpose();
   mmdb::GetMatrixMemory ( A  ,3,3,1,1 );
-  mmdb::GetMatrixMemory ( U  ,3,3,1,1 );
-  mmdb::GetMatrixMemory ( V  ,3,3,1,1 );
-  mmdb::GetVectorMemory ( W  ,3,1     );
-  mmdb::GetVectorMemory ( RV1,3,1     );
 }
 
 ssm::Superpose::~Superpose()  {
   FreeMemory();
   mmdb::FreeMatrixMemory ( A  ,3,1,1 );
-  mmdb::FreeMatrixMemory ( U  ,3,1,1 );
-  mmdb::FreeMatrixMemory ( V  ,3,1,1 );
-  mmdb::FreeVectorMemory ( W  ,1     );
-  mmdb::FreeVectorMemory ( RV1,1     );
   if (selString1)  delete[] selString1;
   if (selString2)  delete[] selString2;
   selString1 = NULL;
@@ -498,50 +491,28 @@ int i;
 }
 
 int  ssm::Superpose::CalculateTMatrix()  {
-mmdb::realtype det,B;
-int            i,j,k;
-
-  det = A[1][1]*A[2][2]*A[3][3] +
-        A[1][2]*A[2][3]*A[3][1] +
-        A[2][1]*A[3][2]*A[1][3] -
-        A[1][3]*A[2][2]*A[3][1] -
-        A[1][1]*A[2][3]*A[3][2] -
-        A[3][3]*A[1][2]*A[2][1];
+mmdb::mat33    A0,R;
+mmdb::realtype lambda;
+int            i,j;
 
-  mmdb::math::SVD ( 3,3,3,A,U,V,W,RV1,true,true,i );
+  for (i=0;i<3;i++)
+    for (j=0;j<3;j++)
+      A0[i][j] = A[i+1][j+1];
 
-  if (i!=0) {
-    for (j=0;j<4;j++)  {
-      for (k=0;k<4;k++)
-        TMatrix[j][k] = 0.0;
-      TMatrix[j][j] = 1.0;
+  if (mmdb::math::QCPRotation(A0,0.0,R,lambda)!=mmdb::math::QCP_Ok)  {
+    for (i=0;i<4;i++)  {
+      for (j=0;j<4;j++)
+        TMatrix[i][j] = 0.0;
+      TMatrix[i][i] = 1.0;
     }
     return 1;
   }
 
-  if (det<=0.0)  {
-    k = 0;
-    B = mmdb::MaxReal;
-    for (j=1;j<=3;j++)
-      if (W[j]<B)  {
-        B = W[j];
-        k = j;
-      }
-    for (j=1;j<=3;j++)
-      V[j][k] = -V[j][k];
+  for (i=0;i<3;i++)  {
+    for (j=0;j<3;j++)
+      TMatrix[i][j] = R[i][j];
+    TMatrix[3][i] = 0.0;
   }
-
-  for (j=1;j<=3;j++)
-    for (k=1;k<=3;k++)  {
-      B = 0.0;
-      for (i=1;i<=3;i++)
-        B += U[j][i]*V[k][i];
-      TMatrix[j-1][k-1] = B;
-    }
-
-  TMatrix[3][0] = 0.0;
-  TMatrix[3][1] = 0.0;
-  TMatrix[3][2] = 0.0;
   TMatrix[3][3] = 1.0;
 
   return 0;
@@ -1711,6 +1682,9 @@ bool           matched;
 
 int ssm::SortDist::Compare ( int i, int j )  {
 //  sort by decreasing: rd[i+1]<=rd[i]
+//  This is not a strict weak ordering because of the unmapping
+//  ranges, therefore SortDist remains based on QuickSort rather
+//  than mmdb::SortArray(..).
 
   if ((sd[i].unmap1<=sd[j].index) &&
       (sd[j].index<=sd[i].unmap2))  return -1;
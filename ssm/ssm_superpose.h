@@ -219,8 +219,7 @@ namespace ssm  {
       int            nres1,nres2,nalgn,ngaps,nmd,nmisdr;
       bool           allowMC;       //!< allowing for misconnection
 
-      mmdb::rmatrix  A,U,V, AD;
-      mmdb::rvector  W,RV1;
+      mmdb::rmatrix  A, AD;          //!< correlation and distance matrices
 
       mmdb::ivector  copyF1,copyF2;   //!< copy pointers to input F1,F2
       int            copyFlen;        //!< length of FF1,FF2